@@ -11448,9 +11448,9 @@ INFO::InfoPtr CGUIInfoManager::Register(const std::string &expression, int conte
   std::pair<INFOBOOLTYPE::iterator, bool> res;
 
   if (condition.find_first_of("|+[]!") != std::string::npos)
-    res = m_bools.insert(std::make_shared<InfoExpression>(condition, context, m_refreshCounter));
+    res = m_bools.insert(std::make_shared<InfoExpression>(condition, context, m_refreshCounters));
   else
-    res = m_bools.insert(std::make_shared<InfoSingle>(condition, context, m_refreshCounter));
+    res = m_bools.insert(std::make_shared<InfoSingle>(condition, context, m_refreshCounters));
 
   if (res.second)
     res.first->get()->Initialize(this);
@@ -11754,11 +11754,13 @@ void CGUIInfoManager::ResetCurrentItem()
 {
   m_currentFile = std::make_unique<CFileItem>();
   m_infoProviders.InitCurrentItem(nullptr);
+  ResetCache(INFO::DEPENDS_PLAYER);
 }
 
 void CGUIInfoManager::UpdateCurrentItem(const CFileItem &item)
 {
   m_currentFile->UpdateInfo(item);
+  ResetCache(INFO::DEPENDS_PLAYER);
 }
 
 void CGUIInfoManager::SetCurrentItem(const CFileItem &item)
@@ -11767,6 +11769,7 @@ void CGUIInfoManager::SetCurrentItem(const CFileItem &item)
   ART::FillInDefaultIcon(*m_currentFile);
 
   m_infoProviders.InitCurrentItem(m_currentFile.get());
+  ResetCache(INFO::DEPENDS_PLAYER);
 
   CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::Info, "OnChanged");
 }
@@ -12064,11 +12067,112 @@ bool CGUIInfoManager::GetItemBool(const CGUIListItem *item, int contextWindow, i
   return value;
 }
 
-void CGUIInfoManager::ResetCache()
+void CGUIInfoManager::ResetCache(unsigned int dependencies /* = INFO::DEPENDS_ALL */)
 {
   // mark our infobools as dirty
   std::unique_lock lock(m_critInfo);
-  ++m_refreshCounter;
+  m_refreshCounters.Invalidate(dependencies);
+}
+
+void CGUIInfoManager::ResetFrameCache()
+{
+  std::unique_lock lock(m_critInfo);
+
+  // nothing tells us about changes of these, poll them
+  unsigned int dependencies = INFO::DEPENDS_LISTITEM | INFO::DEPENDS_OTHER;
+
+  // the player state only changes while playing, and once when playback ends
+  const auto& components = CServiceBroker::GetAppComponents();
+  const auto appPlayer = components.GetComponent<CApplicationPlayer>();
+  const bool playing = appPlayer && appPlayer->IsPlaying();
+  if (playing || m_wasPlaying)
+    dependencies |= INFO::DEPENDS_PLAYER;
+  m_wasPlaying = playing;
+
+  const time_t now = time(nullptr);
+  if (now != m_lastFrameTime)
+    dependencies |= INFO::DEPENDS_TIME;
+  m_lastFrameTime = now;
+
+  m_refreshCounters.Invalidate(dependencies);
+
+  m_lastFrameStats.evaluations = m_refreshCounters.m_evaluations;
+  m_lastFrameStats.cached = m_refreshCounters.m_cached;
+  m_refreshCounters.m_evaluations = 0;
+  m_refreshCounters.m_cached = 0;
+}
+
+CGUIInfoManager::EvaluationStats CGUIInfoManager::GetEvaluationStats()
+{
+  std::unique_lock lock(m_critInfo);
+  return m_lastFrameStats;
+}
+
+unsigned int CGUIInfoManager::GetDependencies(int condition) const
+{
+  condition = std::abs(condition);
+
+  if (condition >= MULTI_INFO_START && condition <= MULTI_INFO_END)
+  {
+    const CGUIInfo& info = m_multiInfo[condition - MULTI_INFO_START];
+    const int type = std::abs(info.GetInfo());
+    if (type == INTEGER_VALUEOF)
+      return INFO::DEPENDS_NONE;
+
+    unsigned int dependencies = GetDependencies(type);
+    // comparisons depend on the infos they compare
+    if ((type >= STRING_IS_EMPTY && type <= STRING_CONTAINS) ||
+        (type >= INTEGER_IS_EQUAL && type <= INTEGER_ODD))
+    {
+      dependencies |= GetDependencies(info.GetData1());
+      if (info.GetData2() != 0)
+        dependencies |= GetDependencies(info.GetData2());
+    }
+    return dependencies;
+  }
+
+  if (condition >= LISTITEM_START && condition < LISTITEM_END)
+    return INFO::DEPENDS_LISTITEM;
+
+  switch (condition)
+  {
+    case 0:
+    case SYSTEM_ALWAYS_TRUE:
+    case SYSTEM_ALWAYS_FALSE:
+    case SYSTEM_PLATFORM_LINUX:
+    case SYSTEM_PLATFORM_WINDOWS:
+    case SYSTEM_PLATFORM_DARWIN:
+    case SYSTEM_PLATFORM_DARWIN_OSX:
+    case SYSTEM_PLATFORM_DARWIN_IOS:
+    case SYSTEM_PLATFORM_DARWIN_TVOS:
+    case SYSTEM_PLATFORM_UWP:
+    case SYSTEM_PLATFORM_ANDROID:
+    case SYSTEM_PLATFORM_WIN10:
+    case SYSTEM_PLATFORM_WEBOS:
+      return INFO::DEPENDS_NONE;
+    case SYSTEM_TIME:
+    case SYSTEM_DATE:
+      return INFO::DEPENDS_TIME;
+    case SKIN_BOOL:
+    case SKIN_STRING:
+    case SKIN_STRING_IS_EQUAL:
+    case SKIN_INTEGER:
+      return INFO::DEPENDS_SKIN;
+    // volume and playlists change without anything playing
+    case PLAYER_VOLUME:
+    case PLAYER_MUTED:
+    case VIDEOPLAYER_PLAYLISTLEN:
+    case VIDEOPLAYER_PLAYLISTPOS:
+      return INFO::DEPENDS_OTHER;
+    default:
+      break;
+  }
+
+  if ((condition >= PLAYER_HAS_MEDIA && condition <= PLAYER_IS_LIVE) ||
+      (condition >= VIDEOPLAYER_HDR_TYPE && condition <= VIDEOPLAYER_MEDIAPROVIDERS))
+    return INFO::DEPENDS_PLAYER;
+
+  return INFO::DEPENDS_OTHER;
 }
 
 void CGUIInfoManager::SetCurrentVideoTag(const CVideoInfoTag &tag)
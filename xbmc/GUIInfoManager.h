@@ -14,6 +14,7 @@
 #include "messaging/IMessageTarget.h"
 #include "threads/CriticalSection.h"
 
+#include <ctime>
 #include <map>
 #include <memory>
 #include <set>
@@ -57,7 +58,25 @@ public:
   void Initialize();
 
   void Clear();
-  void ResetCache();
+
+  /*! \brief Mark the info bools depending on any of the given inputs as dirty
+   \param dependencies a combination of INFO::InfoDependency flags
+   */
+  void ResetCache(unsigned int dependencies = INFO::DEPENDS_ALL);
+
+  /*! \brief Mark the info bools whose inputs may have changed since the last frame as dirty
+   Called once per frame, after rendering.
+   */
+  void ResetFrameCache();
+
+  /*! \brief Number of info bool evaluations in the last frame
+   */
+  struct EvaluationStats
+  {
+    unsigned int evaluations = 0; ///< evaluated conditions and expressions
+    unsigned int cached = 0; ///< requests served from cache
+  };
+  EvaluationStats GetEvaluationStats();
 
   // KODI::MESSAGING::IMessageTarget implementation
   int GetMessageMask() override;
@@ -98,6 +117,12 @@ public:
   int TranslateString(const std::string &strCondition);
   int TranslateSingleString(const std::string &strCondition, bool &listItemDependent);
 
+  /*! \brief Get the inputs a translated condition depends on
+   \param condition the condition as returned by TranslateSingleString
+   \return a combination of INFO::InfoDependency flags
+   */
+  unsigned int GetDependencies(int condition) const;
+
   std::string GetLabel(int info, int contextWindow, std::string* fallback = nullptr) const;
   std::string GetImage(int info, int contextWindow, std::string *fallback = nullptr);
   bool GetInt(int& value, int info, int contextWindow, const CGUIListItem* item = nullptr) const;
@@ -224,7 +249,10 @@ private:
   }
 
   INFOBOOLTYPE m_bools{&CGUIInfoManager::InfoBoolComparator};
-  unsigned int m_refreshCounter = 0;
+  INFO::InfoRefreshCounters m_refreshCounters;
+  EvaluationStats m_lastFrameStats;
+  bool m_wasPlaying = false;
+  time_t m_lastFrameTime = 0;
   std::vector<INFO::CSkinVariableString> m_skinVariableStrings;
 
   CCriticalSection m_critInfo;
@@ -102,11 +102,13 @@ bool CImageLoader::DoWork()
 CGUILargeTextureManager::CLargeTexture::CLargeTexture(const std::string& path,
                                                       unsigned int targetWidth,
                                                       unsigned int targetHeight,
-                                                      CAspectRatio::AspectRatio aspectRatio)
+                                                      CAspectRatio::AspectRatio aspectRatio,
+                                                      bool prefetch)
   : m_path(path),
     m_targetWidth(targetWidth),
     m_targetHeight(targetHeight),
-    m_aspectRatio(aspectRatio)
+    m_aspectRatio(aspectRatio),
+    m_prefetch(prefetch)
 {
   m_refCount = 1;
   m_timeToDelete = 0;
@@ -132,7 +134,10 @@ bool CGUILargeTextureManager::CLargeTexture::DecrRef(bool deleteImmediately)
     if (deleteImmediately)
       delete this;
     else
+    {
       m_timeToDelete = CTimeUtils::GetFrameTime() + TIME_TO_DELETE;
+      m_releaseTime = std::chrono::steady_clock::now();
+    }
     return true;
   }
   return false;
@@ -148,6 +153,15 @@ bool CGUILargeTextureManager::CLargeTexture::DeleteIfRequired(bool deleteImmedia
   return false;
 }
 
+uint64_t CGUILargeTextureManager::CLargeTexture::GetMemoryUsage() const
+{
+  uint64_t memUsage = 0;
+  for (const auto& texture : m_texture.m_textures)
+    memUsage += sizeof(CTexture) +
+                static_cast<uint64_t>(texture->GetTextureWidth()) * texture->GetTextureHeight() * 4;
+  return memUsage;
+}
+
 void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture> texture)
 {
   assert(!m_texture.size());
@@ -197,11 +211,37 @@ bool CGUILargeTextureManager::GetImage(const std::string& path,
     {
       if (firstRequest)
         image->AddRef();
+      if (image->IsPrefetch())
+      {
+        // keep prefetched images back until they are shown, so we know whether they were in time
+        if (m_prefetching)
+          return true;
+        image->SetShown();
+        if (image->GetTexture().size())
+          m_prefetchStats.hits++;
+      }
       texture = image->GetTexture();
       return texture.size() > 0;
     }
   }
 
+  if (!m_prefetching)
+  {
+    // shown while the prefetched image is still loading, so it's needed right away
+    for (queueIterator it = m_queued.begin(); it != m_queued.end(); ++it)
+    {
+      CLargeTexture* image = it->second;
+      if (image->IsPrefetch() && image->GetPath() == path && image->GetTargetWidth() == width &&
+          image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
+      {
+        image->SetShown();
+        m_prefetchStats.late++;
+        CServiceBroker::GetJobManager()->ChangeJobPriority(it->first, CJob::PRIORITY_NORMAL);
+        break;
+      }
+    }
+  }
+
   if (firstRequest)
     QueueImage(path, width, height, aspectRatio, useCache);
 
@@ -221,8 +261,14 @@ void CGUILargeTextureManager::ReleaseImage(const std::string& path,
     if (image->GetPath() == path && image->GetTargetWidth() == width &&
         image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
     {
-      if (image->DecrRef(immediately) && immediately)
-        m_allocated.erase(it);
+      const bool prefetch = image->IsPrefetch();
+      if (image->DecrRef(immediately))
+      {
+        if (prefetch)
+          m_prefetchStats.wasted++;
+        if (immediately)
+          m_allocated.erase(it);
+      }
       return;
     }
   }
@@ -231,9 +277,14 @@ void CGUILargeTextureManager::ReleaseImage(const std::string& path,
     unsigned int id = it->first;
     CLargeTexture *image = it->second;
     if (image->GetPath() == path && image->GetTargetWidth() == width &&
-        image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio &&
-        image->DecrRef(true))
+        image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
     {
+      const bool prefetch = image->IsPrefetch();
+      if (!image->DecrRef(true))
+        continue;
+      if (prefetch)
+        m_prefetchStats.wasted++;
+
       // cancel this job
       CServiceBroker::GetJobManager()->CancelJob(id);
       m_queued.erase(it);
@@ -264,11 +315,79 @@ void CGUILargeTextureManager::QueueImage(const std::string& path,
     }
   }
 
-  // queue the item
-  CLargeTexture* image = new CLargeTexture(path, width, height, aspectRatio);
+  // queue the item, prefetches must not hold up the images that are shown
+  CLargeTexture* image = new CLargeTexture(path, width, height, aspectRatio, m_prefetching);
   unsigned int jobID = CServiceBroker::GetJobManager()->AddJob(
-      new CImageLoader(path, width, height, aspectRatio, useCache), this, CJob::PRIORITY_NORMAL);
+      new CImageLoader(path, width, height, aspectRatio, useCache), this,
+      m_prefetching ? CJob::PRIORITY_LOW : CJob::PRIORITY_NORMAL);
   m_queued.emplace_back(jobID, image);
+
+  if (m_prefetching)
+    m_prefetchStats.queued++;
+  else
+    m_prefetchStats.misses++;
+}
+
+void CGUILargeTextureManager::SetPrefetching(bool prefetching)
+{
+  std::unique_lock lock(m_listSection);
+  m_prefetching = prefetching;
+}
+
+CGUILargeTextureManager::PrefetchStats CGUILargeTextureManager::GetPrefetchStats() const
+{
+  std::unique_lock lock(m_listSection);
+  return m_prefetchStats;
+}
+
+uint64_t CGUILargeTextureManager::GetMemoryUsage(uint64_t& unused) const
+{
+  std::unique_lock lock(m_listSection);
+  uint64_t memUsage = 0;
+  unused = 0;
+  for (const CLargeTexture* image : m_allocated)
+  {
+    const uint64_t imageUsage = image->GetMemoryUsage();
+    memUsage += imageUsage;
+    if (image->IsUnused())
+      unused += imageUsage;
+  }
+  return memUsage;
+}
+
+bool CGUILargeTextureManager::GetOldestUnused(
+    std::chrono::steady_clock::time_point& released) const
+{
+  std::unique_lock lock(m_listSection);
+  bool found = false;
+  for (const CLargeTexture* image : m_allocated)
+  {
+    if (image->IsUnused() && (!found || image->GetReleaseTime() < released))
+    {
+      released = image->GetReleaseTime();
+      found = true;
+    }
+  }
+  return found;
+}
+
+uint64_t CGUILargeTextureManager::FreeOldestUnused()
+{
+  std::unique_lock lock(m_listSection);
+  listIterator oldest = m_allocated.end();
+  for (listIterator it = m_allocated.begin(); it != m_allocated.end(); ++it)
+  {
+    if ((*it)->IsUnused() &&
+        (oldest == m_allocated.end() || (*it)->GetReleaseTime() < (*oldest)->GetReleaseTime()))
+      oldest = it;
+  }
+  if (oldest == m_allocated.end())
+    return 0;
+
+  const uint64_t memUsage = (*oldest)->GetMemoryUsage();
+  (*oldest)->DeleteIfRequired(true);
+  m_allocated.erase(oldest);
+  return memUsage;
 }
 
 void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJob *job)
@@ -14,6 +14,8 @@
 #include "jobs/Job.h"
 #include "threads/CriticalSection.h"
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -132,6 +134,53 @@ public:
    */
   void CleanupUnusedImages(bool immediately = false);
 
+  /*!
+   \brief Mark the images requested from now on as prefetches of offscreen items.
+
+   Prefetched images are loaded at low priority, and are handed out only once they are requested
+   without prefetching, i.e. when they are shown. This is what the hit rate is based on. Must be
+   reset after the offscreen items have been processed.
+
+   \param prefetching true to mark the following requests as prefetches
+   \sa GetPrefetchStats
+   */
+  void SetPrefetching(bool prefetching);
+
+  struct PrefetchStats
+  {
+    unsigned int queued{0}; ///< images queued by prefetching
+    unsigned int hits{0}; ///< prefetched images that were loaded when they were shown
+    unsigned int late{0}; ///< prefetched images that were still loading when they were shown
+    unsigned int misses{0}; ///< images that weren't prefetched and had to be loaded when shown
+    unsigned int wasted{0}; ///< prefetched images released without being shown
+  };
+
+  /*!
+   \brief Get the counters of the prefetching, used to tune the number of prefetched items.
+   */
+  PrefetchStats GetPrefetchStats() const;
+
+  /*!
+   \brief Get the memory used by the loaded images.
+   \param unused set to the memory used by the images that are no longer in use
+   \return the memory used by all loaded images, in bytes
+   */
+  uint64_t GetMemoryUsage(uint64_t& unused) const;
+
+  /*!
+   \brief Get the time the least recently used of the images no longer in use was released.
+   \return false if all images are in use
+   \sa CGUITextureBudget
+   */
+  bool GetOldestUnused(std::chrono::steady_clock::time_point& released) const;
+
+  /*!
+   \brief Free the least recently used of the images no longer in use.
+   \return the memory freed, in bytes
+   \sa CGUITextureBudget
+   */
+  uint64_t FreeOldestUnused();
+
 private:
   class CLargeTexture
   {
@@ -139,7 +188,8 @@ private:
     explicit CLargeTexture(const std::string& path,
                            unsigned int targetWidth,
                            unsigned int targetHeight,
-                           CAspectRatio::AspectRatio aspectRatio);
+                           CAspectRatio::AspectRatio aspectRatio,
+                           bool prefetch);
     virtual ~CLargeTexture();
 
     void AddRef();
@@ -153,6 +203,16 @@ private:
     unsigned int GetTargetHeight() const { return m_targetHeight; }
     CAspectRatio::AspectRatio GetAspectRatio() const { return m_aspectRatio; }
 
+    /*!
+     \brief Whether the image was requested by prefetching only and wasn't shown yet.
+     */
+    bool IsPrefetch() const { return m_prefetch; }
+    void SetShown() { m_prefetch = false; }
+
+    bool IsUnused() const { return m_refCount == 0; }
+    std::chrono::steady_clock::time_point GetReleaseTime() const { return m_releaseTime; }
+    uint64_t GetMemoryUsage() const;
+
   private:
     static const unsigned int TIME_TO_DELETE = 2000;
 
@@ -163,6 +223,8 @@ private:
     unsigned int m_targetHeight;
     CAspectRatio::AspectRatio m_aspectRatio;
     unsigned int m_timeToDelete;
+    std::chrono::steady_clock::time_point m_releaseTime;
+    bool m_prefetch;
   };
 
   void QueueImage(const std::string& path,
@@ -176,6 +238,9 @@ private:
   typedef std::vector<CLargeTexture *>::iterator listIterator;
   typedef std::vector< std::pair<unsigned int, CLargeTexture *> >::iterator queueIterator;
 
-  CCriticalSection m_listSection;
+  bool m_prefetching{false};
+  PrefetchStats m_prefetchStats;
+
+  mutable CCriticalSection m_listSection;
 };
 
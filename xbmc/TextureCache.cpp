@@ -24,20 +24,41 @@
 #include "jobs/JobManager.h"
 #include "profiles/ProfileManager.h"
 #include "settings/SettingsComponent.h"
+#include "utils/CPUInfo.h"
 #include "utils/Crc32.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <mutex>
 #include <optional>
 #include <string.h>
+#include <utility>
 
 using namespace XFILE;
 using namespace std::chrono_literals;
 
+namespace
+{
+// caching jobs of a batch queued at the job manager at once, which limits how many of them run.
+// Decoding and scaling keep a core busy, so one per core within these bounds.
+constexpr unsigned int MIN_BATCH_JOBS_AT_ONCE = 2;
+constexpr unsigned int MAX_BATCH_JOBS_AT_ONCE = 8;
+// cached images added to the database in one transaction
+constexpr size_t DATABASE_BATCH_SIZE = 50;
+
+unsigned int GetBatchJobsAtOnce()
+{
+  const std::shared_ptr<CCPUInfo> cpuInfo = CServiceBroker::GetCPUInfo();
+  const int cpus = cpuInfo ? cpuInfo->GetCPUCount() : 0;
+  return std::clamp(static_cast<unsigned int>(std::max(cpus, 0)), MIN_BATCH_JOBS_AT_ONCE,
+                    MAX_BATCH_JOBS_AT_ONCE);
+}
+} // namespace
+
 CTextureCache::CTextureCache()
   : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE), m_cleanTimer{[this]() { CleanTimer(); }}
 {
@@ -56,6 +77,8 @@ void CTextureCache::Initialize()
 void CTextureCache::Deinitialize()
 {
   CancelJobs();
+  m_batchQueue.CancelJobs();
+  m_batchQueue.Flush();
 
   std::unique_lock lock(m_databaseSection);
   m_database.Close();
@@ -117,21 +140,41 @@ std::string CTextureCache::CheckCachedImage(const std::string &url, bool &needsR
 }
 
 void CTextureCache::BackgroundCacheImage(const std::string &url)
+{
+  std::unique_ptr<CTextureCacheJob> job = CreateCacheJob(url);
+  if (job)
+    AddJob(job.release());
+}
+
+void CTextureCache::BackgroundCacheImages(const std::vector<std::string>& images)
+{
+  for (const auto& image : images)
+  {
+    std::unique_ptr<CTextureCacheJob> job = CreateCacheJob(image);
+    if (job)
+    {
+      job->m_reducedResolution = true;
+      m_batchQueue.QueueJob(std::move(job));
+    }
+  }
+}
+
+std::unique_ptr<CTextureCacheJob> CTextureCache::CreateCacheJob(const std::string& url)
 {
   if (url.empty())
-    return;
+    return {};
 
   CTextureDetails details;
   std::string path(GetCachedImage(url, details));
   if (!path.empty() && details.hash.empty())
-    return; // image is already cached and doesn't need to be checked further
+    return {}; // image is already cached and doesn't need to be checked further
 
   path = IMAGE_FILES::ToCacheKey(url);
   if (path.empty())
-    return;
+    return {};
 
   // needs (re)caching
-  AddJob(new CTextureCacheJob(path, details.hash));
+  return std::make_unique<CTextureCacheJob>(path, details.hash);
 }
 
 bool CTextureCache::StartCacheImage(const std::string& image)
@@ -320,6 +363,33 @@ void CTextureCache::OnCachingComplete(bool success, CTextureCacheJob *job)
   m_completeEvent.Set();
 }
 
+void CTextureCache::OnBatchCachingComplete(const std::vector<CBatchQueue::CachedImage>& images)
+{
+  {
+    std::unique_lock lock(m_databaseSection);
+    m_database.BeginTransaction();
+    for (const auto& image : images)
+    {
+      if (!image.success)
+        continue;
+
+      if (image.details.hashRevalidated)
+        m_database.SetCachedTextureValid(image.url, image.details.updateable);
+      else
+        m_database.AddCachedTexture(image.url, image.details);
+    }
+    m_database.CommitTransaction();
+  }
+
+  { // remove from our processing list
+    std::unique_lock lock(m_processingSection);
+    for (const auto& image : images)
+      m_processinglist.erase(image.url);
+  }
+
+  m_completeEvent.Set();
+}
+
 void CTextureCache::OnJobComplete(unsigned int jobID, bool success, CJob *job)
 {
   if (strcmp(job->GetType(), CTextureCacheJob::JOB_TYPE_CACHE_IMAGE) == 0)
@@ -327,6 +397,85 @@ void CTextureCache::OnJobComplete(unsigned int jobID, bool success, CJob *job)
   return CJobQueue::OnJobComplete(jobID, success, job);
 }
 
+CTextureCache::CBatchQueue::CBatchQueue(CTextureCache& cache)
+  : CJobQueue(false, GetBatchJobsAtOnce(), CJob::PRIORITY_LOW_PAUSABLE), m_cache(cache)
+{
+}
+
+void CTextureCache::CBatchQueue::QueueJob(std::unique_ptr<CTextureCacheJob> job)
+{
+  {
+    std::unique_lock lock(m_section);
+    if (m_pending++ == 0)
+    {
+      m_start = std::chrono::steady_clock::now();
+      m_cached = 0;
+    }
+  }
+
+  // the job may complete before AddJob returns, so it's counted as pending beforehand
+  if (!AddJob(job.release()))
+  {
+    std::unique_lock lock(m_section);
+    m_pending--;
+  }
+}
+
+void CTextureCache::CBatchQueue::Flush()
+{
+  std::vector<CachedImage> batch;
+  {
+    std::unique_lock lock(m_section);
+    batch.swap(m_completed);
+    m_pending = 0;
+  }
+  if (!batch.empty())
+    m_cache.OnBatchCachingComplete(batch);
+}
+
+void CTextureCache::CBatchQueue::OnJobComplete(unsigned int jobID, bool success, CJob* job)
+{
+  const CTextureCacheJob* cacheJob = static_cast<const CTextureCacheJob*>(job);
+  OnCachingComplete({cacheJob->m_url, cacheJob->m_details, success});
+  CJobQueue::OnJobComplete(jobID, success, job);
+}
+
+void CTextureCache::CBatchQueue::OnJobAbort(unsigned int jobID, CJob* job)
+{
+  OnCachingComplete({static_cast<const CTextureCacheJob*>(job)->m_url, {}, false});
+  CJobQueue::OnJobAbort(jobID, job);
+}
+
+void CTextureCache::CBatchQueue::OnCachingComplete(CachedImage image)
+{
+  std::vector<CachedImage> batch;
+  bool finished = false;
+  unsigned int cached = 0;
+  std::chrono::steady_clock::time_point start;
+  {
+    std::unique_lock lock(m_section);
+    if (image.success)
+      m_cached++;
+    m_completed.emplace_back(std::move(image));
+    finished = m_pending > 0 && --m_pending == 0;
+    if (finished || m_completed.size() >= DATABASE_BATCH_SIZE)
+      batch.swap(m_completed);
+    cached = m_cached;
+    start = m_start;
+  }
+
+  if (!batch.empty())
+    m_cache.OnBatchCachingComplete(batch);
+
+  if (finished)
+  {
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    CLog::Log(LOGINFO, "{} - cached {} images in {:.1f} s, {:.1f} images/s", __FUNCTION__, cached,
+              seconds, seconds > 0 ? cached / seconds : 0.0);
+  }
+}
+
 bool CTextureCache::Export(const std::string &image, const std::string &destination, bool overwrite)
 {
   CTextureDetails details;
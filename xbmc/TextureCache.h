@@ -76,6 +76,17 @@ public:
    */
   void BackgroundCacheImage(const std::string &image);
 
+  /*! \brief Cache images (if required) using background jobs, adding them to the database in batches
+
+   Like BackgroundCacheImage for many images at once, e.g. the pictures of a folder. The caching
+   jobs run at low priority, large JPEGs are decoded at a reduced resolution and the cached images
+   are added to the database in batches rather than one by one.
+
+   \param images urls of the images to cache
+   \sa BackgroundCacheImage, CTextureCacheBatchJob
+   */
+  void BackgroundCacheImages(const std::vector<std::string>& images);
+
   /*! \brief Updates the in-process list.
 
    Inserts the image url into the currently processing list 
@@ -172,6 +183,57 @@ private:
   CTextureCache(const CTextureCache&) = delete;
   CTextureCache const& operator=(CTextureCache const&) = delete;
 
+  /*!
+   \brief Job queue for the caching jobs of BackgroundCacheImages
+   Runs several caching jobs at once through the job manager and collects their results, adding
+   them to the database in batches.
+   */
+  class CBatchQueue : public CJobQueue
+  {
+  public:
+    struct CachedImage
+    {
+      std::string url;
+      CTextureDetails details;
+      bool success{false};
+    };
+
+    explicit CBatchQueue(CTextureCache& cache);
+
+    /*! \brief Queue a caching job
+     \param job the caching job
+     */
+    void QueueJob(std::unique_ptr<CTextureCacheJob> job);
+
+    /*! \brief Add the results collected so far to the database
+     */
+    void Flush();
+
+    void OnJobComplete(unsigned int jobID, bool success, CJob* job) override;
+    void OnJobAbort(unsigned int jobID, CJob* job) override;
+
+  private:
+    void OnCachingComplete(CachedImage image);
+
+    CTextureCache& m_cache;
+    CCriticalSection m_section;
+    std::vector<CachedImage> m_completed; ///< results not yet added to the database
+    unsigned int m_pending{0}; ///< queued jobs which haven't completed yet
+    unsigned int m_cached{0};
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+  /*! \brief Create a job caching an image if required
+
+   Checks whether an image is already cached [see BackgroundCacheImage] and
+   creates a job to cache the image if it isn't or needs to be checked for changes.
+
+   \param image url of the image to cache
+   \return the caching job, nullptr if the image is cached already
+   \sa BackgroundCacheImage, BackgroundCacheImages
+   */
+  std::unique_ptr<CTextureCacheJob> CreateCacheJob(const std::string& image);
+
   /*! \brief Check if the given image is a cached image
    \param image url of the image
    \return true if this is a cached image, false otherwise.
@@ -228,6 +290,12 @@ private:
    */
   void OnCachingComplete(bool success, CTextureCacheJob *job);
 
+  /*! \brief Called when a batch of caching jobs has completed.
+   Updates the database in a single transaction and removes the images from our processing list.
+   \param images the cached images along with whether caching was successful.
+   */
+  void OnBatchCachingComplete(const std::vector<CBatchQueue::CachedImage>& images);
+
   void CleanTimer();
   std::chrono::milliseconds ScanOldestCache();
   bool CleanAllUnusedImagesJob(CGUIDialogProgress* progress);
@@ -241,5 +309,6 @@ private:
   CEvent               m_completeEvent; ///< Set whenever a job has finished
   std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
   CCriticalSection             m_useCountSection;
+  CBatchQueue m_batchQueue{*this}; ///< queue of the jobs caching images in batches
 };
 
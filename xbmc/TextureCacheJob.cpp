@@ -9,12 +9,15 @@
 #include "TextureCacheJob.h"
 
 #include "FileItem.h"
+#include "FileItemList.h"
 #include "ServiceBroker.h"
 #include "TextureCache.h"
 #include "TextureDatabase.h"
 #include "URL.h"
+#include "Util.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/audiodecoder.h"
 #include "commons/ilog.h"
+#include "filesystem/Directory.h"
 #include "filesystem/File.h"
 #include "guilib/Texture.h"
 #include "imagefiles/ImageFileURL.h"
@@ -22,10 +25,12 @@
 #include "pictures/Picture.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/FileExtensionProvider.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
@@ -114,7 +119,7 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     }
   }
 
-  std::unique_ptr<CTexture> texture = LoadImage(imageURL);
+  std::unique_ptr<CTexture> texture = LoadImage(imageURL, m_reducedResolution);
   if (texture)
   {
     if (texture->HasAlpha())
@@ -165,7 +170,8 @@ bool CTextureCacheJob::ResizeTexture(const std::string& url,
   return success;
 }
 
-std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageFileURL& imageURL)
+std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageFileURL& imageURL,
+                                                      bool reducedResolution /* = false */)
 {
   if (imageURL.IsSpecialImage())
   {
@@ -186,7 +192,21 @@ std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageF
     return {};
   }
 
-  auto texture = CTexture::LoadFromFile(imageURL.GetTargetFile(), 0, 0, CAspectRatio::CENTER,
+  // CPicture::CacheTexture scales images down to at most the fanart or image resolution
+  unsigned int idealWidth = 0;
+  unsigned int idealHeight = 0;
+  if (reducedResolution)
+  {
+    const std::shared_ptr<CAdvancedSettings> advancedSettings =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    idealHeight = std::max(advancedSettings->m_imageRes, advancedSettings->m_fanartRes);
+    idealWidth = idealHeight * 16 / 9;
+  }
+
+  // only fitted images may be decoded at a reduced resolution
+  auto texture = CTexture::LoadFromFile(imageURL.GetTargetFile(), idealWidth, idealHeight,
+                                        reducedResolution ? CAspectRatio::KEEP
+                                                          : CAspectRatio::CENTER,
                                         file.GetMimeType());
   if (!texture)
     return {};
@@ -253,3 +273,39 @@ bool CTextureUseCountJob::DoWork()
   }
   return true;
 }
+
+CTextureCacheBatchJob::CTextureCacheBatchJob(const std::string& path) : m_path(path)
+{
+}
+
+bool CTextureCacheBatchJob::Equals(const CJob* job) const
+{
+  if (strcmp(job->GetType(), GetType()) == 0)
+  {
+    const CTextureCacheBatchJob* batchJob = dynamic_cast<const CTextureCacheBatchJob*>(job);
+    if (batchJob && batchJob->m_path == m_path)
+      return true;
+  }
+  return false;
+}
+
+bool CTextureCacheBatchJob::DoWork()
+{
+  CFileItemList items;
+  CUtil::GetRecursiveListing(m_path, items,
+                             CServiceBroker::GetFileExtensionProvider().GetPictureExtensions(),
+                             XFILE::DIR_FLAG_NO_FILE_DIRS);
+
+  // the thumbs of pictures are the pictures themselves, see CPictureThumbLoader
+  std::vector<std::string> images;
+  for (const auto& item : items)
+  {
+    if (item->IsPicture() && !item->IsZIP() && !item->IsRAR() && !item->IsCBZ() && !item->IsCBR())
+      images.emplace_back(IMAGE_FILES::URLFromFile(item->GetPath()));
+  }
+
+  CLog::Log(LOGDEBUG, "{} - caching {} pictures in '{}'", __FUNCTION__, images.size(),
+            CURL::GetRedacted(m_path));
+  CServiceBroker::GetTextureCache()->BackgroundCacheImages(images);
+  return true;
+}
@@ -80,6 +80,7 @@ public:
   std::string m_url;
   std::string m_oldHash;
   CTextureDetails m_details;
+  bool m_reducedResolution{false}; ///< decode large images at the size they are cached at
 private:
   /*! \brief retrieve a hash for the given image
    Combines the size, ctime and mtime of the image file into a "unique" hash
@@ -94,9 +95,12 @@ private:
    or smaller than the desired size for speed reasons.
 
    \param image the URL of the image file.
+   \param reducedResolution whether a large image may be decoded at a lower resolution, which is
+   never less than the resolution images are cached at.
    \return a pointer to a CTexture object, NULL if failed.
    */
-  static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL);
+  static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL,
+                                             bool reducedResolution = false);
 
   std::string    m_cachePath;
 };
@@ -115,3 +119,26 @@ public:
 private:
   std::vector<CTextureDetails> m_textures;
 };
+
+/*!
+ \ingroup textures
+ \brief Job class for caching the pictures of a folder and its subfolders
+
+ Lists the pictures and hands the ones which aren't cached yet to the texture cache, which caches
+ them in low priority jobs and adds them to the database in batches.
+ \sa CTextureCache::BackgroundCacheImages
+ */
+class CTextureCacheBatchJob : public CJob
+{
+public:
+  static constexpr const char* JOB_TYPE_CACHE_PICTURES = "cachepictures";
+
+  explicit CTextureCacheBatchJob(const std::string& path);
+
+  const char* GetType() const override { return JOB_TYPE_CACHE_PICTURES; }
+  bool Equals(const CJob* job) const override;
+  bool DoWork() override;
+
+private:
+  std::string m_path;
+};
@@ -139,7 +139,11 @@ bool CApplicationSkinHandling::LoadSkin(const std::string& skinID)
 
   skin->LoadIncludes();
 
+  const auto fontsStart = std::chrono::steady_clock::now();
   g_fontManager.LoadFonts(settings->GetString(CSettings::SETTING_LOOKANDFEEL_FONT));
+  const std::chrono::duration<double, std::milli> fontsDuration =
+      std::chrono::steady_clock::now() - fontsStart;
+  CLog::Log(LOGDEBUG, "Load Skin Fonts: {:.2f} ms", fontsDuration.count());
 
   // load the skin strings in
   //! @todo Move skin language files to resources/language/ to match other addon structure
@@ -191,6 +191,30 @@ bool CActiveAEResampleFFMPEG::Init(SampleConfig dstConfig,
     CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Init - init resampler failed");
     return false;
   }
+
+  // a plain float to integer conversion, like the sink stage mostly does, is handled by the
+  // SIMD kernels of CAEUtil. swresample takes over as soon as there is more to do.
+  auto isIdentity = [this]()
+  {
+    for (int out = 0; out < m_dst_channels; out++)
+    {
+      for (int in = 0; in < m_src_channels; in++)
+      {
+        if (m_rematrix[out][in] != (out == in ? 1.0 : 0.0))
+          return false;
+      }
+    }
+    return true;
+  };
+  // S32 carrying fewer bits is reduced by swresample (output_sample_bits), leave that to it
+  const bool convertsFormat =
+      (m_src_fmt == AV_SAMPLE_FMT_FLT &&
+       (m_dst_fmt == AV_SAMPLE_FMT_S16 || (m_dst_fmt == AV_SAMPLE_FMT_S32 && m_dst_bits == 32))) ||
+      (m_src_fmt == AV_SAMPLE_FMT_FLTP &&
+       (m_dst_fmt == AV_SAMPLE_FMT_S16P || (m_dst_fmt == AV_SAMPLE_FMT_S32P && m_dst_bits == 32)));
+  m_convertOnly = convertsFormat && !m_doesResample && m_src_channels == m_dst_channels &&
+                  (hasMatrix ? isIdentity() : m_src_chan_layout == m_dst_chan_layout);
+
   return true;
 }
 
@@ -214,12 +238,24 @@ int CActiveAEResampleFFMPEG::Resample(uint8_t **dst_buffer, int dst_samples, uin
     }
   }
 
-  //! @bug libavresample isn't const correct
-  int ret = swr_convert(m_pContext, dst_buffer, dst_samples, const_cast<const uint8_t**>(src_buffer), src_samples);
-  if (ret < 0)
+  int ret;
+  if (m_convertOnly && !m_doesResample && dst_samples >= src_samples)
+  {
+    ret = Convert(dst_buffer, src_buffer, src_samples);
+  }
+  else
   {
-    CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Resample - resample failed");
-    return -1;
+    // swresample may hold back samples from now on, don't switch back
+    m_convertOnly = false;
+
+    //! @bug libavresample isn't const correct
+    ret = swr_convert(m_pContext, dst_buffer, dst_samples,
+                      const_cast<const uint8_t**>(src_buffer), src_samples);
+    if (ret < 0)
+    {
+      CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Resample - resample failed");
+      return -1;
+    }
   }
 
   // special handling for S24 formats which are carried in S32
@@ -275,6 +311,22 @@ int CActiveAEResampleFFMPEG::Resample(uint8_t **dst_buffer, int dst_samples, uin
   return ret;
 }
 
+int CActiveAEResampleFFMPEG::Convert(uint8_t** dst_buffer, uint8_t** src_buffer, int samples)
+{
+  const int planes = av_sample_fmt_is_planar(m_src_fmt) ? m_src_channels : 1;
+  const uint32_t count = samples * m_src_channels / planes;
+  const bool s16 = m_dst_fmt == AV_SAMPLE_FMT_S16 || m_dst_fmt == AV_SAMPLE_FMT_S16P;
+  for (int i = 0; i < planes; i++)
+  {
+    const float* src = reinterpret_cast<const float*>(src_buffer[i]);
+    if (s16)
+      CAEUtil::FloatToS16Array(reinterpret_cast<int16_t*>(dst_buffer[i]), src, count);
+    else
+      CAEUtil::FloatToS32Array(reinterpret_cast<int32_t*>(dst_buffer[i]), src, count);
+  }
+  return samples;
+}
+
 int64_t CActiveAEResampleFFMPEG::GetDelay(int64_t base)
 {
   return swr_get_delay(m_pContext, base);
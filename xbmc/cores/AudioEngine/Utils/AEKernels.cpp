@@ -0,0 +1,286 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <cmath>
+
+// the SSE2 kernels are built for any x86 target, they are only used if the CPU has SSE2
+#if defined(__SSE2__)
+#define AE_KERNELS_SSE2
+#define AE_TARGET_SSE2
+#include <emmintrin.h>
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define AE_KERNELS_SSE2
+#define AE_TARGET_SSE2 __attribute__((target("sse2")))
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define AE_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+constexpr float S16_SCALE = 32768.0f;
+constexpr float S32_SCALE = 2147483648.0f;
+// largest float below 2^31, INT32_MAX itself can't be represented
+constexpr float S32_MAX_FLOAT = 2147483520.0f;
+
+void MulC(float* data, float mul, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    data[i] *= mul;
+}
+
+bool MulAddC(float* data, const float* add, float mul, uint32_t count)
+{
+  bool clamp = false;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    data[i] += add[i] * mul;
+    clamp |= std::fabs(data[i]) > 1.0f;
+  }
+  return clamp;
+}
+
+void FloatToS16C(int16_t* dst, const float* src, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    dst[i] = static_cast<int16_t>(std::clamp(std::lrintf(src[i] * S16_SCALE), -32768L, 32767L));
+}
+
+void S16ToFloatC(float* dst, const int16_t* src, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    dst[i] = src[i] * (1.0f / S16_SCALE);
+}
+
+void FloatToS32C(int32_t* dst, const float* src, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    dst[i] = static_cast<int32_t>(
+        std::lrintf(std::clamp(src[i] * S32_SCALE, -S32_SCALE, S32_MAX_FLOAT)));
+}
+
+void S32ToFloatC(float* dst, const int32_t* src, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    dst[i] = src[i] * (1.0f / S32_SCALE);
+}
+
+const AEKernels KERNELS_C = {"C++",       MulC,        MulAddC,    FloatToS16C,
+                             S16ToFloatC, FloatToS32C, S32ToFloatC};
+
+#if defined(AE_KERNELS_SSE2)
+AE_TARGET_SSE2 void MulSSE2(float* data, float mul, uint32_t count)
+{
+  const __m128 m = _mm_set1_ps(mul);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    _mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), m));
+  MulC(data + i, mul, count - i);
+}
+
+AE_TARGET_SSE2 bool MulAddSSE2(float* data, const float* add, float mul, uint32_t count)
+{
+  const __m128 m = _mm_set1_ps(mul);
+  const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+  __m128 peak = _mm_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 sum = _mm_add_ps(_mm_loadu_ps(data + i), _mm_mul_ps(_mm_loadu_ps(add + i), m));
+    _mm_storeu_ps(data + i, sum);
+    peak = _mm_max_ps(peak, _mm_and_ps(sum, absMask));
+  }
+  const bool clamp = _mm_movemask_ps(_mm_cmpgt_ps(peak, _mm_set1_ps(1.0f))) != 0;
+  return MulAddC(data + i, add + i, mul, count - i) || clamp;
+}
+
+AE_TARGET_SSE2 void FloatToS16SSE2(int16_t* dst, const float* src, uint32_t count)
+{
+  const __m128 scale = _mm_set1_ps(S16_SCALE);
+  const __m128 min = _mm_set1_ps(-S16_SCALE);
+  const __m128 max = _mm_set1_ps(S16_SCALE - 1.0f);
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128 lo = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), min), max);
+    const __m128 hi =
+        _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale), min), max);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_packs_epi32(_mm_cvtps_epi32(lo), _mm_cvtps_epi32(hi)));
+  }
+  FloatToS16C(dst + i, src + i, count - i);
+}
+
+AE_TARGET_SSE2 void S16ToFloatSSE2(float* dst, const int16_t* src, uint32_t count)
+{
+  const __m128 scale = _mm_set1_ps(1.0f / S16_SCALE);
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+    _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+  }
+  S16ToFloatC(dst + i, src + i, count - i);
+}
+
+AE_TARGET_SSE2 void FloatToS32SSE2(int32_t* dst, const float* src, uint32_t count)
+{
+  const __m128 scale = _mm_set1_ps(S32_SCALE);
+  const __m128 min = _mm_set1_ps(-S32_SCALE);
+  const __m128 max = _mm_set1_ps(S32_MAX_FLOAT);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 v = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), min), max);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_cvtps_epi32(v));
+  }
+  FloatToS32C(dst + i, src + i, count - i);
+}
+
+AE_TARGET_SSE2 void S32ToFloatSSE2(float* dst, const int32_t* src, uint32_t count)
+{
+  const __m128 scale = _mm_set1_ps(1.0f / S32_SCALE);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(in), scale));
+  }
+  S32ToFloatC(dst + i, src + i, count - i);
+}
+
+const AEKernels KERNELS_SSE2 = {"SSE2",         MulSSE2,        MulAddSSE2,    FloatToS16SSE2,
+                                S16ToFloatSSE2, FloatToS32SSE2, S32ToFloatSSE2};
+#endif
+
+#if defined(AE_KERNELS_NEON)
+inline int32x4_t RoundToInt(float32x4_t v)
+{
+#if defined(__aarch64__)
+  return vcvtnq_s32_f32(v);
+#else
+  // ARMv7 only converts towards zero. Adding and subtracting 2^23 with the sign of v rounds to
+  // nearest even like the other kernels, larger values have no fraction left to round.
+  const float32x4_t limit = vdupq_n_f32(8388608.0f);
+  const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000));
+  const float32x4_t magic = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(limit), sign));
+  const float32x4_t rounded = vsubq_f32(vaddq_f32(v, magic), magic);
+  return vcvtq_s32_f32(vbslq_f32(vcaltq_f32(v, limit), rounded, v));
+#endif
+}
+
+void MulNEON(float* data, float mul, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(data + i, vmulq_n_f32(vld1q_f32(data + i), mul));
+  MulC(data + i, mul, count - i);
+}
+
+bool MulAddNEON(float* data, const float* add, float mul, uint32_t count)
+{
+  float32x4_t peak = vdupq_n_f32(0.0f);
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t sum = vmlaq_n_f32(vld1q_f32(data + i), vld1q_f32(add + i), mul);
+    vst1q_f32(data + i, sum);
+    peak = vmaxq_f32(peak, vabsq_f32(sum));
+  }
+  const uint32x4_t over = vcgtq_f32(peak, vdupq_n_f32(1.0f));
+  const uint32x2_t any = vorr_u32(vget_low_u32(over), vget_high_u32(over));
+  const bool clamp = (vget_lane_u32(any, 0) | vget_lane_u32(any, 1)) != 0;
+  return MulAddC(data + i, add + i, mul, count - i) || clamp;
+}
+
+void FloatToS16NEON(int16_t* dst, const float* src, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    // the conversion and the narrowing saturate
+    const int32x4_t lo = RoundToInt(vmulq_n_f32(vld1q_f32(src + i), S16_SCALE));
+    const int32x4_t hi = RoundToInt(vmulq_n_f32(vld1q_f32(src + i + 4), S16_SCALE));
+    vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+  }
+  FloatToS16C(dst + i, src + i, count - i);
+}
+
+void S16ToFloatNEON(float* dst, const int16_t* src, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t in = vld1q_s16(src + i);
+    vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(in))), 1.0f / S16_SCALE));
+    vst1q_f32(dst + i + 4,
+              vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(in))), 1.0f / S16_SCALE));
+  }
+  S16ToFloatC(dst + i, src + i, count - i);
+}
+
+void FloatToS32NEON(int32_t* dst, const float* src, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    vst1q_s32(dst + i, RoundToInt(vmulq_n_f32(vld1q_f32(src + i), S32_SCALE)));
+  FloatToS32C(dst + i, src + i, count - i);
+}
+
+void S32ToFloatNEON(float* dst, const int32_t* src, uint32_t count)
+{
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(src + i)), 1.0f / S32_SCALE));
+  S32ToFloatC(dst + i, src + i, count - i);
+}
+
+const AEKernels KERNELS_NEON = {"NEON",         MulNEON,        MulAddNEON,    FloatToS16NEON,
+                                S16ToFloatNEON, FloatToS32NEON, S32ToFloatNEON};
+#endif
+} // namespace
+
+std::vector<const AEKernels*> CAEKernels::GetSupported()
+{
+  std::vector<const AEKernels*> kernels{&KERNELS_C};
+  [[maybe_unused]] const unsigned int features = CCPUInfo::GetCPUInfo()->GetCPUFeatures();
+
+#if defined(AE_KERNELS_SSE2)
+  if (features & CPU_FEATURE_SSE2)
+    kernels.push_back(&KERNELS_SSE2);
+#endif
+
+#if defined(AE_KERNELS_NEON)
+#if defined(__aarch64__)
+  // mandatory on AArch64
+  kernels.push_back(&KERNELS_NEON);
+#else
+  if (features & CPU_FEATURE_NEON)
+    kernels.push_back(&KERNELS_NEON);
+#endif
+#endif
+
+  return kernels;
+}
+
+const AEKernels& CAEKernels::Get()
+{
+  static const AEKernels& kernels = *GetSupported().back();
+  return kernels;
+}
@@ -0,0 +1,50 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/*!
+ * \brief Sample processing kernels of the audio engine for one instruction set.
+ *
+ * Float samples are in the range -1.0 .. 1.0, conversions to integer formats round to nearest
+ * and saturate like swresample does.
+ */
+struct AEKernels
+{
+  const char* name;
+
+  //! data[i] *= mul
+  void (*mul)(float* data, float mul, uint32_t count);
+
+  //! data[i] += add[i] * mul
+  //! \return true if any result is outside of -1.0 .. 1.0 and needs clamping
+  bool (*mulAdd)(float* data, const float* add, float mul, uint32_t count);
+
+  void (*floatToS16)(int16_t* dst, const float* src, uint32_t count);
+  void (*s16ToFloat)(float* dst, const int16_t* src, uint32_t count);
+  void (*floatToS32)(int32_t* dst, const float* src, uint32_t count);
+  void (*s32ToFloat)(float* dst, const int32_t* src, uint32_t count);
+};
+
+class CAEKernels
+{
+public:
+  /*!
+   * \brief Get the kernels for the best instruction set supported by the CPU.
+   * The set is selected once from the features reported by CCPUInfo.
+   */
+  static const AEKernels& Get();
+
+  /*!
+   * \brief Get all kernel sets usable on this CPU, the portable C++ one first.
+   */
+  static std::vector<const AEKernels*> GetSupported();
+};
@@ -164,10 +164,23 @@ public:
     return 20*log10(scale);
   }
 
-  #if defined(HAVE_SSE) && defined(__SSE__)
-  static void SSEMulArray     (float *data, const float mul, uint32_t count);
-  static void SSEMulAddArray  (float *data, float *add, const float mul, uint32_t count);
-  #endif
+  /*! \brief multiply the samples by a gain factor, using the best kernel for the CPU
+   \sa CAEKernels
+   */
+  static void MulArray(float* data, float mul, uint32_t count);
+
+  /*! \brief add the samples of add multiplied by mul to data
+   \return true if any of the resulting samples needs clamping
+   */
+  static bool MulAddArray(float* data, const float* add, float mul, uint32_t count);
+
+  /*! \brief convert between float and integer samples, rounding and saturating like swresample
+   */
+  static void FloatToS16Array(int16_t* dst, const float* src, uint32_t count);
+  static void S16ToFloatArray(float* dst, const int16_t* src, uint32_t count);
+  static void FloatToS32Array(int32_t* dst, const float* src, uint32_t count);
+  static void S32ToFloatArray(float* dst, const int32_t* src, uint32_t count);
+
   static void ClampArray(float *data, uint32_t count);
 
   static bool S16NeedsByteSwap(AEDataFormat in, AEDataFormat out);
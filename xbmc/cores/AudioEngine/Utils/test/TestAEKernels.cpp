@@ -0,0 +1,189 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AEKernels.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// odd on purpose, so every kernel runs its scalar tail too
+constexpr uint32_t SAMPLES = 4099;
+// one second of 7.1 at 48 kHz
+constexpr uint32_t FRAMES = 48000;
+constexpr uint32_t CHANNELS = 8;
+constexpr int ROUNDS = 20;
+
+std::vector<float> MakeSignal(uint32_t count, float peak)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<float> dist(-peak, peak);
+  std::vector<float> signal(count);
+  for (float& sample : signal)
+    sample = dist(gen);
+  // full scale and beyond must saturate
+  signal[0] = 1.0f;
+  signal[1] = -1.0f;
+  signal[2] = 2.5f;
+  signal[3] = -2.5f;
+  return signal;
+}
+
+template<typename T>
+void ExpectNear(const std::vector<T>& expected, const std::vector<T>& actual, T tolerance)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_LE(std::abs(expected[i] - actual[i]), tolerance) << "sample " << i;
+}
+} // namespace
+
+class TestAEKernels : public ::testing::TestWithParam<const AEKernels*>
+{
+protected:
+  const AEKernels& reference = *CAEKernels::GetSupported().front();
+  const AEKernels& kernels = *GetParam();
+};
+
+TEST_P(TestAEKernels, Mul)
+{
+  std::vector<float> expected = MakeSignal(SAMPLES, 1.0f);
+  std::vector<float> actual = expected;
+  reference.mul(expected.data(), 0.7f, SAMPLES);
+  kernels.mul(actual.data(), 0.7f, SAMPLES);
+  ExpectNear(expected, actual, 1e-6f);
+}
+
+TEST_P(TestAEKernels, MulAdd)
+{
+  const std::vector<float> add = MakeSignal(SAMPLES, 0.5f);
+  std::vector<float> expected(SAMPLES, 0.25f);
+  std::vector<float> actual = expected;
+
+  // the first samples of the signal are beyond full scale
+  EXPECT_TRUE(reference.mulAdd(expected.data(), add.data(), 0.5f, SAMPLES));
+  EXPECT_TRUE(kernels.mulAdd(actual.data(), add.data(), 0.5f, SAMPLES));
+  ExpectNear(expected, actual, 1e-6f);
+
+  // overshoots are found in the vector part as well as in the scalar tail
+  EXPECT_FALSE(kernels.mulAdd(actual.data() + 4, add.data() + 4, 0.1f, SAMPLES - 4));
+  actual[100] = -1.5f;
+  EXPECT_TRUE(kernels.mulAdd(actual.data() + 4, add.data() + 4, 0.0f, SAMPLES - 4));
+  actual[100] = 0.0f;
+  actual[SAMPLES - 1] = 1.5f;
+  EXPECT_TRUE(kernels.mulAdd(actual.data() + 4, add.data() + 4, 0.0f, SAMPLES - 4));
+}
+
+TEST_P(TestAEKernels, FloatToS16)
+{
+  const std::vector<float> src = MakeSignal(SAMPLES, 1.0f);
+  std::vector<int16_t> expected(SAMPLES);
+  std::vector<int16_t> actual(SAMPLES);
+  reference.floatToS16(expected.data(), src.data(), SAMPLES);
+  kernels.floatToS16(actual.data(), src.data(), SAMPLES);
+  EXPECT_EQ(32767, actual[0]);
+  EXPECT_EQ(-32768, actual[1]);
+  EXPECT_EQ(32767, actual[2]);
+  EXPECT_EQ(-32768, actual[3]);
+  ExpectNear<int16_t>(expected, actual, 1);
+
+  std::vector<float> back(SAMPLES);
+  kernels.s16ToFloat(back.data(), actual.data(), SAMPLES);
+  for (uint32_t i = 4; i < SAMPLES; ++i)
+    ASSERT_NEAR(src[i], back[i], 1.0f / 32768) << "sample " << i;
+}
+
+TEST_P(TestAEKernels, RoundsHalfToEven)
+{
+  // exact halves, in the vector part as well as in the scalar tail
+  const float halves[] = {0.5f, 1.5f, 2.5f, -0.5f, -1.5f, -2.5f, 100.5f, -101.5f};
+  std::vector<float> src(SAMPLES);
+  for (uint32_t i = 0; i < SAMPLES; ++i)
+    src[i] = halves[i % std::size(halves)] / 32768;
+  std::vector<int16_t> expected(SAMPLES);
+  std::vector<int16_t> actual(SAMPLES);
+  reference.floatToS16(expected.data(), src.data(), SAMPLES);
+  kernels.floatToS16(actual.data(), src.data(), SAMPLES);
+  EXPECT_EQ(0, actual[0]);
+  EXPECT_EQ(2, actual[1]);
+  EXPECT_EQ(2, actual[2]);
+  EXPECT_EQ(-2, actual[4]);
+  EXPECT_EQ(-102, actual[7]);
+  ExpectNear<int16_t>(expected, actual, 0);
+}
+
+TEST_P(TestAEKernels, FloatToS32)
+{
+  const std::vector<float> src = MakeSignal(SAMPLES, 1.0f);
+  std::vector<int32_t> expected(SAMPLES);
+  std::vector<int32_t> actual(SAMPLES);
+  reference.floatToS32(expected.data(), src.data(), SAMPLES);
+  kernels.floatToS32(actual.data(), src.data(), SAMPLES);
+  EXPECT_GE(actual[0], 2147483520);
+  EXPECT_EQ(INT32_MIN, actual[1]);
+  EXPECT_GE(actual[2], 2147483520);
+  EXPECT_EQ(INT32_MIN, actual[3]);
+  for (uint32_t i = 0; i < SAMPLES; ++i)
+    ASSERT_LE(std::abs(static_cast<int64_t>(expected[i]) - actual[i]), 128) << "sample " << i;
+
+  std::vector<float> back(SAMPLES);
+  kernels.s32ToFloat(back.data(), actual.data(), SAMPLES);
+  for (uint32_t i = 4; i < SAMPLES; ++i)
+    ASSERT_NEAR(src[i], back[i], 1e-6f) << "sample " << i;
+}
+
+TEST_P(TestAEKernels, DISABLED_Benchmark)
+{
+  const uint32_t count = FRAMES * CHANNELS;
+  const std::vector<float> src = MakeSignal(count, 0.5f);
+  std::vector<float> data = src;
+  std::vector<int16_t> s16(count);
+  std::vector<int32_t> s32(count);
+
+  auto measure = [](auto&& kernel)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round)
+      kernel();
+    return static_cast<int>(
+        FRAMES * ROUNDS /
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  };
+
+  const int mul = measure([&]() { kernels.mul(data.data(), 0.99f, count); });
+  const int mulAdd = measure([&]() { kernels.mulAdd(data.data(), src.data(), 0.01f, count); });
+  const int toS16 = measure([&]() { kernels.floatToS16(s16.data(), src.data(), count); });
+  const int fromS16 = measure([&]() { kernels.s16ToFloat(data.data(), s16.data(), count); });
+  const int toS32 = measure([&]() { kernels.floatToS32(s32.data(), src.data(), count); });
+  const int fromS32 = measure([&]() { kernels.s32ToFloat(data.data(), s32.data(), count); });
+
+  RecordProperty("MulFramesPerSec", mul);
+  RecordProperty("MulAddFramesPerSec", mulAdd);
+  RecordProperty("FloatToS16FramesPerSec", toS16);
+  RecordProperty("S16ToFloatFramesPerSec", fromS16);
+  RecordProperty("FloatToS32FramesPerSec", toS32);
+  RecordProperty("S32ToFloatFramesPerSec", fromS32);
+}
+
+INSTANTIATE_TEST_SUITE_P(Supported,
+                         TestAEKernels,
+                         ::testing::ValuesIn(CAEKernels::GetSupported()),
+                         [](const ::testing::TestParamInfo<const AEKernels*>& info)
+                         {
+                           std::string name = info.param->name;
+                           return name == "C++" ? std::string("Cpp") : name;
+                         });
@@ -52,6 +52,10 @@ void CDataCacheCore::Reset()
     m_contentInfo.Reset();
   }
   m_timeInfo = {};
+  {
+    std::unique_lock lock(m_fileCacheSection);
+    m_fileCacheStats = {};
+  }
 }
 
 bool CDataCacheCore::HasAVInfoChanges()
@@ -495,3 +499,30 @@ float CDataCacheCore::GetPlayPercentage()
 
   return m_timeInfo.m_time * 100 / static_cast<float>(iTotalTime);
 }
+
+void CDataCacheCore::AddFileCacheSeek(bool hit)
+{
+  std::unique_lock lock(m_fileCacheSection);
+  if (hit)
+    m_fileCacheStats.seekHits++;
+  else
+    m_fileCacheStats.seekMisses++;
+}
+
+void CDataCacheCore::AddFileCacheRefill()
+{
+  std::unique_lock lock(m_fileCacheSection);
+  m_fileCacheStats.refills++;
+}
+
+void CDataCacheCore::AddFileCacheRead(uint64_t bytes)
+{
+  std::unique_lock lock(m_fileCacheSection);
+  m_fileCacheStats.refillBytes += bytes;
+}
+
+CDataCacheCore::SFileCacheStats CDataCacheCore::GetFileCacheStats()
+{
+  std::unique_lock lock(m_fileCacheSection);
+  return m_fileCacheStats;
+}
@@ -13,6 +13,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -195,6 +196,34 @@ public:
    */
   int64_t GetMaxTime();
 
+  // file cache info
+  struct SFileCacheStats
+  {
+    uint64_t seekHits{0}; //!< seeks served from cached data
+    uint64_t seekMisses{0}; //!< seeks that discarded a cached range to refill from the source
+    uint64_t refills{0}; //!< repositionings of the source to continue filling the cache
+    uint64_t refillBytes{0}; //!< bytes read from the source
+  };
+
+  /*!
+   * \brief Account a seek on the read-ahead cache of the playing file
+   * \param hit true if the position was served from cached data
+   */
+  void AddFileCacheSeek(bool hit);
+  /*!
+   * \brief Account a repositioning of the source of the playing file's read-ahead cache
+   */
+  void AddFileCacheRefill();
+  /*!
+   * \brief Account data read from the source into the playing file's read-ahead cache
+   */
+  void AddFileCacheRead(uint64_t bytes);
+  /*!
+   * \brief Get the read-ahead cache statistics of the current playback, logged by the cache
+   * when the file is closed
+   */
+  SFileCacheStats GetFileCacheStats();
+
 protected:
   std::atomic_bool m_hasAVInfoChanges = false;
 
@@ -332,4 +361,7 @@ protected:
     int64_t m_timeMax;
     int64_t m_timeMin;
   } m_timeInfo = {};
+
+  CCriticalSection m_fileCacheSection;
+  SFileCacheStats m_fileCacheStats;
 };
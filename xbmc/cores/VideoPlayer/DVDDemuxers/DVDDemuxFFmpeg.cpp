@@ -1063,7 +1063,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               if (m_pkt.pkt.stream_index ==
                   (int)m_pFormatContext->programs[m_program]->stream_index[i])
               {
-                pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+                pPacket = CDVDDemuxUtils::AllocateDemuxPacket(&m_pkt.pkt);
                 break;
               }
             }
@@ -1072,7 +1072,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               bReturnEmpty = true;
           }
           else
-            pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+            pPacket = CDVDDemuxUtils::AllocateDemuxPacket(&m_pkt.pkt);
         }
         else
           bReturnEmpty = true;
@@ -1086,13 +1086,6 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
             m_pkt.pkt.pts = AV_NOPTS_VALUE;
           }
 
-          // copy contents into our own packet
-          pPacket->iSize = m_pkt.pkt.size;
-
-          // maybe we can avoid a memcpy here by detecting where pkt.destruct is pointing too?
-          if (m_pkt.pkt.data)
-            memcpy(pPacket->pData, m_pkt.pkt.data, pPacket->iSize);
-
           pPacket->pts =
               ConvertTimestamp(m_pkt.pkt.pts, stream->time_base.den, stream->time_base.num);
           pPacket->dts =
@@ -9,18 +9,107 @@
 #include "DVDDemuxUtils.h"
 
 #include "cores/VideoPlayer/Interface/DemuxCrypto.h"
+#include "threads/CriticalSection.h"
 #include "utils/MemUtils.h"
 #include "utils/log.h"
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 extern "C" {
 #include <libavcodec/avcodec.h>
 }
 
+namespace
+{
+// enough headers for the packets queued by the player at high bitrates
+constexpr size_t MAX_POOLED_PACKETS = 1024;
+
+class CDemuxPacketPool
+{
+public:
+  ~CDemuxPacketPool()
+  {
+    for (DemuxPacket* packet : m_free)
+      delete packet;
+  }
+
+  DemuxPacket* Get()
+  {
+    {
+      std::unique_lock lock(m_section);
+      if (!m_free.empty())
+      {
+        DemuxPacket* packet = m_free.back();
+        m_free.pop_back();
+        m_headersReused++;
+        return packet;
+      }
+    }
+    m_headersAllocated++;
+    return new DemuxPacket();
+  }
+
+  void Release(DemuxPacket* packet)
+  {
+    *packet = DemuxPacket();
+
+    std::unique_lock lock(m_section);
+    if (m_free.size() < MAX_POOLED_PACKETS)
+    {
+      m_free.push_back(packet);
+      return;
+    }
+    lock.unlock();
+    delete packet;
+  }
+
+  DemuxPacketPoolStats GetStats() const
+  {
+    DemuxPacketPoolStats stats;
+    stats.headersAllocated = m_headersAllocated;
+    stats.headersReused = m_headersReused;
+    stats.payloadsAllocated = m_payloadsAllocated;
+    stats.payloadsAdopted = m_payloadsAdopted;
+    return stats;
+  }
+
+  std::atomic<uint64_t> m_headersAllocated{0};
+  std::atomic<uint64_t> m_headersReused{0};
+  std::atomic<uint64_t> m_payloadsAllocated{0};
+  std::atomic<uint64_t> m_payloadsAdopted{0};
+
+private:
+  CCriticalSection m_section;
+  std::vector<DemuxPacket*> m_free;
+};
+
+CDemuxPacketPool& GetPacketPool()
+{
+  static CDemuxPacketPool pool;
+  return pool;
+}
+
+bool HasZeroedPadding(const AVPacket* src)
+{
+  static const uint8_t zeros[AV_INPUT_BUFFER_PADDING_SIZE] = {};
+
+  if (!src->buf || src->data < src->buf->data ||
+      src->data + src->size + AV_INPUT_BUFFER_PADDING_SIZE > src->buf->data + src->buf->size)
+    return false;
+
+  return memcmp(src->data + src->size, zeros, AV_INPUT_BUFFER_PADDING_SIZE) == 0;
+}
+} // namespace
+
 void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
 {
   if (pPacket)
   {
-    if (pPacket->pData)
+    if (pPacket->m_dataRef)
+      av_buffer_unref(&pPacket->m_dataRef);
+    else if (pPacket->pData)
       KODI::MEMORY::AlignedFree(pPacket->pData);
     if (pPacket->iSideDataElems)
     {
@@ -45,13 +134,13 @@ void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
     }
     if (pPacket->cryptoInfo)
       delete pPacket->cryptoInfo;
-    delete pPacket;
+    GetPacketPool().Release(pPacket);
   }
 }
 
 DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
 {
-  DemuxPacket* pPacket = new DemuxPacket();
+  DemuxPacket* pPacket = GetPacketPool().Get();
 
   if (iDataSize > 0)
   {
@@ -73,6 +162,7 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
 
     // reset the last 8 bytes to 0;
     memset(pPacket->pData + iDataSize, 0, AV_INPUT_BUFFER_PADDING_SIZE);
+    GetPacketPool().m_payloadsAllocated++;
   }
 
   return pPacket;
@@ -86,6 +176,32 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(unsigned int iDataSize, unsigne
   return ret;
 }
 
+DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(const AVPacket* src)
+{
+  if (src->size > 0 && HasZeroedPadding(src))
+  {
+    DemuxPacket* pPacket = GetPacketPool().Get();
+    pPacket->m_dataRef = av_buffer_ref(src->buf);
+    if (!pPacket->m_dataRef)
+    {
+      FreeDemuxPacket(pPacket);
+      return nullptr;
+    }
+    pPacket->pData = src->data;
+    pPacket->iSize = src->size;
+    GetPacketPool().m_payloadsAdopted++;
+    return pPacket;
+  }
+
+  DemuxPacket* pPacket = AllocateDemuxPacket(src->size);
+  if (pPacket && src->data && src->size > 0)
+  {
+    memcpy(pPacket->pData, src->data, src->size);
+    pPacket->iSize = src->size;
+  }
+  return pPacket;
+}
+
 void CDVDDemuxUtils::StoreSideData(DemuxPacket *pkt, AVPacket *src)
 {
   AVPacket* avPkt = av_packet_alloc();
@@ -109,3 +225,8 @@ void CDVDDemuxUtils::StoreSideData(DemuxPacket *pkt, AVPacket *src)
   av_buffer_unref(&avPkt->buf);
   av_free(avPkt);
 }
+
+DemuxPacketPoolStats CDVDDemuxUtils::GetPoolStats()
+{
+  return GetPacketPool().GetStats();
+}
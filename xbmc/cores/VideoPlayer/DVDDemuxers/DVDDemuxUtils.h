@@ -9,16 +9,42 @@
 #pragma once
 
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
+
+#include <cstdint>
+
 extern "C" {
 #include <libavcodec/avcodec.h>
 }
 
+struct DemuxPacketPoolStats
+{
+  uint64_t headersAllocated{0}; //!< packet headers allocated from the heap
+  uint64_t headersReused{0}; //!< packet headers taken from the pool
+  uint64_t payloadsAllocated{0}; //!< payloads allocated and filled by a copy
+  uint64_t payloadsAdopted{0}; //!< payloads referenced from ffmpeg without a copy
+};
+
 class CDVDDemuxUtils
 {
 public:
   static void FreeDemuxPacket(DemuxPacket* pPacket);
   static DemuxPacket* AllocateDemuxPacket(int iDataSize = 0);
   static DemuxPacket* AllocateDemuxPacket(unsigned int iDataSize, unsigned int encryptedSubsampleCount);
+
+  /*!
+   * \brief Create a packet holding the payload of an ffmpeg packet.
+   * The payload buffer is referenced instead of copied if it is reference counted and padded,
+   * the data of such a packet is shared with ffmpeg and must not be modified.
+   * \param src the packet to take the payload from, side data and timestamps are not copied
+   * \return the packet or nullptr on allocation failure
+   */
+  static DemuxPacket* AllocateDemuxPacket(const AVPacket* src);
+
   static void StoreSideData(DemuxPacket *pkt, AVPacket *src);
+
+  /*!
+   * \brief Get the allocation counters of the demux packet pool.
+   */
+  static DemuxPacketPoolStats GetPoolStats();
 };
 
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// roughly one second of a 80 Mbps stream in 64 KiB packets
+constexpr int PACKETS = 160;
+constexpr int PACKET_SIZE = 64 * 1024;
+constexpr int ROUNDS = 50;
+} // namespace
+
+TEST(TestDemuxPacketPool, RecyclesHeaders)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(128);
+  ASSERT_NE(nullptr, packet);
+  packet->iStreamId = 3;
+  packet->pts = 1000.0;
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+  const DemuxPacketPoolStats before = CDVDDemuxUtils::GetPoolStats();
+  packet = CDVDDemuxUtils::AllocateDemuxPacket(0);
+  ASSERT_NE(nullptr, packet);
+  const DemuxPacketPoolStats after = CDVDDemuxUtils::GetPoolStats();
+
+  EXPECT_EQ(before.headersReused + 1, after.headersReused);
+  EXPECT_EQ(before.headersAllocated, after.headersAllocated);
+
+  // a recycled header is indistinguishable from a new one
+  EXPECT_EQ(nullptr, packet->pData);
+  EXPECT_EQ(0, packet->iSize);
+  EXPECT_EQ(-1, packet->iStreamId);
+  EXPECT_EQ(DVD_NOPTS_VALUE, packet->pts);
+  EXPECT_EQ(nullptr, packet->m_dataRef);
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+}
+
+TEST(TestDemuxPacketPool, AdoptsRefCountedPayload)
+{
+  AVPacket* src = av_packet_alloc();
+  ASSERT_NE(nullptr, src);
+  ASSERT_EQ(0, av_new_packet(src, 1000));
+  memset(src->data, 0x42, src->size);
+
+  const DemuxPacketPoolStats before = CDVDDemuxUtils::GetPoolStats();
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(src);
+  ASSERT_NE(nullptr, packet);
+  EXPECT_EQ(before.payloadsAdopted + 1, CDVDDemuxUtils::GetPoolStats().payloadsAdopted);
+  EXPECT_EQ(src->data, packet->pData);
+  EXPECT_EQ(1000, packet->iSize);
+
+  // the payload outlives the ffmpeg packet
+  av_packet_free(&src);
+  EXPECT_EQ(0x42, packet->pData[999]);
+  EXPECT_EQ(0, packet->pData[1000]);
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+}
+
+TEST(TestDemuxPacketPool, CopiesUnownedPayload)
+{
+  uint8_t data[16] = {1, 2, 3, 4};
+  AVPacket* src = av_packet_alloc();
+  ASSERT_NE(nullptr, src);
+  src->data = data;
+  src->size = sizeof(data);
+
+  const DemuxPacketPoolStats before = CDVDDemuxUtils::GetPoolStats();
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(src);
+  ASSERT_NE(nullptr, packet);
+  EXPECT_EQ(before.payloadsAllocated + 1, CDVDDemuxUtils::GetPoolStats().payloadsAllocated);
+  EXPECT_NE(data, packet->pData);
+  EXPECT_EQ(nullptr, packet->m_dataRef);
+  EXPECT_EQ(0, memcmp(data, packet->pData, sizeof(data)));
+  EXPECT_EQ(0, packet->pData[sizeof(data)]);
+
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+  src->data = nullptr;
+  src->size = 0;
+  av_packet_free(&src);
+}
+
+TEST(TestDemuxPacketPool, DISABLED_CopyVersusZeroCopy)
+{
+  AVPacket* src = av_packet_alloc();
+  ASSERT_NE(nullptr, src);
+  std::vector<DemuxPacket*> queue(PACKETS);
+
+  // queue a second worth of packets the way the demuxer thread does, then drain it
+  auto measure = [&](auto&& allocate)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+      for (DemuxPacket*& packet : queue)
+      {
+        av_new_packet(src, PACKET_SIZE);
+        packet = allocate(src);
+        av_packet_unref(src);
+      }
+      for (DemuxPacket* packet : queue)
+        CDVDDemuxUtils::FreeDemuxPacket(packet);
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  };
+
+  const auto copyUs = measure(
+      [](const AVPacket* pkt)
+      {
+        DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(pkt->size);
+        memcpy(packet->pData, pkt->data, pkt->size);
+        packet->iSize = pkt->size;
+        return packet;
+      });
+  const auto adoptUs =
+      measure([](const AVPacket* pkt) { return CDVDDemuxUtils::AllocateDemuxPacket(pkt); });
+  av_packet_free(&src);
+
+  RecordProperty("CopyUs", static_cast<int>(copyUs));
+  RecordProperty("ZeroCopyUs", static_cast<int>(adoptUs));
+}
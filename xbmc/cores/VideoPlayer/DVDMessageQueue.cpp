@@ -12,6 +12,7 @@
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <math.h>
 #include <mutex>
 
@@ -36,6 +37,12 @@ CDVDMessageQueue::~CDVDMessageQueue()
 
 void CDVDMessageQueue::Init()
 {
+  std::unique_lock lock(m_section);
+
+  FlushRing();
+  m_producer = std::thread::id();
+  m_consumer = std::thread::id();
+
   m_iDataSize = 0;
   m_bAbortRequest = false;
   m_bInitialized = true;
@@ -56,11 +63,16 @@ void CDVDMessageQueue::Flush(CDVDMsg::Message type)
     return type == CDVDMsg::NONE || item.message->IsType(type);
   });
 
+  m_listSize = m_messages.size() + m_prioMessages.size();
+
   if (type == CDVDMsg::DEMUXER_PACKET ||  type == CDVDMsg::NONE)
   {
     m_iDataSize = 0;
     m_TimeBack = DVD_NOPTS_VALUE;
     m_TimeFront = DVD_NOPTS_VALUE;
+
+    // the ring only holds demuxer packets
+    FlushRing();
   }
 }
 
@@ -78,7 +90,10 @@ void CDVDMessageQueue::End()
 {
   std::unique_lock lock(m_section);
 
+  // packets left in the ring are released by the next consumer, or when the queue is destroyed
   Flush(CDVDMsg::NONE);
+  m_producer = std::thread::id();
+  m_consumer = std::thread::id();
 
   m_bInitialized = false;
   m_iDataSize = 0;
@@ -99,6 +114,10 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
                                          int priority,
                                          bool front)
 {
+  if (pMsg && priority == 0 && front && pMsg->IsType(CDVDMsg::DEMUXER_PACKET) &&
+      m_bInitialized && IsProducer() && PutRing(pMsg))
+    return MSGQ_OK;
+
   std::unique_lock lock(m_section);
 
   if (!m_bInitialized)
@@ -129,15 +148,19 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     if (m_messages.empty())
     {
       m_iDataSize = 0;
-      m_TimeBack = DVD_NOPTS_VALUE;
-      m_TimeFront = DVD_NOPTS_VALUE;
+      if (m_ringHead == m_ringTail)
+      {
+        m_TimeBack = DVD_NOPTS_VALUE;
+        m_TimeFront = DVD_NOPTS_VALUE;
+      }
     }
 
     if (front)
-      m_messages.emplace_front(pMsg, priority);
+      m_messages.emplace_front(pMsg, priority, m_sequence++);
     else
       m_messages.emplace_back(pMsg, priority);
   }
+  m_listSize++;
 
   if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET) && priority == 0)
   {
@@ -146,9 +169,9 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     {
       m_iDataSize += packet->iSize;
       if (front)
-        UpdateTimeFront();
+        UpdateTimeFront(&m_messages.front());
       else
-        UpdateTimeBack();
+        UpdateTimeBack(&m_messages.back());
     }
   }
 
@@ -162,8 +185,6 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
                                          std::chrono::milliseconds timeout,
                                          int& priority)
 {
-  std::unique_lock lock(m_section);
-
   int ret = 0;
 
   if (!m_bInitialized)
@@ -172,11 +193,38 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
     return MSGQ_NOT_INITIALIZED;
   }
 
+  std::thread::id consumer;
+  m_consumer.compare_exchange_strong(consumer, std::this_thread::get_id());
+  const bool isConsumer = IsConsumer();
+
   while (!m_bAbortRequest)
   {
+    // drops packets flushed by the producer
+    DVDMessageListItem* ringItem = isConsumer ? PeekRing() : nullptr;
+
+    // nothing but demuxer packets queued, no need to lock
+    if (ringItem && priority == 0 && m_listSize == 0)
+    {
+      PopRing(pMsg);
+      UpdateTimeBack(PeekRing());
+      ret = MSGQ_OK;
+      break;
+    }
+
+    std::unique_lock lock(m_section);
+
     std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
 
-    if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
+    if (ringItem && &msgs == &m_messages &&
+        (msgs.empty() || ringItem->sequence < msgs.back().sequence))
+    {
+      PopRing(pMsg);
+      priority = 0;
+      UpdateTimeBack(NextItem(isConsumer));
+      ret = MSGQ_OK;
+      break;
+    }
+    else if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
     {
       DVDMessageListItem& item(msgs.back());
       priority = item.priority;
@@ -193,7 +241,8 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
       pMsg = std::move(item.message);
       msgs.pop_back();
-      UpdateTimeBack();
+      m_listSize--;
+      UpdateTimeBack(NextItem(isConsumer));
       ret = MSGQ_OK;
       break;
     }
@@ -205,13 +254,22 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
     else
     {
       m_hEvent.Reset();
+
+      // the ring producer only signals when asked to, check for a packet put in the meantime
+      m_waiting = true;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (isConsumer && priority == 0 && PeekRing())
+      {
+        m_waiting = false;
+        continue;
+      }
       lock.unlock();
 
       // wait for a new message
-      if (!m_hEvent.Wait(timeout))
+      const bool signaled = m_hEvent.Wait(timeout);
+      m_waiting = false;
+      if (!signaled)
         return MSGQ_TIMEOUT;
-
-      lock.lock();
     }
   }
 
@@ -221,52 +279,187 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
   return (MsgQueueReturnCode)ret;
 }
 
-void CDVDMessageQueue::UpdateTimeFront()
+void CDVDMessageQueue::UpdateTimeFront(const DVDMessageListItem* item)
 {
-  if (!m_messages.empty())
+  if (item && item->message->IsType(CDVDMsg::DEMUXER_PACKET))
   {
-    auto &item = m_messages.front();
-    if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
+    DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(item->message.get())->GetPacket();
+    if (packet)
     {
-      DemuxPacket* packet =
-          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
-      if (packet)
-      {
-        if (packet->dts != DVD_NOPTS_VALUE)
-          m_TimeFront = packet->dts;
-        else if (packet->pts != DVD_NOPTS_VALUE)
-          m_TimeFront = packet->pts;
+      if (packet->dts != DVD_NOPTS_VALUE)
+        m_TimeFront = packet->dts;
+      else if (packet->pts != DVD_NOPTS_VALUE)
+        m_TimeFront = packet->pts;
 
-        if (m_TimeBack == DVD_NOPTS_VALUE)
-          m_TimeBack = m_TimeFront;
-      }
+      if (m_TimeBack == DVD_NOPTS_VALUE)
+        m_TimeBack = m_TimeFront.load();
     }
   }
 }
 
-void CDVDMessageQueue::UpdateTimeBack()
+void CDVDMessageQueue::UpdateTimeBack(const DVDMessageListItem* item)
 {
-  if (!m_messages.empty())
+  if (item && item->message->IsType(CDVDMsg::DEMUXER_PACKET))
   {
-    auto &item = m_messages.back();
-    if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
+    DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(item->message.get())->GetPacket();
+    if (packet)
     {
-      DemuxPacket* packet =
-          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
-      if (packet)
-      {
-        if (packet->dts != DVD_NOPTS_VALUE)
-          m_TimeBack = packet->dts;
-        else if (packet->pts != DVD_NOPTS_VALUE)
-          m_TimeBack = packet->pts;
+      if (packet->dts != DVD_NOPTS_VALUE)
+        m_TimeBack = packet->dts;
+      else if (packet->pts != DVD_NOPTS_VALUE)
+        m_TimeBack = packet->pts;
 
-        if (m_TimeFront == DVD_NOPTS_VALUE)
-          m_TimeFront = m_TimeBack;
-      }
+      if (m_TimeFront == DVD_NOPTS_VALUE)
+        m_TimeFront = m_TimeBack.load();
     }
   }
 }
 
+const DVDMessageListItem* CDVDMessageQueue::NextItem(bool isConsumer)
+{
+  const DVDMessageListItem* ringItem = isConsumer ? PeekRing() : nullptr;
+  if (!m_messages.empty() && (!ringItem || m_messages.back().sequence < ringItem->sequence))
+    return &m_messages.back();
+  return ringItem;
+}
+
+bool CDVDMessageQueue::IsProducer()
+{
+  const std::thread::id self = std::this_thread::get_id();
+  std::thread::id producer;
+  if (m_producer.compare_exchange_strong(producer, self))
+    return true;
+  return producer == self;
+}
+
+bool CDVDMessageQueue::IsConsumer() const
+{
+  return m_consumer.load() == std::this_thread::get_id();
+}
+
+bool CDVDMessageQueue::PutRing(const std::shared_ptr<CDVDMsg>& pMsg)
+{
+  const size_t tail = m_ringTail.load(std::memory_order_relaxed);
+  const size_t head = m_ringHead.load(std::memory_order_acquire);
+  if (tail - head >= RING_SIZE)
+    return false;
+
+  if (tail == head && m_listSize == 0)
+  {
+    m_TimeBack = DVD_NOPTS_VALUE;
+    m_TimeFront = DVD_NOPTS_VALUE;
+  }
+
+  DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(pMsg.get())->GetPacket();
+
+  DVDMessageListItem& item = m_ring[tail % RING_SIZE];
+  item.message = pMsg;
+  item.priority = 0;
+
+  // the sequence and the totals change together, an odd version marks them as being written.
+  // Pairs with the snapshot taken by FlushRing
+  m_ringPutVersion.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  item.sequence = m_sequence++;
+  m_ringPutSize += packet ? packet->iSize : 0;
+  m_ringPutPackets++;
+  m_ringPutVersion.fetch_add(1, std::memory_order_release);
+
+  UpdateTimeFront(&item);
+
+  // publish the packet before looking for a waiting consumer, pairs with Get
+  m_ringTail.store(tail + 1);
+  if (m_waiting.exchange(false))
+    m_hEvent.Set();
+
+  return true;
+}
+
+DVDMessageListItem* CDVDMessageQueue::PeekRing()
+{
+  size_t head = m_ringHead.load(std::memory_order_relaxed);
+  while (head != m_ringTail.load(std::memory_order_acquire))
+  {
+    DVDMessageListItem& item = m_ring[head % RING_SIZE];
+    if (item.sequence >= m_ringFlushSequence.load(std::memory_order_acquire))
+      return &item;
+
+    std::shared_ptr<CDVDMsg> flushed;
+    PopRing(flushed);
+    head++;
+  }
+  return nullptr;
+}
+
+void CDVDMessageQueue::PopRing(std::shared_ptr<CDVDMsg>& pMsg)
+{
+  const size_t head = m_ringHead.load(std::memory_order_relaxed);
+  DVDMessageListItem& item = m_ring[head % RING_SIZE];
+
+  DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(item.message.get())->GetPacket();
+  m_ringTakenSize += packet ? packet->iSize : 0;
+  m_ringTakenPackets++;
+
+  pMsg = std::move(item.message);
+  item.message.reset();
+  m_ringHead.store(head + 1, std::memory_order_release);
+}
+
+void CDVDMessageQueue::FlushRing()
+{
+  if (IsConsumer())
+  {
+    DrainRing();
+    return;
+  }
+
+  // take the sequence and the totals of one point in time, so the flushed totals cover exactly
+  // the packets the consumer drops. Other puts are serialized by m_section, held by the caller.
+  uint64_t version;
+  uint64_t size;
+  uint64_t packets;
+  uint64_t sequence;
+  while (true)
+  {
+    version = m_ringPutVersion.load(std::memory_order_acquire);
+    sequence = m_sequence.load(std::memory_order_relaxed);
+    size = m_ringPutSize.load(std::memory_order_relaxed);
+    packets = m_ringPutPackets.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!(version & 1) && version == m_ringPutVersion.load(std::memory_order_relaxed))
+      break;
+    std::this_thread::yield();
+  }
+
+  m_ringFlushedSize = size;
+  m_ringFlushedPackets = packets;
+  m_ringFlushSequence = sequence;
+}
+
+// consumer only
+void CDVDMessageQueue::DrainRing()
+{
+  std::shared_ptr<CDVDMsg> msg;
+  while (m_ringHead.load(std::memory_order_relaxed) != m_ringTail.load(std::memory_order_acquire))
+    PopRing(msg);
+}
+
+int CDVDMessageQueue::GetRingDataSize() const
+{
+  // the totals only grow and packets are taken in order, so whatever was put before the last
+  // flush is gone once taken or flushed. Put is read last, it's never less than the others.
+  const uint64_t taken = m_ringTakenSize;
+  const uint64_t flushed = m_ringFlushedSize;
+  return static_cast<int>(m_ringPutSize - std::max(taken, flushed));
+}
+
+unsigned CDVDMessageQueue::GetRingPacketCount() const
+{
+  const uint64_t taken = m_ringTakenPackets;
+  const uint64_t flushed = m_ringFlushedPackets;
+  return static_cast<unsigned>(m_ringPutPackets - std::max(taken, flushed));
+}
+
 unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
 {
   std::unique_lock lock(m_section);
@@ -274,7 +467,11 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
   if (!m_bInitialized)
     return 0;
 
-  unsigned count = 0;
+  // drop the packets flushed by the producer before counting
+  if (IsConsumer())
+    PeekRing();
+
+  unsigned count = type == CDVDMsg::DEMUXER_PACKET ? GetRingPacketCount() : 0;
   for (const auto &item : m_messages)
   {
     if(item.message->IsType(type))
@@ -311,20 +508,21 @@ int CDVDMessageQueue::GetLevel() const
 {
   std::unique_lock lock(m_section);
 
-  if (m_iDataSize > m_iMaxDataSize)
+  const int dataSize = GetDataSize();
+  if (dataSize > m_iMaxDataSize)
     return 100;
-  if (m_iDataSize == 0)
+  if (dataSize == 0)
     return 0;
 
   if (IsDataBased())
   {
-    return std::min(100, 100 * m_iDataSize / m_iMaxDataSize);
+    return std::min(100, 100 * dataSize / m_iMaxDataSize);
   }
 
   int level = std::min(100.0, ceil(100.0 * m_TimeSize * (m_TimeFront - m_TimeBack) / DVD_TIME_BASE ));
 
   // if we added lots of packets with NOPTS, make sure that the queue is not signalled empty
-  if (level == 0 && m_iDataSize != 0)
+  if (level == 0 && dataSize != 0)
   {
     CLog::Log(LOGDEBUG, "CDVDMessageQueue::GetLevel() - can't determine level");
     return 1;
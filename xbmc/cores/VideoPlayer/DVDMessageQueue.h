@@ -13,13 +13,18 @@
 #include "threads/Event.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <list>
 #include <string>
+#include <thread>
 
 struct DVDMessageListItem
 {
-  DVDMessageListItem(std::shared_ptr<CDVDMsg> msg, int prio) : message(std::move(msg))
+  DVDMessageListItem(std::shared_ptr<CDVDMsg> msg, int prio, uint64_t seq = 0)
+    : message(std::move(msg)),
+      sequence(seq)
   {
     priority = prio;
   }
@@ -31,6 +36,7 @@ struct DVDMessageListItem
 
   std::shared_ptr<CDVDMsg> message;
   int priority;
+  uint64_t sequence{0}; //!< order of normal messages put to the front, 0 for PutBack
 };
 
 enum MsgQueueReturnCode
@@ -73,7 +79,7 @@ public:
     return Get(pMsg, timeout, priority);
   }
 
-  int GetDataSize() const { return m_iDataSize; }
+  int GetDataSize() const { return m_iDataSize + GetRingDataSize(); }
   double GetTimeSize() const;
   unsigned GetPacketCount(CDVDMsg::Message type);
   bool ReceivedAbortRequest() { return m_bAbortRequest; }
@@ -92,19 +98,39 @@ public:
 
 private:
   MsgQueueReturnCode Put(const std::shared_ptr<CDVDMsg>& pMsg, int priority, bool front);
-  void UpdateTimeFront();
-  void UpdateTimeBack();
+  void UpdateTimeFront(const DVDMessageListItem* item);
+  void UpdateTimeBack(const DVDMessageListItem* item);
+  const DVDMessageListItem* NextItem(bool isConsumer);
+
+  /*!
+   * \brief Demuxer packets put by the producer thread bypass m_section and are passed through a
+   * single producer, single consumer ring. All other messages take the locked lists, the sequence
+   * numbers keep the order between both paths. Only the consumer takes packets from the ring, a
+   * flush from any other thread only marks the packets in it, they are dropped by the consumer.
+   * The fill level counts them as gone right away, see GetRingDataSize.
+   */
+  static constexpr size_t RING_SIZE = 1024;
+
+  bool IsProducer();
+  bool IsConsumer() const;
+  bool PutRing(const std::shared_ptr<CDVDMsg>& pMsg);
+  DVDMessageListItem* PeekRing();
+  void PopRing(std::shared_ptr<CDVDMsg>& pMsg);
+  void FlushRing();
+  void DrainRing();
+  int GetRingDataSize() const;
+  unsigned GetRingPacketCount() const;
 
   CEvent m_hEvent;
   mutable CCriticalSection m_section;
 
   std::atomic<bool> m_bAbortRequest = false;
-  bool m_bInitialized;
+  std::atomic<bool> m_bInitialized;
   bool m_drain = false;
 
   int m_iDataSize;
-  double m_TimeFront;
-  double m_TimeBack;
+  std::atomic<double> m_TimeFront;
+  std::atomic<double> m_TimeBack;
   double m_TimeSize;
 
   int m_iMaxDataSize;
@@ -112,5 +138,25 @@ private:
 
   std::list<DVDMessageListItem> m_messages;
   std::list<DVDMessageListItem> m_prioMessages;
+  std::atomic<size_t> m_listSize{0};
+
+  std::array<DVDMessageListItem, RING_SIZE> m_ring;
+  alignas(64) std::atomic<size_t> m_ringHead{0};
+  alignas(64) std::atomic<size_t> m_ringTail{0};
+  std::atomic<uint64_t> m_sequence{1};
+  std::atomic<uint64_t> m_ringFlushSequence{0};
+  // totals of the packets put to and taken from the ring, and of the ones put before the last
+  // flush. They only grow, the ring holds the difference, see GetRingDataSize. The version is odd
+  // while the producer updates the put totals, see FlushRing.
+  std::atomic<uint64_t> m_ringPutVersion{0};
+  std::atomic<uint64_t> m_ringPutSize{0};
+  std::atomic<uint64_t> m_ringPutPackets{0};
+  std::atomic<uint64_t> m_ringTakenSize{0};
+  std::atomic<uint64_t> m_ringTakenPackets{0};
+  std::atomic<uint64_t> m_ringFlushedSize{0};
+  std::atomic<uint64_t> m_ringFlushedPackets{0};
+  std::atomic<bool> m_waiting{false};
+  std::atomic<std::thread::id> m_producer;
+  std::atomic<std::thread::id> m_consumer;
 };
 
@@ -19,6 +19,8 @@ extern "C"
 {
 #endif /* __cplusplus */
 
+  struct AVBufferRef;
+
   struct DemuxPacket : DEMUX_PACKET
   {
     DemuxPacket()
@@ -43,6 +45,9 @@ extern "C"
 
     //! @brief PTS offset correction applied to the PTS and DTS.
     double m_ptsOffsetCorrection{0};
+
+    //! @brief Reference to the ffmpeg buffer owning pData if the payload wasn't copied.
+    AVBufferRef* m_dataRef{nullptr};
   };
 
 #ifdef __cplusplus
@@ -3536,6 +3536,11 @@ void CVideoPlayer::GetGeneralInfo(std::string& strGeneralInfo)
                                     m_State.cache_offset * 100.0);
     }
 
+    const DemuxPacketPoolStats packets = CDVDDemuxUtils::GetPoolStats();
+    strBuf += StringUtils::Format(", pkt: {} new / {} reused, data: {} copied / {} zero-copy",
+                                  packets.headersAllocated, packets.headersReused,
+                                  packets.payloadsAllocated, packets.payloadsAdopted);
+
     strGeneralInfo = StringUtils::Format("Player: a/v:{: 6.3f}, {}", dDiff, strBuf);
   }
 }
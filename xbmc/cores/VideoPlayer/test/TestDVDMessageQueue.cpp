@@ -0,0 +1,258 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr int MESSAGES = 200000;
+constexpr int WAKEUPS = 2000;
+
+std::shared_ptr<CDVDMsg> MakePacket(int size, double dts = DVD_NOPTS_VALUE)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(0);
+  packet->iSize = size;
+  packet->dts = dts;
+  return std::make_shared<CDVDMsgDemuxerPacket>(packet);
+}
+
+int PacketSize(const std::shared_ptr<CDVDMsg>& msg)
+{
+  if (!msg->IsType(CDVDMsg::DEMUXER_PACKET))
+    return -1;
+  return std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket()->iSize;
+}
+} // namespace
+
+class TestDVDMessageQueue : public ::testing::Test
+{
+protected:
+  TestDVDMessageQueue() { queue.Init(); }
+  ~TestDVDMessageQueue() override { queue.End(); }
+
+  CDVDMessageQueue queue{"test"};
+};
+
+TEST_F(TestDVDMessageQueue, KeepsOrderOfPacketsAndMessages)
+{
+  queue.Put(MakePacket(1));
+  queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC));
+  queue.Put(MakePacket(2));
+  queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::PLAYER_SETSPEED), 1);
+  EXPECT_EQ(3, queue.GetDataSize());
+  EXPECT_EQ(2u, queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+
+  std::shared_ptr<CDVDMsg> msg;
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::PLAYER_SETSPEED));
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms));
+  EXPECT_EQ(1, PacketSize(msg));
+
+  // a message put back is the next one to get
+  queue.PutBack(msg);
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms));
+  EXPECT_EQ(1, PacketSize(msg));
+
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESYNC));
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms));
+  EXPECT_EQ(2, PacketSize(msg));
+  EXPECT_EQ(MSGQ_TIMEOUT, queue.Get(msg, 0ms));
+  EXPECT_EQ(0, queue.GetDataSize());
+}
+
+TEST_F(TestDVDMessageQueue, FlushFromProducerKeepsMessages)
+{
+  std::thread producer(
+      [this]()
+      {
+        queue.Put(MakePacket(10, 1000.0));
+        queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC));
+        queue.Put(MakePacket(20, 2000.0));
+        EXPECT_EQ(30, queue.GetDataSize());
+
+        // the packets still in the ring don't count once flushed
+        queue.Flush();
+        EXPECT_EQ(0, queue.GetDataSize());
+        EXPECT_EQ(0, queue.GetLevel());
+        EXPECT_EQ(0u, queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+        queue.Put(MakePacket(30, 3000.0));
+        EXPECT_EQ(30, queue.GetDataSize());
+      });
+  producer.join();
+
+  std::shared_ptr<CDVDMsg> msg;
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESYNC));
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms));
+  EXPECT_EQ(30, PacketSize(msg));
+  EXPECT_EQ(MSGQ_TIMEOUT, queue.Get(msg, 0ms));
+  EXPECT_EQ(0, queue.GetDataSize());
+}
+
+TEST_F(TestDVDMessageQueue, FlushWhileProducing)
+{
+  std::atomic<bool> done{false};
+  std::thread producer(
+      [this, &done]()
+      {
+        for (int i = 0; i < MESSAGES / 10; ++i)
+        {
+          if (queue.Put(MakePacket(1)) != MSGQ_OK)
+            break;
+        }
+        done = true;
+      });
+
+  while (!done)
+    queue.Flush();
+  producer.join();
+
+  // every flush took the size and count totals of the same packets
+  EXPECT_EQ(static_cast<unsigned>(queue.GetDataSize()),
+            queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+  queue.Flush();
+  EXPECT_EQ(0, queue.GetDataSize());
+  EXPECT_EQ(0u, queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+
+  std::shared_ptr<CDVDMsg> msg;
+  EXPECT_EQ(MSGQ_TIMEOUT, queue.Get(msg, 0ms));
+}
+
+TEST_F(TestDVDMessageQueue, EndLeavesRingToNextConsumer)
+{
+  std::thread producer([this]() { queue.Put(MakePacket(10)); });
+  producer.join();
+  queue.End();
+  queue.Init();
+  EXPECT_EQ(0, queue.GetDataSize());
+
+  queue.Put(MakePacket(20));
+  std::shared_ptr<CDVDMsg> msg;
+  ASSERT_EQ(MSGQ_OK, queue.Get(msg, 0ms));
+  EXPECT_EQ(20, PacketSize(msg));
+  EXPECT_EQ(MSGQ_TIMEOUT, queue.Get(msg, 0ms));
+}
+
+TEST_F(TestDVDMessageQueue, AbortWakesConsumer)
+{
+  std::thread consumer(
+      [this]()
+      {
+        std::shared_ptr<CDVDMsg> msg;
+        EXPECT_EQ(MSGQ_ABORT, queue.Get(msg, 10s));
+      });
+  std::this_thread::sleep_for(10ms);
+  queue.Abort();
+  consumer.join();
+}
+
+TEST_F(TestDVDMessageQueue, DISABLED_Throughput)
+{
+  auto measure = [this](bool ring)
+  {
+    queue.End();
+    queue.Init();
+    const int messages = ring ? MESSAGES : MESSAGES + 1;
+
+    // packets from any thread but the first producer take the locked path
+    if (!ring)
+      queue.Put(MakePacket(0));
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread consumer(
+        [this, messages]()
+        {
+          std::shared_ptr<CDVDMsg> msg;
+          for (int i = 0; i < messages; ++i)
+            queue.Get(msg, 1000ms);
+        });
+    std::thread producer(
+        [this]()
+        {
+          for (int i = 0; i < MESSAGES; ++i)
+          {
+            // keep the queue from growing without bounds like the player does
+            while (queue.GetDataSize() > 512)
+              std::this_thread::yield();
+            queue.Put(MakePacket(1));
+          }
+        });
+    producer.join();
+    consumer.join();
+    return static_cast<double>(MESSAGES) /
+           std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  const double locked = measure(false);
+  const double ring = measure(true);
+
+  RecordProperty("LockedMsgPerSec", static_cast<int>(locked));
+  RecordProperty("RingMsgPerSec", static_cast<int>(ring));
+}
+
+TEST_F(TestDVDMessageQueue, DISABLED_WakeupLatency)
+{
+  auto measure = [this](bool ring)
+  {
+    queue.End();
+    queue.Init();
+    // packets from any thread but the first producer take the locked path
+    if (!ring)
+      queue.Put(MakePacket(0));
+
+    std::chrono::steady_clock::time_point sent;
+    std::atomic<bool> ready{false};
+    std::chrono::nanoseconds total{0};
+
+    std::thread consumer(
+        [&]()
+        {
+          std::shared_ptr<CDVDMsg> msg;
+          if (!ring)
+            queue.Get(msg, 0ms);
+          for (int i = 0; i < WAKEUPS; ++i)
+          {
+            ready = true;
+            queue.Get(msg, 1000ms);
+            total += std::chrono::steady_clock::now() - sent;
+          }
+        });
+    std::thread producer(
+        [&]()
+        {
+          for (int i = 0; i < WAKEUPS; ++i)
+          {
+            while (!ready.exchange(false))
+              std::this_thread::yield();
+            // give the consumer time to block
+            std::this_thread::sleep_for(50us);
+            sent = std::chrono::steady_clock::now();
+            queue.Put(MakePacket(1));
+          }
+        });
+    producer.join();
+    consumer.join();
+    return std::chrono::duration_cast<std::chrono::microseconds>(total).count() / WAKEUPS;
+  };
+
+  const auto locked = measure(false);
+  const auto ring = measure(true);
+
+  RecordProperty("LockedWakeupUs", static_cast<int>(locked));
+  RecordProperty("RingWakeupUs", static_cast<int>(ring));
+}
@@ -21,6 +21,7 @@
 #include "sqlitedataset.h"
 #include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
+#include "utils/Variant.h"
 #include "utils/log.h"
 
 #ifdef TARGET_POSIX
@@ -411,6 +412,110 @@ bool CDatabase::ExecuteQuery(const std::string& strQuery)
   return bReturn;
 }
 
+bool CDatabase::ExecuteStatement(const std::string& strStatement,
+                                 const std::vector<CVariant>& params)
+{
+  if (nullptr == m_pDB)
+    return false;
+
+  if (m_multipleExecute)
+    return ExecuteQuery(SubstituteParameters(strStatement, params));
+
+  // statements compiled on a connection that has since been dropped are unusable
+  if (m_statementsGeneration != m_pDB->get_connection_generation())
+  {
+    m_statements.clear();
+    m_statementsGeneration = m_pDB->get_connection_generation();
+  }
+
+  for (int attempt = 0;; ++attempt)
+  {
+    Statement* stmt = GetStatement(strStatement);
+    if (!stmt)
+      return ExecuteQuery(SubstituteParameters(strStatement, params));
+
+    const unsigned int generation = m_pDB->get_connection_generation();
+    try
+    {
+      stmt->reset();
+      for (int i = 0; i < static_cast<int>(params.size()); ++i)
+      {
+        const CVariant& param = params[i];
+        if (param.isNull())
+          stmt->bind_null(i);
+        else if (param.isInteger() || param.isUnsignedInteger() || param.isBoolean())
+          stmt->bind_int64(i, param.asInteger());
+        else if (param.isDouble())
+          stmt->bind_double(i, param.asDouble());
+        else
+          stmt->bind_text(i, param.asString());
+      }
+      stmt->execute();
+      return true;
+    }
+    catch (...)
+    {
+      // the server went away and the backend reconnected: prepare the statement again, once
+      if (attempt == 0 && generation != m_pDB->get_connection_generation())
+      {
+        m_statements.clear();
+        m_statementsGeneration = m_pDB->get_connection_generation();
+        continue;
+      }
+      CLog::LogF(LOGERROR, "Failed to execute statement '{}'", strStatement);
+    }
+    return false;
+  }
+}
+
+Statement* CDatabase::GetStatement(const std::string& strStatement)
+{
+  auto it = m_statements.find(strStatement);
+  if (it == m_statements.end())
+  {
+    std::unique_ptr<Statement> stmt;
+    try
+    {
+      stmt = m_pDB->prepare_statement(strStatement);
+    }
+    catch (...)
+    {
+      CLog::LogF(LOGWARNING, "Failed to prepare statement '{}'", strStatement);
+    }
+    // remember unsupported statements as well, so we don't try to compile them again
+    it = m_statements.try_emplace(strStatement, std::move(stmt)).first;
+  }
+  return it->second.get();
+}
+
+std::string CDatabase::SubstituteParameters(const std::string& strStatement,
+                                            const std::vector<CVariant>& params) const
+{
+  std::string result;
+  result.reserve(strStatement.size() + params.size() * 16);
+
+  size_t param = 0;
+  for (const char c : strStatement)
+  {
+    if (c != '?' || param >= params.size())
+    {
+      result += c;
+      continue;
+    }
+
+    const CVariant& value = params[param++];
+    if (value.isNull())
+      result += "NULL";
+    else if (value.isInteger() || value.isUnsignedInteger() || value.isBoolean())
+      result += std::to_string(value.asInteger());
+    else if (value.isDouble())
+      result += PrepareSQL("%f", value.asDouble());
+    else
+      result += PrepareSQL("'%s'", value.asString().c_str());
+  }
+  return result;
+}
+
 bool CDatabase::ResultQuery(const std::string& strQuery) const
 {
   bool bReturn = false;
@@ -592,6 +697,8 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
                                               const DatabaseSettings& dbSettings,
                                               bool create)
 {
+  m_statements.clear();
+
   // create the appropriate database structure
   if (dbSettings.type == "sqlite3")
   {
@@ -707,6 +814,9 @@ void CDatabase::Close()
 
   m_openCount = 0;
   m_multipleExecute = false;
+  m_savepoints = 0;
+  // compiled statements must not outlive the connection they belong to
+  m_statements.clear();
 
   if (nullptr == m_pDB)
     return;
@@ -765,8 +875,22 @@ void CDatabase::BeginTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
+    if (nullptr == m_pDB)
+      return;
+
+    // nested transactions become savepoints so callers can batch work that is itself
+    // transactional, e.g. a library scan running many SetDetailsFor* calls
+    if (m_pDB->in_transaction() && nullptr != m_pDS)
+    {
+      m_pDS->exec("SAVEPOINT nested_" + std::to_string(m_savepoints + 1));
+      m_savepoints++;
+    }
+    else
+    {
+      // savepoints end with the outer transaction, which a failed dataset may have rolled back
+      m_savepoints = 0;
       m_pDB->start_transaction();
+    }
   }
   catch (...)
   {
@@ -778,7 +902,15 @@ bool CDatabase::CommitTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
+    if (m_savepoints > 0 && nullptr != m_pDB && !m_pDB->in_transaction())
+    { // the outer transaction ended with its savepoints, e.g. rolled back by a failed dataset
+      m_savepoints = 0;
+      return false;
+    }
+
+    if (m_savepoints > 0)
+      m_pDS->exec("RELEASE SAVEPOINT nested_" + std::to_string(m_savepoints--));
+    else if (nullptr != m_pDB)
       m_pDB->commit_transaction();
   }
   catch (...)
@@ -793,7 +925,19 @@ void CDatabase::RollbackTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
+    if (m_savepoints > 0 && nullptr != m_pDB && !m_pDB->in_transaction())
+    { // nothing left to roll back, see CommitTransaction
+      m_savepoints = 0;
+      return;
+    }
+
+    if (m_savepoints > 0)
+    {
+      const std::string savepoint = "nested_" + std::to_string(m_savepoints--);
+      m_pDS->exec("ROLLBACK TO SAVEPOINT " + savepoint);
+      m_pDS->exec("RELEASE SAVEPOINT " + savepoint);
+    }
+    else if (nullptr != m_pDB)
       m_pDB->rollback_transaction();
   }
   catch (...)
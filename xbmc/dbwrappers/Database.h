@@ -11,14 +11,17 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace dbiplus
 {
 class Database;
 class Dataset;
+class Statement;
 } // namespace dbiplus
 
+class CVariant;
 class DatabaseSettings;
 class CDbUrl;
 class CProfileManager;
@@ -105,6 +108,11 @@ public:
 
   bool Open(const DatabaseSettings& db);
 
+  /*!
+   * @brief Start a transaction. If a transaction is already running, a savepoint
+   *        is created instead which the matching Commit/RollbackTransaction()
+   *        releases or rolls back without ending the outer transaction.
+   */
   void BeginTransaction();
   virtual bool CommitTransaction();
   void RollbackTransaction();
@@ -176,6 +184,20 @@ public:
    */
   bool ExecuteQuery(const std::string& strQuery);
 
+  /*!
+   * @brief Execute a parameterised statement that does not return any result.
+   *        The statement is compiled once per connection and reused on subsequent
+   *        calls with the same SQL, avoiding a parse and plan per row on hot write paths.
+   *        Falls back to ExecuteQuery() with the parameters substituted if the backend
+   *        has no prepared statement support or BeginMultipleExecute() has been called.
+   * @param strStatement The statement to execute, using '?' as parameter placeholder.
+   *        The placeholder must not otherwise appear in the statement.
+   * @param params The parameters to bind, in order. Null, integer, boolean, double and
+   *        string variants are supported.
+   * @return True if the statement was executed successfully, false otherwise.
+   */
+  bool ExecuteStatement(const std::string& strStatement, const std::vector<CVariant>& params);
+
   /*!
    * @brief Execute a query that returns a result.
    * @remarks Call m_pDS->close(); to clean up the dataset when done.
@@ -319,6 +341,9 @@ protected:
 private:
   void InitSettings(DatabaseSettings& dbSettings);
   void UpdateVersionNumber();
+  std::string SubstituteParameters(const std::string& strStatement,
+                                   const std::vector<CVariant>& params) const;
+  dbiplus::Statement* GetStatement(const std::string& strStatement);
 
   bool m_bMultiInsert{
       false}; /*!< True if there are any queries in the insert queue, false otherwise */
@@ -328,4 +353,9 @@ private:
 
   bool m_multipleExecute{false};
   std::vector<std::string> m_multipleQueries;
+
+  unsigned int m_savepoints{0}; /*!< Depth of transactions nested inside the outermost one */
+
+  std::unordered_map<std::string, std::unique_ptr<dbiplus::Statement>> m_statements;
+  unsigned int m_statementsGeneration{0}; /*!< Connection generation m_statements were compiled on */
 };
@@ -14,6 +14,7 @@
 
 #include "qry_dat.h"
 
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
@@ -41,6 +42,30 @@ constexpr int DB_BAD_RESPONSE = 6;
 constexpr int DB_UNEXPECTED = 7; // This shouldn't ever happen
 constexpr int DB_UNEXPECTED_RESULT = -1; //For integer functions
 
+/******************* Class Statement definition *******************
+
+   represents a pre-compiled, parameterised statement bound to a
+   Database connection; must be destroyed before the connection is
+   closed
+
+******************************************************************/
+class Statement
+{
+public:
+  virtual ~Statement() = default;
+
+  /* bind a value to the parameter at (zero based) position index */
+  virtual void bind_null(int index) = 0;
+  virtual void bind_int64(int index, int64_t value) = 0;
+  virtual void bind_double(int index, double value) = 0;
+  virtual void bind_text(int index, std::string_view value) = 0;
+
+  /* func. executes the statement with the current bindings; throws DbErrors on failure */
+  virtual void execute() = 0;
+  /* func. clears all bindings so the statement can be reused */
+  virtual void reset() = 0;
+};
+
 /******************* Class Database definition ********************
 
    represents  connection with database server;
@@ -51,6 +76,7 @@ class Database
 protected:
   bool active{false};
   bool compression{false};
+  unsigned int connection_generation{0}; // bumped whenever the server connection is closed
   std::string error; // Error description
   std::string host;
   std::string port;
@@ -175,6 +201,17 @@ public:
   virtual std::string vprepare(std::string_view format, va_list args) = 0;
 
   virtual bool in_transaction() { return false; }
+
+  /*! \brief Compile a statement with '?' parameter placeholders for repeated execution.
+   \param sql - statement to compile
+   \return the compiled statement, or nullptr if the backend does not support prepared statements.
+   */
+  virtual std::unique_ptr<Statement> prepare_statement(const std::string& sql) { return nullptr; }
+
+  /*! \brief Number of times the server connection has been closed, e.g. to reconnect.
+   Statements compiled under a previous generation are bound to a dead connection.
+   */
+  unsigned int get_connection_generation() const { return connection_generation; }
 };
 
 /******************* Class Dataset definition *********************
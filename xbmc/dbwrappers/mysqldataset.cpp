@@ -20,8 +20,10 @@
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #ifdef HAS_MYSQL
@@ -290,6 +292,7 @@ void MysqlDatabase::disconnect()
   {
     mysql_close(conn);
     conn = nullptr;
+    ++connection_generation;
   }
 
   active = false;
@@ -577,6 +580,25 @@ long MysqlDatabase::nextid(const char* sname)
   return DB_UNEXPECTED_RESULT;
 }
 
+std::unique_ptr<Statement> MysqlDatabase::prepare_statement(const std::string& sql)
+{
+  if (!active)
+    throw DbErrors("Can't prepare statement: no active connection...");
+
+  MYSQL_STMT* stmt = mysql_stmt_init(conn);
+  if (!stmt)
+    throw DbErrors("Can't prepare statement: out of memory");
+
+  if (mysql_stmt_prepare(stmt, sql.c_str(), sql.size()) != 0)
+  {
+    setErr(mysql_stmt_errno(stmt), sql.c_str());
+    mysql_stmt_close(stmt);
+    throw DbErrors("%s", getErrorMsg());
+  }
+
+  return std::make_unique<MysqlStatement>(*this, stmt, sql);
+}
+
 // methods for transactions
 // ---------------------------------------------
 void MysqlDatabase::start_transaction()
@@ -2141,4 +2163,91 @@ void MysqlDataset::interrupt()
   // Impossible
 }
 
+//************* MysqlStatement implementation ***************
+
+MysqlStatement::MysqlStatement(MysqlDatabase& db, MYSQL_STMT* stmt, std::string sql)
+  : m_db(db),
+    m_stmt(stmt),
+    m_sql(std::move(sql)),
+    m_binds(mysql_stmt_param_count(stmt)),
+    m_params(m_binds.size())
+{
+  reset();
+}
+
+MysqlStatement::~MysqlStatement()
+{
+  mysql_stmt_close(m_stmt);
+}
+
+MYSQL_BIND& MysqlStatement::bind(int index, enum_field_types type)
+{
+  if (index < 0 || static_cast<size_t>(index) >= m_binds.size())
+    throw DbErrors("Parameter index %d out of range\nQuery: %s", index, m_sql.c_str());
+
+  MYSQL_BIND& b = m_binds[index];
+  b = {};
+  b.buffer_type = type;
+  return b;
+}
+
+void MysqlStatement::bind_null(int index)
+{
+  bind(index, MYSQL_TYPE_NULL);
+}
+
+void MysqlStatement::bind_int64(int index, int64_t value)
+{
+  MYSQL_BIND& b = bind(index, MYSQL_TYPE_LONGLONG);
+  m_params[index].i = value;
+  b.buffer = &m_params[index].i;
+}
+
+void MysqlStatement::bind_double(int index, double value)
+{
+  MYSQL_BIND& b = bind(index, MYSQL_TYPE_DOUBLE);
+  m_params[index].d = value;
+  b.buffer = &m_params[index].d;
+}
+
+void MysqlStatement::bind_text(int index, std::string_view value)
+{
+  MYSQL_BIND& b = bind(index, MYSQL_TYPE_STRING);
+  Param& param = m_params[index];
+  param.s.assign(value);
+  param.length = static_cast<unsigned long>(param.s.size());
+  b.buffer = param.s.data();
+  b.buffer_length = param.length;
+  b.length = &param.length;
+}
+
+void MysqlStatement::execute()
+{
+  if ((!m_binds.empty() && mysql_stmt_bind_param(m_stmt, m_binds.data()) != 0) ||
+      mysql_stmt_execute(m_stmt) != 0)
+  {
+    const unsigned int err = mysql_stmt_errno(m_stmt);
+    m_db.setErr(err, m_sql.c_str());
+    const DbErrors error("%s", m_db.getErrorMsg());
+
+    // the statement dies with the connection; reconnect so the caller can prepare it again
+    if (err == CR_SERVER_GONE_ERROR || err == CR_SERVER_LOST)
+    {
+      CLog::Log(LOGINFO, "MYSQL server has gone. Reconnecting for prepared statement.");
+      m_db.connect(true);
+    }
+    throw error;
+  }
+}
+
+void MysqlStatement::reset()
+{
+  for (MYSQL_BIND& b : m_binds)
+  {
+    b = {};
+    b.buffer_type = MYSQL_TYPE_NULL;
+  }
+  mysql_stmt_reset(m_stmt);
+}
+
 } // namespace dbiplus
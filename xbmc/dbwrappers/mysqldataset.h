@@ -11,6 +11,7 @@
 #include "dataset.h"
 
 #include <string>
+#include <vector>
 
 #ifdef HAS_MYSQL
 #include <mysql/mysql.h>
@@ -78,6 +79,7 @@ public:
   std::string vprepare(std::string_view format, va_list args) override;
 
   bool in_transaction() override { return _in_transaction; }
+  std::unique_ptr<Statement> prepare_statement(const std::string& sql) override;
   int query_with_reconnect(const char* query);
   void configure_connection();
 
@@ -86,6 +88,43 @@ private:
   std::string mysql_vmprintf(const char* zFormat, va_list ap);
 };
 
+/***************** Class MysqlStatement definition ******************
+
+       class 'MysqlStatement' wraps a server side prepared MYSQL_STMT
+
+******************************************************************/
+class MysqlStatement : public Statement
+{
+public:
+  MysqlStatement(MysqlDatabase& db, MYSQL_STMT* stmt, std::string sql);
+  ~MysqlStatement() override;
+
+  void bind_null(int index) override;
+  void bind_int64(int index, int64_t value) override;
+  void bind_double(int index, double value) override;
+  void bind_text(int index, std::string_view value) override;
+
+  void execute() override;
+  void reset() override;
+
+private:
+  struct Param
+  {
+    int64_t i{0};
+    double d{0.0};
+    std::string s;
+    unsigned long length{0};
+  };
+
+  MYSQL_BIND& bind(int index, enum_field_types type);
+
+  MysqlDatabase& m_db;
+  MYSQL_STMT* m_stmt;
+  std::string m_sql;
+  std::vector<MYSQL_BIND> m_binds;
+  std::vector<Param> m_params;
+};
+
 /***************** Class MysqlDataset definition *******************
 
        class 'MysqlDataset' does a query to MySQL-server
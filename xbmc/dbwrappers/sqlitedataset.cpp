@@ -19,6 +19,7 @@
 #include "utils/log.h"
 
 #include <chrono>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -404,6 +405,18 @@ void SqliteDatabase::disconnect()
   active = false;
 }
 
+std::unique_ptr<Statement> SqliteDatabase::prepare_statement(const std::string& sql)
+{
+  if (!active)
+    throw DbErrors("Can't prepare statement: no active connection...");
+
+  sqlite3_stmt* stmt = nullptr;
+  if (setErr(sqlite3_prepare_v2(conn, sql.c_str(), -1, &stmt, nullptr), sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", getErrorMsg());
+
+  return std::make_unique<SqliteStatement>(*this, stmt, sql);
+}
+
 int SqliteDatabase::postconnect()
 {
   if (!active)
@@ -1117,4 +1130,65 @@ void SqliteDataset::interrupt()
 {
   sqlite3_interrupt(handle());
 }
+
+//************* SqliteStatement implementation ***************
+
+SqliteStatement::SqliteStatement(SqliteDatabase& db, sqlite3_stmt* stmt, std::string sql)
+  : m_db(db),
+    m_stmt(stmt),
+    m_sql(std::move(sql))
+{
+}
+
+SqliteStatement::~SqliteStatement()
+{
+  sqlite3_finalize(m_stmt);
+}
+
+void SqliteStatement::check(int rc)
+{
+  if (rc != SQLITE_OK)
+  {
+    m_db.setErr(rc, m_sql.c_str());
+    throw DbErrors("%s", m_db.getErrorMsg());
+  }
+}
+
+void SqliteStatement::bind_null(int index)
+{
+  check(sqlite3_bind_null(m_stmt, index + 1));
+}
+
+void SqliteStatement::bind_int64(int index, int64_t value)
+{
+  check(sqlite3_bind_int64(m_stmt, index + 1, value));
+}
+
+void SqliteStatement::bind_double(int index, double value)
+{
+  check(sqlite3_bind_double(m_stmt, index + 1, value));
+}
+
+void SqliteStatement::bind_text(int index, std::string_view value)
+{
+  check(sqlite3_bind_text(m_stmt, index + 1, value.data(), static_cast<int>(value.size()),
+                          SQLITE_TRANSIENT));
+}
+
+void SqliteStatement::execute()
+{
+  int rc = sqlite3_step(m_stmt);
+  // rewind straight away so the statement does not hold a read lock between executions
+  sqlite3_reset(m_stmt);
+  if (rc == SQLITE_ROW)
+    rc = SQLITE_DONE;
+  if (rc != SQLITE_DONE)
+    check(rc);
+}
+
+void SqliteStatement::reset()
+{
+  sqlite3_reset(m_stmt);
+  sqlite3_clear_bindings(m_stmt);
+}
 } // namespace dbiplus
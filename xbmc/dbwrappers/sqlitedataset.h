@@ -17,6 +17,7 @@
 #include <string>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace dbiplus
 {
@@ -84,6 +85,35 @@ public:
   std::string vprepare(std::string_view format, va_list args) override;
 
   bool in_transaction() override { return _in_transaction; }
+
+  std::unique_ptr<Statement> prepare_statement(const std::string& sql) override;
+};
+
+/***************** Class SqliteStatement definition *****************
+
+       class 'SqliteStatement' wraps a compiled sqlite3_stmt
+
+******************************************************************/
+class SqliteStatement : public Statement
+{
+public:
+  SqliteStatement(SqliteDatabase& db, sqlite3_stmt* stmt, std::string sql);
+  ~SqliteStatement() override;
+
+  void bind_null(int index) override;
+  void bind_int64(int index, int64_t value) override;
+  void bind_double(int index, double value) override;
+  void bind_text(int index, std::string_view value) override;
+
+  void execute() override;
+  void reset() override;
+
+private:
+  void check(int rc);
+
+  SqliteDatabase& m_db;
+  sqlite3_stmt* m_stmt;
+  std::string m_sql;
 };
 
 /***************** Class SqliteDataset definition *******************
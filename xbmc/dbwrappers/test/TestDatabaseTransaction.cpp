@@ -0,0 +1,186 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/Database.h"
+#include "dbwrappers/dataset.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "settings/AdvancedSettings.h"
+#include "utils/URIUtils.h"
+#include "utils/Variant.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr const char* DATABASE_NAME = "TestDatabaseTransaction";
+
+class CTestDatabase : public CDatabase
+{
+public:
+  bool Insert(int value)
+  {
+    return ExecuteQuery(PrepareSQL("INSERT INTO item (value) VALUES (%i)", value));
+  }
+
+  bool InsertStatement(int value, const std::string& name)
+  {
+    return ExecuteStatement("INSERT INTO item (value, name) VALUES (?,?)", {value, name});
+  }
+
+  int Count() const { return GetSingleValueInt("SELECT COUNT(*) FROM item"); }
+
+  // the way a dataset failing to run its queries rolls back the transaction it's part of
+  void RollbackBehindOurBack() { m_pDB->rollback_transaction(); }
+
+protected:
+  void CreateTables() override
+  {
+    m_pDS->exec("CREATE TABLE item (id INTEGER PRIMARY KEY, value INTEGER, name TEXT)");
+  }
+  void CreateAnalytics() override {}
+  int GetSchemaVersion() const override { return 1; }
+  const char* GetBaseDBName() const override { return DATABASE_NAME; }
+};
+} // namespace
+
+class TestDatabaseTransaction : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_settings.type = "sqlite3";
+    m_settings.host = CSpecialProtocol::TranslatePath("special://temp/");
+    ASSERT_EQ(CDatabase::ConnectionState::STATE_CONNECTED,
+              m_db.Connect(DATABASE_NAME, m_settings, true));
+  }
+
+  void TearDown() override
+  {
+    m_db.Close();
+    XFILE::CFile::Delete(
+        URIUtils::AddFileToFolder(m_settings.host, std::string(DATABASE_NAME) + ".db"));
+  }
+
+  DatabaseSettings m_settings;
+  CTestDatabase m_db;
+};
+
+TEST_F(TestDatabaseTransaction, NestedCommit)
+{
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(1));
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(2));
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(3));
+  EXPECT_TRUE(m_db.CommitTransaction());
+  EXPECT_TRUE(m_db.CommitTransaction());
+
+  // only the outermost commit ends the transaction
+  EXPECT_TRUE(m_db.InTransaction());
+  EXPECT_TRUE(m_db.CommitTransaction());
+  EXPECT_FALSE(m_db.InTransaction());
+  EXPECT_EQ(3, m_db.Count());
+}
+
+TEST_F(TestDatabaseTransaction, NestedRollback)
+{
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(1));
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(2));
+  m_db.RollbackTransaction();
+
+  // rolling back a nested transaction keeps the outer one and its writes
+  EXPECT_TRUE(m_db.InTransaction());
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(3));
+  EXPECT_TRUE(m_db.CommitTransaction());
+  EXPECT_TRUE(m_db.CommitTransaction());
+  EXPECT_FALSE(m_db.InTransaction());
+  EXPECT_EQ(2, m_db.Count());
+
+  // rolling back the outer transaction discards the committed nested ones
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(4));
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(5));
+  EXPECT_TRUE(m_db.CommitTransaction());
+  m_db.RollbackTransaction();
+  EXPECT_FALSE(m_db.InTransaction());
+  EXPECT_EQ(2, m_db.Count());
+}
+
+TEST_F(TestDatabaseTransaction, OuterTransactionEndedWithSavepoints)
+{
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(1));
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(2));
+  m_db.RollbackBehindOurBack();
+  EXPECT_FALSE(m_db.InTransaction());
+
+  // the savepoint went away with the transaction, so there's nothing to commit
+  EXPECT_FALSE(m_db.CommitTransaction());
+  EXPECT_FALSE(m_db.InTransaction());
+  EXPECT_EQ(0, m_db.Count());
+
+  // the next transactions start from scratch
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(3));
+  EXPECT_TRUE(m_db.CommitTransaction());
+  EXPECT_FALSE(m_db.InTransaction());
+
+  m_db.BeginTransaction();
+  m_db.BeginTransaction();
+  m_db.RollbackBehindOurBack();
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.Insert(4));
+  m_db.RollbackTransaction();
+  EXPECT_FALSE(m_db.InTransaction());
+  EXPECT_EQ(1, m_db.Count());
+}
+
+TEST_F(TestDatabaseTransaction, ExecuteStatement)
+{
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.InsertStatement(1, "It's a name"));
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.InsertStatement(2, "rolled back"));
+  m_db.RollbackTransaction();
+  m_db.BeginTransaction();
+  EXPECT_TRUE(m_db.InsertStatement(3, "committed"));
+  EXPECT_TRUE(m_db.CommitTransaction());
+  EXPECT_TRUE(m_db.CommitTransaction());
+  EXPECT_FALSE(m_db.InTransaction());
+
+  EXPECT_EQ(2, m_db.Count());
+  EXPECT_EQ("It's a name", m_db.GetSingleValue("SELECT name FROM item WHERE value = 1"));
+  EXPECT_EQ("", m_db.GetSingleValue("SELECT name FROM item WHERE value = 2"));
+  EXPECT_EQ("committed", m_db.GetSingleValue("SELECT name FROM item WHERE value = 3"));
+
+  // with multiple execute active the statement is queued with its parameters substituted
+  ASSERT_TRUE(m_db.BeginMultipleExecute());
+  EXPECT_TRUE(m_db.InsertStatement(4, "queued"));
+  EXPECT_EQ(2, m_db.Count());
+  EXPECT_TRUE(m_db.CommitMultipleExecute());
+  EXPECT_EQ(3, m_db.Count());
+  EXPECT_EQ("queued", m_db.GetSingleValue("SELECT name FROM item WHERE value = 4"));
+
+  // statements run on the savepoints of a nested multiple execute
+  m_db.BeginTransaction();
+  ASSERT_TRUE(m_db.BeginMultipleExecute());
+  EXPECT_TRUE(m_db.InsertStatement(5, "nested"));
+  EXPECT_TRUE(m_db.CommitMultipleExecute());
+  m_db.RollbackTransaction();
+  EXPECT_FALSE(m_db.InTransaction());
+  EXPECT_EQ(3, m_db.Count());
+}
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/URIUtils.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+namespace
+{
+constexpr const char* SCHEMA = "CREATE TABLE movie (idMovie INTEGER PRIMARY KEY, title TEXT, "
+                               "rating REAL, year INTEGER)";
+} // namespace
+
+class TestPreparedStatement : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_host = CSpecialProtocol::TranslatePath("special://temp/");
+    m_db.setHostName(m_host.c_str());
+    m_db.setDatabase("TestPreparedStatement.db");
+    ASSERT_EQ(DB_CONNECTION_OK, m_db.connect(true));
+    m_ds.reset(m_db.CreateDataset());
+    m_ds->exec(SCHEMA);
+  }
+
+  void TearDown() override
+  {
+    m_ds.reset();
+    m_db.disconnect();
+    XFILE::CFile::Delete(URIUtils::AddFileToFolder(m_host, "TestPreparedStatement.db"));
+  }
+
+  std::string m_host;
+  SqliteDatabase m_db;
+  std::unique_ptr<Dataset> m_ds;
+};
+
+TEST_F(TestPreparedStatement, BindAndExecute)
+{
+  auto stmt = m_db.prepare_statement("INSERT INTO movie (title, rating, year) VALUES (?,?,?)");
+  ASSERT_NE(nullptr, stmt);
+
+  stmt->bind_text(0, "It's a title");
+  stmt->bind_double(1, 7.5);
+  stmt->bind_int64(2, 1999);
+  stmt->execute();
+
+  // reset clears the previous bindings
+  stmt->reset();
+  stmt->bind_text(0, "Untitled");
+  stmt->execute();
+
+  m_ds->query("SELECT title, rating, year FROM movie ORDER BY idMovie");
+  ASSERT_EQ(2, m_ds->num_rows());
+  EXPECT_EQ("It's a title", m_ds->fv(0).get_asString());
+  EXPECT_DOUBLE_EQ(7.5, m_ds->fv(1).get_asDouble());
+  EXPECT_EQ(1999, m_ds->fv(2).get_asInt());
+  m_ds->next();
+  EXPECT_EQ("Untitled", m_ds->fv(0).get_asString());
+  EXPECT_TRUE(m_ds->fv(1).get_isNull());
+  EXPECT_TRUE(m_ds->fv(2).get_isNull());
+  m_ds->close();
+}
+
+TEST_F(TestPreparedStatement, InvalidStatementThrows)
+{
+  EXPECT_THROW(m_db.prepare_statement("INSERT INTO nosuchtable VALUES (?)"), DbErrors);
+}
@@ -41,6 +41,7 @@ enum CONTEXT_BUTTON
   CONTEXT_BUTTON_VIEW_SLIDESHOW,
   CONTEXT_BUTTON_RECURSIVE_SLIDESHOW,
   CONTEXT_BUTTON_REFRESH_THUMBS,
+  CONTEXT_BUTTON_RECURSIVE_THUMBS,
   CONTEXT_BUTTON_SWITCH_MEDIA,
   CONTEXT_BUTTON_MOVE_ITEM,
   CONTEXT_BUTTON_MOVE_HERE,
@@ -27,6 +27,8 @@
 
 #include <cassert>
 #include <algorithm>
+#include <iterator>
+#include <utility>
 
 using namespace XFILE;
 
@@ -445,3 +447,157 @@ CCacheStrategy *CDoubleCache::CreateNew()
   return new CDoubleCache(m_pCache->CreateNew());
 }
 
+CSegmentedCache::CSegmentedCache(CCacheStrategy* impl, unsigned int segments)
+  : m_maxSegments(std::max(segments, 1u))
+{
+  assert(nullptr != impl);
+  m_segments.push_back({std::unique_ptr<CCacheStrategy>(impl), 0});
+}
+
+CSegmentedCache::~CSegmentedCache() = default;
+
+int CSegmentedCache::Open()
+{
+  return Active()->Open();
+}
+
+void CSegmentedCache::Close()
+{
+  // keep the active cache only, the others are created again on demand
+  Active()->Close();
+  std::swap(m_segments.front(), m_segments[m_active]);
+  m_segments.resize(1);
+  m_active = 0;
+}
+
+size_t CSegmentedCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  return Active()->GetMaxWriteSize(iRequestSize);
+}
+
+int CSegmentedCache::WriteToCache(const char* pBuffer, size_t iSize)
+{
+  return Active()->WriteToCache(pBuffer, iSize);
+}
+
+int CSegmentedCache::ReadFromCache(char* pBuffer, size_t iMaxSize)
+{
+  return Active()->ReadFromCache(pBuffer, iMaxSize);
+}
+
+int64_t CSegmentedCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout)
+{
+  return Active()->WaitForData(iMinAvail, timeout);
+}
+
+int64_t CSegmentedCache::Seek(int64_t iFilePosition)
+{
+  // Position held by another segment only: trigger a seek event which will switch segments
+  if (!Active()->IsCachedPosition(iFilePosition) && FindSegment(iFilePosition) >= 0)
+    return CACHE_RC_ERROR;
+
+  return Active()->Seek(iFilePosition);
+}
+
+bool CSegmentedCache::Reset(int64_t iSourcePosition)
+{
+  // remember when we left the active segment, it holds the origin of this seek
+  m_segments[m_active].lastUsed = ++m_useCounter;
+
+  const int found = FindSegment(iSourcePosition);
+  const size_t next = found >= 0 ? static_cast<size_t>(found) : GetFreeSegment();
+
+  if (found < 0)
+  {
+    CLog::Log(LOGDEBUG, "CSegmentedCache::{} - ({}) Cache miss for {}, refilling segment {}/{}",
+              __FUNCTION__, fmt::ptr(this), iSourcePosition, next + 1, m_segments.size());
+  }
+
+  m_active = next;
+  m_segments[m_active].lastUsed = ++m_useCounter;
+  return Active()->Reset(iSourcePosition);
+}
+
+void CSegmentedCache::EndOfInput()
+{
+  Active()->EndOfInput();
+}
+
+bool CSegmentedCache::IsEndOfInput()
+{
+  return Active()->IsEndOfInput();
+}
+
+void CSegmentedCache::ClearEndOfInput()
+{
+  Active()->ClearEndOfInput();
+}
+
+int64_t CSegmentedCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  int64_t ret = iFilePosition;
+  for (const Segment& segment : m_segments)
+    ret = std::max(ret, segment.cache->CachedDataEndPosIfSeekTo(iFilePosition));
+  return ret;
+}
+
+int64_t CSegmentedCache::CachedDataStartPos()
+{
+  return Active()->CachedDataStartPos();
+}
+
+int64_t CSegmentedCache::CachedDataEndPos()
+{
+  return Active()->CachedDataEndPos();
+}
+
+bool CSegmentedCache::IsCachedPosition(int64_t iFilePosition)
+{
+  return FindSegment(iFilePosition) >= 0;
+}
+
+CCacheStrategy* CSegmentedCache::CreateNew()
+{
+  return new CSegmentedCache(Active()->CreateNew(), m_maxSegments);
+}
+
+int CSegmentedCache::FindSegment(int64_t iFilePosition) const
+{
+  /* Note that when several segments have the requested position, we prefer the
+   * one that has the most forward data, and the active one on a draw
+   */
+  int found = -1;
+  int64_t foundEnd = 0;
+  for (size_t i = 0; i < m_segments.size(); ++i)
+  {
+    CCacheStrategy* cache = m_segments[i].cache.get();
+    if (!cache->IsCachedPosition(iFilePosition))
+      continue;
+
+    const int64_t end = cache->CachedDataEndPos();
+    if (found < 0 || end > foundEnd || (end == foundEnd && i == m_active))
+    {
+      found = static_cast<int>(i);
+      foundEnd = end;
+    }
+  }
+  return found;
+}
+
+size_t CSegmentedCache::GetFreeSegment()
+{
+  if (m_segments.size() < m_maxSegments)
+  {
+    std::unique_ptr<CCacheStrategy> cache(Active()->CreateNew());
+    if (cache->Open() == CACHE_RC_OK)
+    {
+      m_segments.push_back({std::move(cache), 0});
+      return m_segments.size() - 1;
+    }
+    CLog::Log(LOGWARNING, "CSegmentedCache::{} - ({}) Failed to open cache segment {}",
+              __FUNCTION__, fmt::ptr(this), m_segments.size() + 1);
+  }
+
+  const auto lru = std::ranges::min_element(m_segments, {}, &Segment::lastUsed);
+  return static_cast<size_t>(std::distance(m_segments.begin(), lru));
+}
@@ -10,8 +10,10 @@
 
 #include "threads/Event.h"
 
+#include <memory>
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 namespace XFILE {
 
@@ -129,5 +131,64 @@ protected:
   CCacheStrategy *m_pCacheOld;
 };
 
-}
+/*!
+ \brief Cache strategy keeping several independently filled ranges of a file.
+
+ Generalises CDoubleCache to up to \p segments caches: a seek outside the active
+ range switches to another range that holds the position, or refills the least
+ recently used one, so e.g. the container index, the playback position and the
+ origin of the last seek all survive chapter skips.
+ */
+class CSegmentedCache : public CCacheStrategy
+{
+public:
+  CSegmentedCache(CCacheStrategy* impl, unsigned int segments);
+  ~CSegmentedCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* pBuffer, size_t iSize) override;
+  int ReadFromCache(char* pBuffer, size_t iMaxSize) override;
+  int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t iFilePosition) override;
+  bool Reset(int64_t iSourcePosition) override;
+  void EndOfInput() override;
+  bool IsEndOfInput() override;
+  void ClearEndOfInput() override;
 
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  CCacheStrategy* CreateNew() override;
+
+protected:
+  struct Segment
+  {
+    std::unique_ptr<CCacheStrategy> cache;
+    uint64_t lastUsed{0};
+  };
+
+  /*!
+   \brief Find the segment holding a position
+   \return index of the segment with the most forward data for the position, or -1
+   */
+  int FindSegment(int64_t iFilePosition) const;
+  /*!
+   \brief Get a segment to refill from a new position, creating one while below the limit
+   \return index of the new or least recently used segment
+   */
+  size_t GetFreeSegment();
+  CCacheStrategy* Active() const { return m_segments[m_active].cache.get(); }
+
+  std::vector<Segment> m_segments;
+  size_t m_active{0};
+  unsigned int m_maxSegments;
+  uint64_t m_useCounter{0};
+};
+
+}
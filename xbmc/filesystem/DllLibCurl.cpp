@@ -97,6 +97,16 @@ CURLMcode DllLibCurl::multi_cleanup(CURLM* handle)
   return curl_multi_cleanup(handle);
 }
 
+CURLSH* DllLibCurl::share_init()
+{
+  return curl_share_init();
+}
+
+CURLSHcode DllLibCurl::share_cleanup(CURLSH* share)
+{
+  return curl_share_cleanup(share);
+}
+
 curl_slist* DllLibCurl::slist_append(curl_slist* list, const char* to_append)
 {
   return curl_slist_append(list, to_append);
@@ -119,6 +129,16 @@ DllLibCurlGlobal::DllLibCurlGlobal()
   {
     CLog::Log(LOGERROR, "Error initializing libcurl");
   }
+
+  m_share = share_init();
+  if (m_share)
+  {
+    share_setopt(m_share, CURLSHOPT_LOCKFUNC, LockShare);
+    share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, UnlockShare);
+    share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  }
 }
 
 DllLibCurlGlobal::~DllLibCurlGlobal()
@@ -132,6 +152,8 @@ DllLibCurlGlobal::~DllLibCurlGlobal()
     if (session.m_multi)
       multi_cleanup(session.m_multi);
   }
+  if (m_share)
+    share_cleanup(m_share);
   // close libcurl
   curl_global_cleanup();
 }
@@ -153,6 +175,10 @@ void DllLibCurlGlobal::CheckIdle()
     {
       CLog::Log(LOGDEBUG, "{} - Closing session to {}://{} (easy={}, multi={})", __FUNCTION__,
                 it->m_protocol, it->m_hostname, fmt::ptr(it->m_easy), fmt::ptr(it->m_multi));
+      CLog::Log(LOGDEBUG,
+                "{} - {} transfers so far, {} connections created, {} reused, {} over HTTP/2",
+                __FUNCTION__, m_stats.transfers, m_stats.connectionsCreated,
+                m_stats.connectionsReused, m_stats.http2Transfers);
 
       if (it->m_multi && it->m_easy)
         multi_remove_handle(it->m_multi, it->m_easy);
@@ -177,34 +203,42 @@ void DllLibCurlGlobal::easy_acquire(const char* protocol,
 
   std::unique_lock lock(m_critSection);
 
+  /* allow reuse of requester is trying to connect to same host */
+  /* curl will take care of any differences in username/password */
+  /* the most recently used session is the most likely to still have its connection open */
+  SSession* idle = nullptr;
   for (auto& it : m_sessions)
   {
-    if (!it.m_busy)
+    if (!it.m_busy && it.m_protocol.compare(protocol) == 0 &&
+        it.m_hostname.compare(hostname) == 0 &&
+        (!idle || it.m_idletimestamp > idle->m_idletimestamp))
+      idle = &it;
+  }
+
+  if (idle)
+  {
+    idle->m_busy = true;
+    if (easy_handle)
     {
-      /* allow reuse of requester is trying to connect to same host */
-      /* curl will take care of any differences in username/password */
-      if (it.m_protocol.compare(protocol) == 0 && it.m_hostname.compare(hostname) == 0)
+      if (!idle->m_easy)
       {
-        it.m_busy = true;
-        if (easy_handle)
-        {
-          if (!it.m_easy)
-            it.m_easy = easy_init();
-
-          *easy_handle = it.m_easy;
-        }
+        idle->m_easy = easy_init();
+        ShareCaches(idle->m_easy);
+      }
 
-        if (multi_handle)
-        {
-          if (!it.m_multi)
-            it.m_multi = multi_init();
+      *easy_handle = idle->m_easy;
+    }
 
-          *multi_handle = it.m_multi;
-        }
+    if (multi_handle)
+    {
+      if (!idle->m_multi)
+        idle->m_multi = MultiInit();
 
-        return;
-      }
+      *multi_handle = idle->m_multi;
     }
+
+    m_stats.sessionsReused++;
+    return;
   }
 
   SSession session = {};
@@ -215,16 +249,18 @@ void DllLibCurlGlobal::easy_acquire(const char* protocol,
   if (easy_handle)
   {
     session.m_easy = easy_init();
+    ShareCaches(session.m_easy);
     *easy_handle = session.m_easy;
   }
 
   if (multi_handle)
   {
-    session.m_multi = multi_init();
+    session.m_multi = MultiInit();
     *multi_handle = session.m_multi;
   }
 
   m_sessions.push_back(session);
+  m_stats.sessionsCreated++;
 
   CLog::Log(LOGDEBUG, "{} - Created session to {}://{}", __FUNCTION__, protocol, hostname);
 }
@@ -252,6 +288,8 @@ void DllLibCurlGlobal::easy_release(CURL_HANDLE** easy_handle, CURLM** multi_han
   {
     if (it.m_easy == easy && (multi == nullptr || it.m_multi == multi))
     {
+      CountTransfer(easy);
+
       /* reset session so next caller doesn't reuse options, only connections */
       /* will reset verbose too so it won't print that it closed connections on cleanup*/
       easy_reset(easy);
@@ -272,11 +310,14 @@ CURL_HANDLE* DllLibCurlGlobal::easy_duphandle(CURL_HANDLE* easy_handle)
     {
       SSession session = it;
       session.m_easy = DllLibCurl::easy_duphandle(easy_handle);
+      ShareCaches(session.m_easy);
       m_sessions.push_back(session);
       return session.m_easy;
     }
   }
-  return DllLibCurl::easy_duphandle(easy_handle);
+  CURL_HANDLE* duplicate = DllLibCurl::easy_duphandle(easy_handle);
+  ShareCaches(duplicate);
+  return duplicate;
 }
 
 void DllLibCurlGlobal::easy_duplicate(CURL_HANDLE* easy,
@@ -287,10 +328,13 @@ void DllLibCurlGlobal::easy_duplicate(CURL_HANDLE* easy,
   std::unique_lock lock(m_critSection);
 
   if (easy_out && easy)
+  {
     *easy_out = DllLibCurl::easy_duphandle(easy);
+    ShareCaches(*easy_out);
+  }
 
   if (multi_out && multi)
-    *multi_out = DllLibCurl::multi_init();
+    *multi_out = MultiInit();
 
   for (const auto& it : m_sessions)
   {
@@ -312,4 +356,60 @@ void DllLibCurlGlobal::easy_duplicate(CURL_HANDLE* easy,
     }
   }
 }
+
+DllLibCurlGlobal::Stats DllLibCurlGlobal::GetStats() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_stats;
+}
+
+void DllLibCurlGlobal::ShareCaches(CURL_HANDLE* easy)
+{
+  /* duplicated handles don't inherit the share */
+  if (easy && m_share)
+    easy_setopt(easy, CURLOPT_SHARE, m_share);
+}
+
+CURLM* DllLibCurlGlobal::MultiInit()
+{
+  /* transfers run on the same multi handle share an HTTP/2 connection */
+  CURLM* multi = multi_init();
+  if (multi)
+    multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+  return multi;
+}
+
+void DllLibCurlGlobal::CountTransfer(CURL_HANDLE* easy)
+{
+  /* the info is of the last transfer, nothing was transferred without a response */
+  long response = 0;
+  if (!easy || easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &response) != CURLE_OK || response == 0)
+    return;
+
+  m_stats.transfers++;
+
+  long connects = 0;
+  if (easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &connects) == CURLE_OK && connects > 0)
+    m_stats.connectionsCreated += connects;
+  else
+    m_stats.connectionsReused++;
+
+  long version = 0;
+  if (easy_getinfo(easy, CURLINFO_HTTP_VERSION, &version) == CURLE_OK &&
+      version == CURL_HTTP_VERSION_2_0)
+    m_stats.http2Transfers++;
+}
+
+void DllLibCurlGlobal::LockShare(CURL_HANDLE* handle,
+                                 curl_lock_data data,
+                                 curl_lock_access access,
+                                 void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareLocks[data].lock();
+}
+
+void DllLibCurlGlobal::UnlockShare(CURL_HANDLE* handle, curl_lock_data data, void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareLocks[data].unlock();
+}
 } // namespace XCURL
@@ -10,6 +10,9 @@
 
 #include "threads/CriticalSection.h"
 
+#include <array>
+#include <mutex>
+#include <stdint.h>
 #include <stdio.h>
 #include <string>
 #include <sys/time.h>
@@ -48,6 +51,11 @@ public:
   void easy_cleanup(CURL_HANDLE* handle);
   virtual CURL_HANDLE* easy_duphandle(CURL_HANDLE* handle);
   CURLM* multi_init(void);
+  template<typename... Args>
+  CURLMcode multi_setopt(CURLM* multi_handle, CURLMoption option, Args... args)
+  {
+    return curl_multi_setopt(multi_handle, option, std::forward<Args>(args)...);
+  }
   CURLMcode multi_add_handle(CURLM* multi_handle, CURL_HANDLE* easy_handle);
   CURLMcode multi_perform(CURLM* multi_handle, int* running_handles);
   CURLMcode multi_remove_handle(CURLM* multi_handle, CURL_HANDLE* easy_handle);
@@ -59,6 +67,13 @@ public:
   CURLMcode multi_timeout(CURLM* multi_handle, long* timeout);
   CURLMsg* multi_info_read(CURLM* multi_handle, int* msgs_in_queue);
   CURLMcode multi_cleanup(CURLM* handle);
+  CURLSH* share_init();
+  template<typename... Args>
+  CURLSHcode share_setopt(CURLSH* share, CURLSHoption option, Args... args)
+  {
+    return curl_share_setopt(share, option, std::forward<Args>(args)...);
+  }
+  CURLSHcode share_cleanup(CURLSH* share);
   curl_slist* slist_append(curl_slist* list, const char* to_append);
   void slist_free_all(curl_slist* list);
   const char* easy_strerror(CURLcode code);
@@ -82,6 +97,18 @@ public:
   CURL_HANDLE* easy_duphandle(CURL_HANDLE* easy_handle) override;
   void CheckIdle();
 
+  /* counters of the sessions and connections, a transfer is counted when its session is released */
+  struct Stats
+  {
+    uint64_t sessionsCreated = 0;
+    uint64_t sessionsReused = 0;
+    uint64_t transfers = 0;
+    uint64_t connectionsCreated = 0;
+    uint64_t connectionsReused = 0;
+    uint64_t http2Transfers = 0;
+  };
+  Stats GetStats() const;
+
   /* overloaded load and unload with reference counter */
 
   /* structure holding a session info */
@@ -99,7 +126,25 @@ public:
   typedef std::vector<SSession> VEC_CURLSESSIONS;
 
   VEC_CURLSESSIONS m_sessions;
-  CCriticalSection m_critSection;
+  mutable CCriticalSection m_critSection;
+
+private:
+  void ShareCaches(CURL_HANDLE* easy);
+  CURLM* MultiInit();
+  void CountTransfer(CURL_HANDLE* easy);
+
+  static void LockShare(CURL_HANDLE* handle,
+                        curl_lock_data data,
+                        curl_lock_access access,
+                        void* userptr);
+  static void UnlockShare(CURL_HANDLE* handle, curl_lock_data data, void* userptr);
+
+  /* dns and tls session caches shared by all sessions. the connection cache is not shared:
+   * libcurl doesn't support sharing connections between concurrent threads, and every CCurlFile
+   * drives its session from the thread reading from it */
+  CURLSH* m_share = nullptr;
+  std::array<std::mutex, CURL_LOCK_DATA_LAST> m_shareLocks;
+  Stats m_stats;
 };
 } // namespace XCURL
 
@@ -11,6 +11,8 @@
 #include "CircularCache.h"
 #include "ServiceBroker.h"
 #include "URL.h"
+#include "cores/DataCacheCore.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
@@ -135,8 +137,21 @@ bool CFileCache::Open(const CURL& url)
 
   m_fileSize = m_source.GetLength();
 
+  // only the played file's cache is of interest for the player stats
+  m_reportStats = (m_flags & READ_AUDIO_VIDEO) && CServiceBroker::IsServiceManagerUp();
+
   if (!m_pCache)
   {
+    // keep several read-ahead ranges, if configured, so seeks don't always refill from source
+    unsigned int segments = 0;
+    if ((m_flags & READ_AUDIO_VIDEO) && m_seekPossible)
+    {
+      const int cacheSegments =
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_cacheSegments;
+      if (cacheSegments > 1)
+        segments = static_cast<unsigned int>(cacheSegments);
+    }
+
     if (cacheMemSize == 0)
     {
       // Use cache on disk
@@ -162,7 +177,12 @@ bool CFileCache::Open(const CURL& url)
         cacheSize = cacheMemSize;
 
         // NOTE: READ_MULTI_STREAM is only used with READ_AUDIO_VIDEO
-        if (m_flags & READ_MULTI_STREAM)
+        if (segments > 0)
+        {
+          // the memory is shared by all segments, READ_MULTI_STREAM is served by them as well
+          cacheSize /= segments;
+        }
+        else if (m_flags & READ_MULTI_STREAM)
         {
           // READ_MULTI_STREAM requires double buffering, so use half the amount of memory for each buffer
           cacheSize /= 2;
@@ -173,7 +193,11 @@ bool CFileCache::Open(const CURL& url)
           cacheSize = m_chunkSize * 2;
       }
 
-      if (m_flags & READ_MULTI_STREAM)
+      if (segments > 0)
+        CLog::Log(LOGDEBUG,
+                  "CFileCache::{} - <{}> using up to {} memory cache segments each sized {} bytes",
+                  __FUNCTION__, m_sourcePath, segments, cacheSize);
+      else if (m_flags & READ_MULTI_STREAM)
         CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using double memory cache each sized {} bytes",
                   __FUNCTION__, m_sourcePath, cacheSize);
       else
@@ -188,7 +212,11 @@ bool CFileCache::Open(const CURL& url)
       m_maxForward = m_forwardCacheSize;
     }
 
-    if (m_flags & READ_MULTI_STREAM)
+    if (segments > 0 && cacheMemSize != 0)
+    {
+      m_pCache = std::make_unique<CSegmentedCache>(m_pCache.release(), segments);
+    }
+    else if (m_flags & READ_MULTI_STREAM)
     {
       // If READ_MULTI_STREAM flag is set: Double buffering is required
       m_pCache = std::make_unique<CDoubleCache>(m_pCache.release());
@@ -269,8 +297,12 @@ void CFileCache::Process()
           m_seekPossible = m_source.IoControl(IOControl::SEEK_POSSIBLE, NULL);
           sourceSeekFailed = true;
         }
+        else if (m_reportStats)
+          CServiceBroker::GetDataCacheCore().AddFileCacheRefill();
       }
 
+      m_bSeekReset = true;
+
       if (!sourceSeekFailed)
       {
         const bool bCompleteReset = m_pCache->Reset(m_seekPos);
@@ -280,6 +312,7 @@ void CFileCache::Process()
         average.Reset(m_writePos, bCompleteReset); // Can only recalculate new average from scratch after a full reset (empty cache)
         limiter.Reset(m_writePos);
         m_nSeekResult = m_seekPos;
+        m_bSeekReset = bCompleteReset;
         if (bCompleteReset)
         {
           CLog::Log(LOGDEBUG,
@@ -420,6 +453,8 @@ void CFileCache::Process()
     }
 
     m_writePos += iTotalWrite;
+    if (m_reportStats && iTotalWrite > 0)
+      CServiceBroker::GetDataCacheCore().AddFileCacheRead(iTotalWrite);
 
     // under estimate write rate by a second, to
     // avoid uncertainty at start of caching
@@ -551,6 +586,7 @@ int64_t CFileCache::Seek(int64_t iFilePosition, int iWhence)
       if (!CThread::IsRunning())
         return -1;
     }
+    ReportSeek(!m_bSeekReset);
 
     /* wait for any remaining data */
     if(m_seekPos < iTarget)
@@ -570,11 +606,20 @@ int64_t CFileCache::Seek(int64_t iFilePosition, int iWhence)
     m_seekEvent.Reset();
   }
   else
+  {
     m_readPos = iTarget;
+    ReportSeek(true);
+  }
 
   return iTarget;
 }
 
+void CFileCache::ReportSeek(bool hit) const
+{
+  if (m_reportStats)
+    CServiceBroker::GetDataCacheCore().AddFileCacheSeek(hit);
+}
+
 void CFileCache::Close()
 {
   StopThread();
@@ -584,6 +629,18 @@ void CFileCache::Close()
     m_pCache->Close();
 
   m_source.Close();
+
+  if (m_reportStats)
+  {
+    m_reportStats = false;
+    const CDataCacheCore::SFileCacheStats stats =
+        CServiceBroker::GetDataCacheCore().GetFileCacheStats();
+    CLog::Log(LOGDEBUG,
+              "CFileCache::{} - <{}> closed, seeks served from cache {}, seeks refilling {}, "
+              "source repositioned {} times, {} bytes read",
+              __FUNCTION__, m_sourcePath, stats.seekHits, stats.seekMisses, stats.refills,
+              stats.refillBytes);
+  }
 }
 
 int64_t CFileCache::GetPosition()
@@ -58,6 +58,8 @@ namespace XFILE
     }
 
   private:
+    void ReportSeek(bool hit) const;
+
     std::unique_ptr<CCacheStrategy> m_pCache;
     int m_seekPossible = 0;
     CFile m_source;
@@ -75,6 +77,8 @@ namespace XFILE
     int64_t m_forwardCacheSize = 0;
     int64_t m_maxForward = 0;
     bool m_bFilling = false;
+    bool m_bSeekReset = false;
+    bool m_reportStats = false;
     std::atomic<int64_t> m_fileSize;
     unsigned int m_flags;
     CCriticalSection m_sync;
@@ -0,0 +1,150 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/CacheStrategy.h"
+#include "filesystem/CircularCache.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr size_t FRONT = 4096;
+constexpr size_t BACK = 1024;
+
+char PatternAt(int64_t pos)
+{
+  return static_cast<char>(pos * 31 % 251);
+}
+
+// Seek the cache the way CFileCache does and continue filling it from the "source"
+// \return true if the seek was a cache miss
+bool SeekAndFill(CCacheStrategy& cache, int64_t pos, size_t fill)
+{
+  bool miss = false;
+  if (cache.Seek(pos) != pos)
+    miss = cache.Reset(pos);
+
+  const int64_t sourcePos = cache.CachedDataEndPos();
+
+  std::vector<char> data(fill);
+  for (size_t i = 0; i < fill; ++i)
+    data[i] = PatternAt(sourcePos + i);
+
+  size_t written = 0;
+  while (written < fill)
+  {
+    const int ret = cache.WriteToCache(data.data() + written, fill - written);
+    if (ret <= 0)
+      break;
+    written += ret;
+  }
+  return miss;
+}
+
+bool ReadMatches(CCacheStrategy& cache, int64_t pos, size_t len)
+{
+  std::vector<char> buffer(len);
+  size_t read = 0;
+  while (read < len)
+  {
+    const int ret = cache.ReadFromCache(buffer.data() + read, len - read);
+    if (ret <= 0)
+      return false;
+    read += ret;
+  }
+  for (size_t i = 0; i < len; ++i)
+  {
+    if (buffer[i] != PatternAt(pos + i))
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+class TestSegmentedCache : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    cache = std::make_unique<CSegmentedCache>(new CCircularCache(FRONT, BACK), 3);
+    ASSERT_EQ(CACHE_RC_OK, cache->Open());
+  }
+
+  void TearDown() override { cache->Close(); }
+
+  std::unique_ptr<CSegmentedCache> cache;
+};
+
+TEST_F(TestSegmentedCache, KeepsRanges)
+{
+  EXPECT_FALSE(SeekAndFill(*cache, 0, FRONT)); // first fill of the empty cache
+  EXPECT_TRUE(SeekAndFill(*cache, 1000000, FRONT));
+  EXPECT_TRUE(SeekAndFill(*cache, 500000, FRONT));
+
+  EXPECT_TRUE(cache->IsCachedPosition(100));
+  EXPECT_TRUE(cache->IsCachedPosition(1000100));
+  EXPECT_TRUE(cache->IsCachedPosition(500100));
+
+  // seeking into a range that isn't active needs a reset, which is served from cache
+  EXPECT_EQ(CACHE_RC_ERROR, cache->Seek(100));
+  EXPECT_EQ(static_cast<int64_t>(FRONT), cache->CachedDataEndPosIfSeekTo(100));
+  EXPECT_FALSE(cache->Reset(100));
+  EXPECT_TRUE(ReadMatches(*cache, 100, 1000));
+
+  EXPECT_EQ(CACHE_RC_ERROR, cache->Seek(1000200));
+  EXPECT_FALSE(cache->Reset(1000200));
+  EXPECT_TRUE(ReadMatches(*cache, 1000200, 1000));
+}
+
+TEST_F(TestSegmentedCache, EvictsLeastRecentlyUsed)
+{
+  SeekAndFill(*cache, 0, FRONT);
+  SeekAndFill(*cache, 1000000, FRONT);
+  SeekAndFill(*cache, 500000, FRONT);
+
+  // use the first range again, leaving 1000000 as the least recently used one
+  SeekAndFill(*cache, 100, 0);
+  EXPECT_TRUE(SeekAndFill(*cache, 2000000, FRONT));
+
+  EXPECT_TRUE(cache->IsCachedPosition(100));
+  EXPECT_TRUE(cache->IsCachedPosition(500100));
+  EXPECT_TRUE(cache->IsCachedPosition(2000100));
+  EXPECT_FALSE(cache->IsCachedPosition(1000100));
+  EXPECT_TRUE(ReadMatches(*cache, 2000000, FRONT));
+}
+
+TEST_F(TestSegmentedCache, ChapterSkipsVersusDoubleCache)
+{
+  // index at the start of the file, playback position and repeated skips between two chapters
+  const std::array<int64_t, 8> seeks{0, 10000000, 20000000, 10000100,
+                                     20000100, 0, 10000200, 20000200};
+
+  CDoubleCache doubleCache(new CCircularCache(FRONT, BACK));
+  ASSERT_EQ(CACHE_RC_OK, doubleCache.Open());
+
+  int segmentedMisses = 0;
+  int doubleMisses = 0;
+  for (const int64_t pos : seeks)
+  {
+    if (SeekAndFill(*cache, pos, FRONT))
+      segmentedMisses++;
+    if (SeekAndFill(doubleCache, pos, FRONT))
+      doubleMisses++;
+  }
+  doubleCache.Close();
+
+  // only the first visit of each range has to go to the source
+  EXPECT_EQ(2, segmentedMisses);
+  EXPECT_LT(segmentedMisses, doubleMisses);
+}
@@ -8,10 +8,26 @@
 
 #include "DirtyRegionSolvers.h"
 
+#include "utils/StringUtils.h"
 #include "windowing/GraphicContext.h"
 
+#include <algorithm>
 #include <stdio.h>
 
+namespace
+{
+// costs before the first frame was timed: fixed, per pass and per megapixel in microseconds
+constexpr std::array<double, 3> PRIOR_COSTS = {0.0, 500.0, 2000.0};
+// weight of the prior costs in frames, keeps costs the timings can't tell apart near the prior
+constexpr double PRIOR_WEIGHT = 0.01;
+// weight of the timing of a frame after every further frame, about 100 frames are remembered
+constexpr double DECAY = 0.99;
+// frames taking longer than this multiple of the estimate are clipped to it, e.g. texture loads
+constexpr double MAX_OUTLIER = 4.0;
+constexpr double MIN_OUTLIER_ESTIMATE = 1000.0;
+constexpr double MIN_COST = 1.0;
+} // namespace
+
 void CUnionDirtyRegionSolver::Solve(const CDirtyRegionList &input, CDirtyRegionList &output)
 {
   CDirtyRegion unifiedRegion;
@@ -40,6 +56,12 @@ CGreedyDirtyRegionSolver::CGreedyDirtyRegionSolver()
   m_costPerArea   = 0.01f;
 }
 
+void CGreedyDirtyRegionSolver::SetCosts(float costNewRegion, float costPerArea)
+{
+  m_costNewRegion = costNewRegion;
+  m_costPerArea = costPerArea;
+}
+
 void CGreedyDirtyRegionSolver::Solve(const CDirtyRegionList &input, CDirtyRegionList &output)
 {
   for (unsigned int i = 0; i < input.size(); i++)
@@ -71,3 +93,107 @@ void CGreedyDirtyRegionSolver::Solve(const CDirtyRegionList &input, CDirtyRegion
       output.push_back(currentRegion);
   }
 }
+
+CAdaptiveDirtyRegionSolver::CAdaptiveDirtyRegionSolver() : m_costs(PRIOR_COSTS)
+{
+  Fit();
+}
+
+void CAdaptiveDirtyRegionSolver::Solve(const CDirtyRegionList &input, CDirtyRegionList &output)
+{
+  CDirtyRegionList greedy;
+  m_greedy.Solve(input, greedy);
+
+  CDirtyRegionList unified;
+  m_union.Solve(input, unified);
+
+  m_merged = greedy.size() > 1 && EstimateCost(unified) <= EstimateCost(greedy);
+  const CDirtyRegionList& solved = m_merged ? unified : greedy;
+  output.insert(output.end(), solved.begin(), solved.end());
+}
+
+std::string CAdaptiveDirtyRegionSolver::GetStrategy() const
+{
+  return StringUtils::Format("adaptive {} ({:.0f} us/pass, {:.0f} us/MP)",
+                             m_merged ? "union" : "cost reduction", m_costs[PASS],
+                             m_costs[PIXELS]);
+}
+
+void CAdaptiveDirtyRegionSolver::OnRendered(const CDirtyRegionList& rendered,
+                                            std::chrono::microseconds duration)
+{
+  const Vector terms = GetTerms(rendered);
+  if (terms[PASS] == 0)
+    return;
+
+  const double estimate = std::max(EstimateCost(rendered), MIN_OUTLIER_ESTIMATE);
+  const double timing = std::min(static_cast<double>(duration.count()), estimate * MAX_OUTLIER);
+
+  for (int i = 0; i < TERMS; i++)
+  {
+    for (int j = 0; j < TERMS; j++)
+      m_weights[i][j] = m_weights[i][j] * DECAY + terms[i] * terms[j];
+    m_timings[i] = m_timings[i] * DECAY + terms[i] * timing;
+  }
+  Fit();
+}
+
+double CAdaptiveDirtyRegionSolver::EstimateCost(const CDirtyRegionList& regions) const
+{
+  const Vector terms = GetTerms(regions);
+  double cost = 0;
+  for (int i = 0; i < TERMS; i++)
+    cost += terms[i] * m_costs[i];
+  return cost;
+}
+
+CAdaptiveDirtyRegionSolver::Vector CAdaptiveDirtyRegionSolver::GetTerms(
+    const CDirtyRegionList& regions)
+{
+  Vector terms{1.0, 0.0, 0.0};
+  for (const CDirtyRegion& region : regions)
+  {
+    if (region.IsEmpty())
+      continue;
+    terms[PASS] += 1.0;
+    terms[PIXELS] += region.Area() / 1000000.0;
+  }
+  return terms;
+}
+
+void CAdaptiveDirtyRegionSolver::Fit()
+{
+  // least squares of the weighted timings, regularized towards the prior costs
+  Matrix a = m_weights;
+  Vector b = m_timings;
+  for (int i = 0; i < TERMS; i++)
+  {
+    a[i][i] += PRIOR_WEIGHT;
+    b[i] += PRIOR_WEIGHT * PRIOR_COSTS[i];
+  }
+
+  // the regularization keeps the matrix positive definite, no pivoting needed
+  for (int i = 0; i < TERMS; i++)
+  {
+    for (int j = i + 1; j < TERMS; j++)
+    {
+      const double factor = a[j][i] / a[i][i];
+      for (int k = i; k < TERMS; k++)
+        a[j][k] -= factor * a[i][k];
+      b[j] -= factor * b[i];
+    }
+  }
+  for (int i = TERMS - 1; i >= 0; i--)
+  {
+    double sum = b[i];
+    for (int k = i + 1; k < TERMS; k++)
+      sum -= a[i][k] * m_costs[k];
+    m_costs[i] = sum / a[i][i];
+  }
+
+  m_costs[FIXED] = std::max(m_costs[FIXED], 0.0);
+  m_costs[PASS] = std::max(m_costs[PASS], MIN_COST);
+  m_costs[PIXELS] = std::max(m_costs[PIXELS], MIN_COST);
+  m_greedy.SetCosts(static_cast<float>(m_costs[PASS]),
+                    static_cast<float>(m_costs[PIXELS] / 1000000.0));
+}
@@ -10,22 +10,27 @@
 
 #include "IDirtyRegionSolver.h"
 
+#include <array>
+
 class CUnionDirtyRegionSolver : public IDirtyRegionSolver
 {
 public:
   void Solve(const CDirtyRegionList &input, CDirtyRegionList &output) override;
+  std::string GetStrategy() const override { return "union"; }
 };
 
 class CFillViewportAlwaysRegionSolver : public IDirtyRegionSolver
 {
 public:
   void Solve(const CDirtyRegionList &input, CDirtyRegionList &output) override;
+  std::string GetStrategy() const override { return "fill viewport always"; }
 };
 
 class CFillViewportOnChangeRegionSolver : public IDirtyRegionSolver
 {
 public:
   void Solve(const CDirtyRegionList &input, CDirtyRegionList &output) override;
+  std::string GetStrategy() const override { return "fill viewport on change"; }
 };
 
 class CGreedyDirtyRegionSolver : public IDirtyRegionSolver
@@ -33,7 +38,58 @@ class CGreedyDirtyRegionSolver : public IDirtyRegionSolver
 public:
   CGreedyDirtyRegionSolver();
   void Solve(const CDirtyRegionList &input, CDirtyRegionList &output) override;
+  std::string GetStrategy() const override { return "cost reduction"; }
+
+  void SetCosts(float costNewRegion, float costPerArea);
+
 private:
   float m_costNewRegion;
   float m_costPerArea;
 };
+
+/*!
+ \brief Solves the regions by the cost of rendering them, as measured on this device.
+
+ The time a frame takes to render is modelled as a fixed cost, a cost per rendering pass and a
+ cost per pixel. These are fitted to the timings of the rendered frames, so they follow the GPU,
+ the resolution and the skin. Every frame the regions are merged by the cost reduction solver
+ with the fitted costs, unless rendering their union in one pass is estimated to be cheaper.
+ */
+class CAdaptiveDirtyRegionSolver : public IDirtyRegionSolver
+{
+public:
+  CAdaptiveDirtyRegionSolver();
+  void Solve(const CDirtyRegionList &input, CDirtyRegionList &output) override;
+  std::string GetStrategy() const override;
+  void OnRendered(const CDirtyRegionList& rendered, std::chrono::microseconds duration) override;
+
+  // Fitted costs in microseconds
+  double GetCostPerPass() const { return m_costs[PASS]; }
+  double GetCostPerMegapixel() const { return m_costs[PIXELS]; }
+
+  // Estimated time in microseconds to render the regions
+  double EstimateCost(const CDirtyRegionList& regions) const;
+
+private:
+  enum Term
+  {
+    FIXED,
+    PASS,
+    PIXELS,
+    TERMS
+  };
+  using Vector = std::array<double, TERMS>;
+  using Matrix = std::array<Vector, TERMS>;
+
+  static Vector GetTerms(const CDirtyRegionList& regions);
+  void Fit();
+
+  CUnionDirtyRegionSolver m_union;
+  CGreedyDirtyRegionSolver m_greedy;
+  bool m_merged{false};
+
+  // exponentially weighted normal equations of the timings
+  Matrix m_weights{};
+  Vector m_timings{};
+  Vector m_costs;
+};
@@ -34,6 +34,10 @@ void CDirtyRegionTracker::SelectAlgorithm()
 
   switch (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions)
   {
+    case DIRTYREGION_SOLVER_ADAPTIVE:
+      CLog::Log(LOGDEBUG, "guilib: Adaptive cost reduction as algorithm for solving rendering passes");
+      m_solver = new CAdaptiveDirtyRegionSolver();
+      break;
     case DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE:
       CLog::Log(LOGDEBUG, "guilib: Fill viewport on change for solving rendering passes");
       m_solver = new CFillViewportOnChangeRegionSolver();
@@ -82,3 +86,34 @@ void CDirtyRegionTracker::CleanMarkedRegions(int bufferAge)
                                        { return r.UpdateAge() > bufferAge; }),
                         m_markedRegions.end());
 }
+
+void CDirtyRegionTracker::OnRendered(const CDirtyRegionList& rendered,
+                                     const CRect& viewport,
+                                     std::chrono::microseconds duration)
+{
+  if (m_solver)
+    m_solver->OnRendered(rendered, duration);
+
+  m_stats.passes = 0;
+  float pixels = 0;
+  for (const CDirtyRegion& region : rendered)
+  {
+    CRect visible(viewport);
+    visible.Intersect(region);
+    if (visible.IsEmpty())
+      continue;
+    m_stats.passes++;
+    pixels += visible.Area();
+  }
+  m_stats.renderedPixels = static_cast<uint64_t>(pixels);
+  m_stats.savedPixels = static_cast<uint64_t>(std::max(viewport.Area() - pixels, 0.0f));
+  m_stats.duration = duration;
+}
+
+CDirtyRegionTracker::Stats CDirtyRegionTracker::GetStats() const
+{
+  Stats stats = m_stats;
+  if (m_solver)
+    stats.strategy = m_solver->GetStrategy();
+  return stats;
+}
@@ -10,6 +10,10 @@
 
 #include "IDirtyRegionSolver.h"
 
+#include <chrono>
+#include <cstdint>
+#include <string>
+
 class CDirtyRegionTracker
 {
 public:
@@ -22,7 +26,32 @@ public:
   CDirtyRegionList GetDirtyRegions();
   void CleanMarkedRegions(int bufferAge);
 
+  /*!
+   \brief Report the regions of a frame that were rendered and how long that took
+   \param rendered the regions rendered, one pass each
+   \param viewport the area that would have been rendered without dirty regions
+   \param duration time spent rendering
+   */
+  void OnRendered(const CDirtyRegionList& rendered,
+                  const CRect& viewport,
+                  std::chrono::microseconds duration);
+
+  struct Stats
+  {
+    std::string strategy;
+    unsigned int passes{0}; ///< rendering passes of the last rendered frame
+    uint64_t renderedPixels{0};
+    uint64_t savedPixels{0}; ///< pixels of the viewport the last rendered frame didn't render
+    std::chrono::microseconds duration{0};
+  };
+
+  /*!
+   \brief Get the stats of the last rendered frame
+   */
+  Stats GetStats() const;
+
 private:
   CDirtyRegionList m_markedRegions;
   IDirtyRegionSolver *m_solver;
+  Stats m_stats;
 };
@@ -76,6 +76,67 @@ static inline size_t Clamp(int64_t newPosition, size_t bufferSize)
   return std::min(std::max((int64_t) 0, newPosition), (int64_t) (bufferSize -1));
 }
 
+// size of a baseline or progressive 8 bit JPEG from its start of frame segment. the decoder
+// can't reduce the resolution of other JPEGs (lossless, 12 bit, arithmetic coded).
+static bool GetJpegSize(const uint8_t* buffer,
+                        size_t bufSize,
+                        unsigned int& width,
+                        unsigned int& height)
+{
+  size_t pos = 2;
+  while (pos + 4 <= bufSize)
+  {
+    if (buffer[pos] != 0xFF)
+      return false;
+
+    const uint8_t marker = buffer[pos + 1];
+    if (marker == 0xFF) // fill byte
+    {
+      pos++;
+      continue;
+    }
+    if (marker == 0xD9 || marker == 0xDA) // end of image or start of scan before any frame
+      return false;
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) // no segment length
+    {
+      pos += 2;
+      continue;
+    }
+
+    const size_t length = (buffer[pos + 2] << 8) | buffer[pos + 3];
+    if (marker == 0xC0 || marker == 0xC1 || marker == 0xC2)
+    {
+      if (length < 8 || pos + 9 > bufSize || buffer[pos + 4] != 8)
+        return false;
+
+      height = (buffer[pos + 5] << 8) | buffer[pos + 6];
+      width = (buffer[pos + 7] << 8) | buffer[pos + 8];
+      return width > 0 && height > 0;
+    }
+    if (marker >= 0xC3 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+      return false;
+
+    pos += 2 + length;
+  }
+  return false;
+}
+
+// the largest power of two reduction of the image which still needs to be scaled down to fit
+// into width x height keeping its aspect ratio
+static int GetLowres(const AVCodec* codec,
+                     unsigned int imageWidth,
+                     unsigned int imageHeight,
+                     unsigned int width,
+                     unsigned int height)
+{
+  int lowres = 0;
+  while (lowres < codec->max_lowres &&
+         (static_cast<uint64_t>(width) << (lowres + 1) <= imageWidth ||
+          static_cast<uint64_t>(height) << (lowres + 1) <= imageHeight))
+    lowres++;
+  return lowres;
+}
+
 static int mem_file_read(void *h, uint8_t* buf, int size)
 {
   if (size < 0)
@@ -143,8 +204,7 @@ CFFmpegImage::~CFFmpegImage()
 bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSize,
                                       unsigned int width, unsigned int height)
 {
-
-  if (!Initialize(buffer, bufSize))
+  if (!Initialize(buffer, bufSize, width, height))
   {
     //log
     return false;
@@ -156,7 +216,10 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
   return !(m_pFrame == nullptr);
 }
 
-bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
+bool CFFmpegImage::Initialize(unsigned char* buffer,
+                              size_t bufSize,
+                              unsigned int width /* = 0 */,
+                              unsigned int height /* = 0 */)
 {
   int bufferSize = 4096;
   uint8_t* fbuffer = (uint8_t*)av_malloc(bufferSize + AV_INPUT_BUFFER_PADDING_SIZE);
@@ -278,6 +341,13 @@ bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
     return false;
   }
 
+  // let the decoder scale down large JPEGs in the DCT domain, it's a fraction of the work
+  m_sourceWidth = 0;
+  m_sourceHeight = 0;
+  if (is_jpeg && codec && width > 0 && height > 0 &&
+      GetJpegSize(buffer, bufSize, m_sourceWidth, m_sourceHeight))
+    m_codec_ctx->lowres = GetLowres(codec, m_sourceWidth, m_sourceHeight, width, height);
+
   if (avcodec_open2(m_codec_ctx, codec, NULL) < 0)
   {
     avformat_close_input(&m_fctx);
@@ -336,8 +406,9 @@ AVFrame* CFFmpegImage::ExtractFrame()
 
   m_height = frame->height;
   m_width = frame->width;
-  m_originalWidth = m_width;
-  m_originalHeight = m_height;
+  // the frame is smaller than the image if it was decoded at a lower resolution
+  m_originalWidth = m_codec_ctx->lowres > 0 ? m_sourceWidth : m_width;
+  m_originalHeight = m_codec_ctx->lowres > 0 ? m_sourceHeight : m_height;
 
   const AVPixFmtDescriptor* pixDescriptor = av_pix_fmt_desc_get(static_cast<AVPixelFormat>(frame->format));
   if (pixDescriptor && ((pixDescriptor->flags & (AV_PIX_FMT_FLAG_ALPHA | AV_PIX_FMT_FLAG_PAL)) != 0))
@@ -509,7 +580,7 @@ bool CFFmpegImage::DecodeFrame(AVFrame* frame, unsigned int width, unsigned int
   AVColorRange range = frame->color_range;
   AVPixelFormat pixFormat = ConvertFormats(frame);
 
-  SwsContext* context = sws_getContext(m_originalWidth, m_originalHeight, pixFormat, width, height,
+  SwsContext* context = sws_getContext(frame->width, frame->height, pixFormat, width, height,
                                        AV_PIX_FMT_RGB32, SWS_BICUBIC, NULL, NULL, NULL);
 
   if (range == AVCOL_RANGE_JPEG)
@@ -522,7 +593,7 @@ bool CFFmpegImage::DecodeFrame(AVFrame* frame, unsigned int width, unsigned int
     sws_setColorspaceDetails(context, inv_table, srcRange, table, dstRange, brightness, contrast, saturation);
   }
 
-  sws_scale(context, frame->data, frame->linesize, 0, m_originalHeight,
+  sws_scale(context, frame->data, frame->linesize, 0, frame->height,
     pictureRGB->data, pictureRGB->linesize);
   sws_freeContext(context);
 
@@ -71,7 +71,18 @@ public:
                                   unsigned int &bufferoutSize) override;
   void ReleaseThumbnailBuffer() override;
 
-  bool Initialize(unsigned char* buffer, size_t bufSize);
+  /*!
+   \brief Open the image for decoding.
+   \param buffer The image file data
+   \param bufSize The size of the data
+   \param width The width the image will be scaled to fit into, 0 to decode it at full size
+   \param height The height the image will be scaled to fit into, 0 to decode it at full size
+   \return true if the image can be decoded
+   */
+  bool Initialize(unsigned char* buffer,
+                  size_t bufSize,
+                  unsigned int width = 0,
+                  unsigned int height = 0);
 
   std::shared_ptr<Frame> ReadFrame();
 
@@ -94,4 +105,7 @@ private:
 
   AVFrame* m_pFrame;
   uint8_t* m_outputBuffer;
+
+  unsigned int m_sourceWidth = 0; ///< size of a JPEG which may be decoded at a lower resolution
+  unsigned int m_sourceHeight = 0;
 };
@@ -11,9 +11,11 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "GUIInfoManager.h"
+#include "GUILargeTextureManager.h"
 #include "GUIListItemLayout.h"
 #include "GUIMessage.h"
 #include "ServiceBroker.h"
+#include "guilib/GUIComponent.h"
 #include "guilib/GUIListItem.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "guilib/listproviders/IListProvider.h"
@@ -21,6 +23,7 @@
 #include "input/actions/ActionIDs.h"
 #include "input/keyboard/KeyIDs.h"
 #include "input/mouse/MouseEvent.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CharsetConverter.h"
@@ -31,6 +34,8 @@
 #include "utils/XBMCTinyXML.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
 using namespace KODI;
@@ -40,6 +45,14 @@ using namespace KODI;
 #define SCROLLING_GAP   200U
 #define SCROLLING_THRESHOLD 300U
 
+namespace
+{
+// time constant of the smoothing of the scroll speed, in ms
+constexpr float PREFETCH_SMOOTHING_TIME = 300.0f;
+// how far ahead of the scrolling the images are prefetched, in s
+constexpr float PREFETCH_LOOKAHEAD_TIME = 0.5f;
+} // namespace
+
 CGUIBaseContainer::CGUIBaseContainer(int parentID, int controlID, float posX, float posY, float width, float height, ORIENTATION orientation, const CScroller& scroller, int preloadItems)
     : IGUIContainer(parentID, controlID, posX, posY, width, height)
     , m_scroller(scroller)
@@ -96,7 +109,10 @@ CGUIBaseContainer::CGUIBaseContainer(const CGUIBaseContainer& other)
     m_scrollItemsPerFrame(other.m_scrollItemsPerFrame),
     m_gestureActive(other.m_gestureActive),
     m_waitForScrollEnd(other.m_waitForScrollEnd),
-    m_lastScrollValue(other.m_lastScrollValue)
+    m_lastScrollValue(other.m_lastScrollValue),
+    m_prefetchSpeed(other.m_prefetchSpeed),
+    m_prefetchScrollValue(other.m_prefetchScrollValue),
+    m_prefetchTime(other.m_prefetchTime)
 {
   // Initialize CGUIControl
   m_bInvalidated = true;
@@ -156,9 +172,16 @@ void CGUIBaseContainer::Process(unsigned int currentTime, CDirtyRegionList &dirt
   int cacheBefore, cacheAfter;
   GetCacheOffsets(cacheBefore, cacheAfter);
 
+  int prefetchBefore, prefetchAfter;
+  GetPrefetchOffsets(currentTime, prefetchBefore, prefetchAfter);
+
   // Free memory not used on screen
-  if ((int)m_items.size() > m_itemsPerPage + cacheBefore + cacheAfter)
-    FreeMemory(CorrectOffset(offset - cacheBefore, 0), CorrectOffset(offset + m_itemsPerPage + 1 + cacheAfter, 0));
+  if ((int)m_items.size() >
+      m_itemsPerPage + cacheBefore + cacheAfter + prefetchBefore + prefetchAfter)
+    FreeMemory(CorrectOffset(offset - cacheBefore - prefetchBefore, 0),
+               CorrectOffset(offset + m_itemsPerPage + 1 + cacheAfter + prefetchAfter, 0));
+  else
+    prefetchBefore = prefetchAfter = 0;
 
   CPoint origin = CPoint(m_posX, m_posY) + m_renderOffset;
   float pos = (m_orientation == VERTICAL) ? origin.y : origin.x;
@@ -195,6 +218,34 @@ void CGUIBaseContainer::Process(unsigned int currentTime, CDirtyRegionList &dirt
     current++;
   }
 
+  // prefetch the items we are scrolling towards
+  for (int i = 0; i < prefetchAfter && !m_items.empty(); ++i, ++current)
+  {
+    const int itemNo = CorrectOffset(current, 0);
+    if (itemNo >= (int)m_items.size())
+      break;
+    if (itemNo >= 0)
+    {
+      if (m_orientation == VERTICAL)
+        ProcessPrefetchItem(origin.x, pos, m_items[itemNo], currentTime);
+      else
+        ProcessPrefetchItem(pos, origin.y, m_items[itemNo], currentTime);
+    }
+    pos += m_layout->Size(m_orientation);
+  }
+  for (int i = 1; i <= prefetchBefore && !m_items.empty(); ++i)
+  {
+    const int itemNo = CorrectOffset(offset - cacheBefore - i, 0);
+    if (itemNo < 0 || itemNo >= (int)m_items.size())
+      break;
+    const float itemPos = (m_orientation == VERTICAL ? origin.y : origin.x) + drawOffset -
+                          i * m_layout->Size(m_orientation);
+    if (m_orientation == VERTICAL)
+      ProcessPrefetchItem(origin.x, itemPos, m_items[itemNo], currentTime);
+    else
+      ProcessPrefetchItem(itemPos, origin.y, m_items[itemNo], currentTime);
+  }
+
   // when we are scrolling up, offset will become lower (integer division, see offset calc)
   // to have same behaviour when scrolling down, we need to set page control to offset+1
   UpdatePageControl(offset + (m_scroller.IsScrollingDown() ? 1 : 0));
@@ -1309,6 +1360,8 @@ int CGUIBaseContainer::CorrectOffset(int offset, int cursor) const
 void CGUIBaseContainer::Reset()
 {
   m_wasReset = true;
+  m_prefetchSpeed = 0.0f;
+  m_prefetchTime = 0;
   m_items.clear();
   m_lastItem.reset();
   ResetAutoScrolling();
@@ -1534,6 +1587,49 @@ void CGUIBaseContainer::GetCacheOffsets(int &cacheBefore, int &cacheAfter) const
   }
 }
 
+void CGUIBaseContainer::GetPrefetchOffsets(unsigned int currentTime,
+                                           int& prefetchBefore,
+                                           int& prefetchAfter)
+{
+  prefetchBefore = prefetchAfter = 0;
+
+  const float value = m_scroller.GetValue();
+  if (m_prefetchTime && currentTime > m_prefetchTime && m_layout)
+  {
+    const float elapsed = static_cast<float>(currentTime - m_prefetchTime);
+    const float rowsPerSecond =
+        (value - m_prefetchScrollValue) / m_layout->Size(m_orientation) * 1000.0f / elapsed;
+    // smooth the speed, so the prefetched rows survive the short stops between key repeats
+    m_prefetchSpeed += (rowsPerSecond - m_prefetchSpeed) *
+                       (1.0f - std::exp(-elapsed / PREFETCH_SMOOTHING_TIME));
+  }
+  m_prefetchScrollValue = value;
+  m_prefetchTime = currentTime;
+
+  const int maxRows =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiPrefetchRows;
+  // enough rows to cover the time it takes to load their images
+  const int rows = std::min(
+      maxRows, static_cast<int>(std::lround(std::abs(m_prefetchSpeed) * PREFETCH_LOOKAHEAD_TIME)));
+  if (m_prefetchSpeed > 0)
+    prefetchAfter = rows;
+  else
+    prefetchBefore = rows;
+}
+
+void CGUIBaseContainer::ProcessPrefetchItem(float posX,
+                                            float posY,
+                                            std::shared_ptr<CGUIListItem>& item,
+                                            unsigned int currentTime)
+{
+  // the item is offscreen, so whatever it marks dirty doesn't need to be rendered
+  CDirtyRegionList dirtyregions;
+  CGUILargeTextureManager& largeTextureManager = CServiceBroker::GetGUI()->GetLargeTextureManager();
+  largeTextureManager.SetPrefetching(true);
+  ProcessItem(posX, posY, item, false, currentTime, dirtyregions);
+  largeTextureManager.SetPrefetching(false);
+}
+
 void CGUIBaseContainer::SetCursor(int cursor)
 {
   if (m_cursor != cursor)
@@ -175,6 +175,21 @@ protected:
 
   void UpdateScrollByLetter();
   void GetCacheOffsets(int &cacheBefore, int &cacheAfter) const;
+
+  /*! \brief Get the number of rows to prefetch beyond the cached ones
+   Follows the scroll direction and grows with the scroll speed, up to the <prefetchrows> of the
+   advanced settings. Must be called once per frame, as it updates the scroll speed.
+   */
+  void GetPrefetchOffsets(unsigned int currentTime, int& prefetchBefore, int& prefetchAfter);
+
+  /*! \brief Process an offscreen item, so the images it will show are loaded at low priority
+   \sa CGUILargeTextureManager::SetPrefetching
+   */
+  void ProcessPrefetchItem(float posX,
+                           float posY,
+                           std::shared_ptr<CGUIListItem>& item,
+                           unsigned int currentTime);
+
   int GetCacheCount() const { return m_cacheItems; }
   bool ScrollingDown() const { return m_scroller.IsScrollingDown(); }
   bool ScrollingUp() const { return m_scroller.IsScrollingUp(); }
@@ -248,6 +263,11 @@ private:
   // early inertial scroll cancellation
   bool m_waitForScrollEnd = false;
   float m_lastScrollValue = 0.0f;
+
+  // scroll speed in rows per second, smoothed for prefetching
+  float m_prefetchSpeed = 0.0f;
+  float m_prefetchScrollValue = 0.0f;
+  unsigned int m_prefetchTime = 0;
 };
 
 
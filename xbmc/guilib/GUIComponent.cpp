@@ -12,6 +12,7 @@
 #include "GUIColorManager.h"
 #include "GUIInfoManager.h"
 #include "GUILargeTextureManager.h"
+#include "GUITextureBudget.h"
 #include "GUITextureCallbackManager.h"
 #include "GUIWindowManager.h"
 #include "ServiceBroker.h"
@@ -27,6 +28,8 @@ CGUIComponent::CGUIComponent()
   : m_pWindowManager(std::make_unique<CGUIWindowManager>()),
     m_pTextureManager(std::make_unique<CGUITextureManager>()),
     m_pLargeTextureManager(std::make_unique<CGUILargeTextureManager>()),
+    m_textureBudget(
+        std::make_unique<CGUITextureBudget>(*m_pTextureManager, *m_pLargeTextureManager)),
     m_pTextureCallbackManager(std::make_unique<CGUITextureCallbackManager>()),
     m_stereoscopicsManager(std::make_unique<CStereoscopicsManager>()),
     m_guiInfoManager(std::make_unique<CGUIInfoManager>()),
@@ -80,6 +83,11 @@ CGUILargeTextureManager& CGUIComponent::GetLargeTextureManager()
   return *m_pLargeTextureManager;
 }
 
+CGUITextureBudget& CGUIComponent::GetTextureBudget()
+{
+  return *m_textureBudget;
+}
+
 CGUITextureCallbackManager& CGUIComponent::GetTextureCallbackManager()
 {
   return *m_pTextureCallbackManager;
@@ -9,20 +9,30 @@
 #include "GUIFontTTF.h"
 
 #include "GUIFontManager.h"
+#include "GUIFrameProfiler.h"
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "URL.h"
+#include "filesystem/Directory.h"
 #include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
 #include "rendering/RenderSystem.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
 #include "threads/SystemClock.h"
+#include "utils/Crc32.h"
 #include "utils/MathUtils.h"
+#include "utils/StringUtils.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <cstring>
+#include <map>
 #include <math.h>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <utility>
 
@@ -60,6 +70,61 @@ constexpr int GLYPH_STRENGTH_BOLD = 24;
 constexpr int GLYPH_STRENGTH_LIGHT = -48;
 constexpr int TAB_SPACE_LENGTH = 4;
 
+constexpr char GLYPH_CACHE_PATH[] = "special://temp/fontcache/";
+constexpr uint32_t GLYPH_CACHE_VERSION = 1;
+
+/*!
+ \brief Header of a glyph cache file. It is followed by the characters and the used rows of
+ the texture. The files are only read by the machine that wrote them, so the native layout
+ is used.
+ */
+struct GlyphCacheHeader
+{
+  char magic[4];
+  uint32_t version;
+  uint32_t freetypeVersion;
+  uint32_t characterSize;
+  uint32_t textureWidth;
+  uint32_t textureHeight;
+  uint32_t cellBaseLine;
+  uint32_t cellHeight;
+  int32_t posX;
+  int32_t posY;
+  uint32_t maxFontHeight;
+  uint32_t characters;
+};
+
+constexpr char GLYPH_CACHE_MAGIC[4] = {'K', 'G', 'L', 'C'};
+constexpr uint32_t FREETYPE_VERSION = (FREETYPE_MAJOR << 16) | (FREETYPE_MINOR << 8) | FREETYPE_PATCH;
+
+// \brief Get a hash of the contents of a font file, computed once per file
+uint32_t GetFontFileHash(const std::string& filename, FT_Face face)
+{
+  static CCriticalSection section;
+  static std::map<std::string, uint32_t> hashes;
+
+  std::unique_lock lock(section);
+  auto it = hashes.find(filename);
+  if (it != hashes.end())
+    return it->second;
+
+  Crc32 crc;
+  if (face->stream->base)
+  {
+    // freetype maps the file or reads it from memory, no need to read it again
+    crc.Compute(reinterpret_cast<const char*>(face->stream->base), face->stream->size);
+  }
+  else
+  {
+    std::vector<uint8_t> buffer;
+    XFILE::CFile file;
+    if (file.LoadFile(filename, buffer) <= 0)
+      return 0;
+    crc.Compute(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+  }
+  return hashes[filename] = crc;
+}
+
 // \brief Check for conflicting alignments
 void ValidateAlignments(uint32_t& aligns)
 {
@@ -201,6 +266,7 @@ CGUIFontTTF::CGUIFontTTF(const std::string& fontIdent)
 
 CGUIFontTTF::~CGUIFontTTF(void)
 {
+  SaveGlyphCache();
   Clear();
 }
 
@@ -232,6 +298,7 @@ void CGUIFontTTF::ClearCharacterCache()
   m_posX = m_textureWidth;
   m_posY = -static_cast<int>(GetTextureLineHeight());
   m_textureHeight = 0;
+  m_glyphCacheSize = 0;
 }
 
 void CGUIFontTTF::Clear()
@@ -337,6 +404,21 @@ bool CGUIFontTTF::Load(
   m_posX = m_textureWidth;
   m_posY = -static_cast<int>(GetTextureLineHeight());
 
+  // the characters are cached per font file, size and border, the styles share one texture
+  m_glyphCacheFile.clear();
+  if (HasTexturePixels() &&
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiFontGlyphCache)
+  {
+    const uint32_t hash = GetFontFileHash(strFilename, m_face);
+    if (hash)
+    {
+      m_glyphCacheFile = StringUtils::Format(
+          "{}{:08x}-{}-{}{}.glyphs", GLYPH_CACHE_PATH, hash, MathUtils::round_int(height * 100.0),
+          MathUtils::round_int(aspect * 100.0), border ? "-border" : "");
+      LoadGlyphCache();
+    }
+  }
+
   return true;
 }
 
@@ -991,6 +1073,13 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
   m_nestedBeginCount = nestedBeginCount;
 
   // update the lookup table with only the m_char addresses that have changed
+  UpdateCharQuick(startIndex);
+
+  return m_char.data() + low;
+}
+
+void CGUIFontTTF::UpdateCharQuick(size_t startIndex)
+{
   for (size_t i = startIndex; i < m_char.size(); ++i)
   {
     if (m_char[i].m_glyphIndex < MAX_GLYPH_IDX)
@@ -1002,12 +1091,128 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
         m_charquick[ch] = m_char.data() + i;
     }
   }
+}
 
-  return m_char.data() + low;
+bool CGUIFontTTF::LoadGlyphCache()
+{
+  std::vector<uint8_t> buffer;
+  XFILE::CFile file;
+  if (!XFILE::CFile::Exists(m_glyphCacheFile) || file.LoadFile(m_glyphCacheFile, buffer) <= 0)
+    return false;
+
+  GlyphCacheHeader header;
+  if (buffer.size() < sizeof(header))
+    return false;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+
+  const size_t charactersSize = static_cast<size_t>(header.characters) * sizeof(Character);
+  const size_t rows = std::min(header.maxFontHeight, header.textureHeight);
+  if (std::memcmp(header.magic, GLYPH_CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+      header.version != GLYPH_CACHE_VERSION || header.freetypeVersion != FREETYPE_VERSION ||
+      header.characterSize != sizeof(Character) || header.textureWidth != m_textureWidth ||
+      header.cellBaseLine != m_cellBaseLine || header.cellHeight != m_cellHeight ||
+      header.characters == 0 || header.textureHeight == 0 ||
+      header.textureHeight > m_renderSystem->GetMaxTextureSize() ||
+      buffer.size() != sizeof(header) + charactersSize + rows * m_textureWidth)
+  {
+    CLog::LogF(LOGDEBUG, "Ignoring outdated glyph cache {}", m_glyphCacheFile);
+    return false;
+  }
+
+  // the render system may pad the height differently than when the cache was written, in which
+  // case the texture is dropped again and the characters are cached one by one as usual
+  const unsigned int textureWidth = m_textureWidth;
+  const float textureScaleX = m_textureScaleX;
+  unsigned int newHeight = header.textureHeight;
+  std::unique_ptr<CTexture> newTexture = ReallocTexture(newHeight);
+  if (!newTexture || m_textureHeight != header.textureHeight)
+  {
+    CLog::LogF(LOGDEBUG, "Unable to allocate a texture of height {} for glyph cache {}",
+               header.textureHeight, m_glyphCacheFile);
+    m_textureWidth = textureWidth;
+    m_textureScaleX = textureScaleX;
+    ClearCharacterCache();
+    return false;
+  }
+  m_texture = std::move(newTexture);
+
+  // copy all cached characters at once, the same way a single one would be
+  FT_BitmapGlyphRec atlas{};
+  atlas.bitmap.width = m_textureWidth;
+  atlas.bitmap.rows = rows;
+  atlas.bitmap.pitch = m_textureWidth;
+  atlas.bitmap.buffer = buffer.data() + sizeof(header) + charactersSize;
+  if (rows > 0 && !CopyCharToTexture(&atlas, 0, 0, m_textureWidth, rows))
+  {
+    ClearCharacterCache();
+    return false;
+  }
+
+  m_char.resize(header.characters);
+  std::memcpy(m_char.data(), buffer.data() + sizeof(header), charactersSize);
+  UpdateCharQuick(0);
+
+  m_posX = header.posX;
+  m_posY = header.posY;
+  m_maxFontHeight = header.maxFontHeight;
+  m_glyphCacheSize = m_char.size();
+
+  CLog::LogF(LOGDEBUG, "Restored {} characters of font {} from the glyph cache", m_char.size(),
+             m_fontIdent);
+  return true;
+}
+
+void CGUIFontTTF::SaveGlyphCache()
+{
+  // only save if characters were added since the cache was loaded
+  if (m_glyphCacheFile.empty() || m_char.size() <= m_glyphCacheSize || !m_texture ||
+      !m_texture->GetPixels())
+    return;
+
+  GlyphCacheHeader header;
+  std::memcpy(header.magic, GLYPH_CACHE_MAGIC, sizeof(header.magic));
+  header.version = GLYPH_CACHE_VERSION;
+  header.freetypeVersion = FREETYPE_VERSION;
+  header.characterSize = sizeof(Character);
+  header.textureWidth = m_textureWidth;
+  header.textureHeight = m_textureHeight;
+  header.cellBaseLine = m_cellBaseLine;
+  header.cellHeight = m_cellHeight;
+  header.posX = m_posX;
+  header.posY = m_posY;
+  header.maxFontHeight = m_maxFontHeight;
+  header.characters = static_cast<uint32_t>(m_char.size());
+
+  const unsigned int rows = std::min(m_maxFontHeight, m_textureHeight);
+  std::vector<uint8_t> buffer(sizeof(header) + m_char.size() * sizeof(Character) +
+                              rows * m_textureWidth);
+  uint8_t* data = buffer.data();
+  std::memcpy(data, &header, sizeof(header));
+  data += sizeof(header);
+  std::memcpy(data, m_char.data(), m_char.size() * sizeof(Character));
+  data += m_char.size() * sizeof(Character);
+  const uint8_t* pixels = m_texture->GetPixels();
+  for (unsigned int y = 0; y < rows; ++y, data += m_textureWidth)
+    std::memcpy(data, pixels + y * m_texture->GetPitch(), m_textureWidth);
+
+  XFILE::CFile file;
+  if (!XFILE::CDirectory::Exists(GLYPH_CACHE_PATH))
+    XFILE::CDirectory::Create(GLYPH_CACHE_PATH);
+  if (!file.OpenForWrite(m_glyphCacheFile, true) ||
+      file.Write(buffer.data(), buffer.size()) != static_cast<ssize_t>(buffer.size()))
+  {
+    CLog::LogF(LOGWARNING, "Unable to write glyph cache {}", m_glyphCacheFile);
+    return;
+  }
+  m_glyphCacheSize = m_char.size();
 }
 
 bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character* ch)
 {
+  CGUIFrameProfilerScope profile("CacheCharacter", "font");
+  if (profile.IsActive())
+    profile.SetDetail(m_fontIdent);
+
   FT_Glyph glyph = nullptr;
   if (FT_Load_Glyph(m_face, glyphIndex, FT_LOAD_TARGET_LIGHT))
   {
@@ -190,6 +190,11 @@ protected:
                                  unsigned int y2) = 0;
   virtual void DeleteHardwareTexture() = 0;
 
+  /*! \brief Whether m_texture keeps the pixels of the cached characters in memory, which is
+   required to save them to the glyph cache.
+   */
+  virtual bool HasTexturePixels() const { return false; }
+
   // modifying glyphs
   void SetGlyphStrength(FT_GlyphSlot slot, int glyphStrength);
   static void ObliqueGlyph(FT_GlyphSlot slot);
@@ -278,6 +283,16 @@ protected:
 
 private:
   float GetTabSpaceLength();
+  void UpdateCharQuick(size_t startIndex);
+
+  /*! \brief Restore the characters cached by a previous run from the glyph cache
+   \return true if the texture was filled from the glyph cache
+   */
+  bool LoadGlyphCache();
+  void SaveGlyphCache();
+
+  std::string m_glyphCacheFile; // empty if the glyph cache isn't used
+  size_t m_glyphCacheSize{0}; // number of characters the glyph cache file holds
 
   virtual bool FirstBegin() = 0;
   virtual void LastEnd() = 0;
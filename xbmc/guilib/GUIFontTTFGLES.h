@@ -37,6 +37,7 @@ protected:
                          unsigned int x2,
                          unsigned int y2) override;
   void DeleteHardwareTexture() override;
+  bool HasTexturePixels() const override { return true; }
 
   static GLuint m_elementArrayHandle;
 
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameProfiler.h"
+
+#include "ServiceBroker.h"
+#include "filesystem/File.h"
+#include "jobs/JobManager.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/TimeUtils.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+// bounds the memory used by a trace, a frame usually takes a few dozen events
+constexpr size_t MAX_EVENTS = 1 << 17;
+} // namespace
+
+std::atomic<bool> CGUIFrameProfiler::m_recording{false};
+
+CGUIFrameProfiler& CGUIFrameProfiler::GetInstance()
+{
+  static CGUIFrameProfiler instance;
+  return instance;
+}
+
+void CGUIFrameProfiler::Start(unsigned int frames, const std::string& file)
+{
+  std::unique_lock lock(m_critSection);
+  // a trace still being saved keeps the previous recording
+  m_trace = std::make_shared<Trace>();
+  m_maxFrames = std::max(frames, 1u);
+  m_file = file;
+  m_trace->start = m_frameStart = CurrentHostCounter();
+  m_recording = true;
+
+  CLog::Log(LOGINFO, "GUI frame profiler: recording {} frames", m_maxFrames);
+}
+
+void CGUIFrameProfiler::Stop()
+{
+  m_recording = false;
+}
+
+void CGUIFrameProfiler::EndFrame()
+{
+  if (!IsRecording())
+    return;
+
+  std::unique_lock lock(m_critSection);
+  const int64_t now = CurrentHostCounter();
+  AddEvent("Frame", "frame", m_frameStart, now, std::to_string(m_trace->frames));
+  m_frameStart = now;
+
+  if (++m_trace->frames < m_maxFrames)
+    return;
+
+  m_recording = false;
+  if (m_file.empty())
+    return;
+
+  CServiceBroker::GetJobManager()->Submit(
+      [trace = std::shared_ptr<const Trace>(m_trace), file = m_file]
+      {
+        if (WriteTrace(*trace, file))
+          CLog::Log(LOGINFO, "GUI frame profiler: saved {} frames with {} events to {}",
+                    trace->frames, trace->events.size(), file);
+      });
+}
+
+void CGUIFrameProfiler::AddEvent(
+    const char* name, const char* category, int64_t start, int64_t end, std::string detail)
+{
+  std::unique_lock lock(m_critSection);
+  if (!IsRecording())
+    return;
+
+  if (m_trace->events.size() >= MAX_EVENTS)
+  {
+    m_trace->dropped++;
+    return;
+  }
+  m_trace->events.push_back(
+      {name, category, start, end, std::this_thread::get_id(), std::move(detail)});
+}
+
+CVariant CGUIFrameProfiler::GetTrace() const
+{
+  std::unique_lock lock(m_critSection);
+  return CreateTrace(*m_trace);
+}
+
+CVariant CGUIFrameProfiler::CreateTrace(const Trace& recorded)
+{
+  const double usPerTick = 1000000.0 / CurrentHostFrequency();
+
+  CVariant trace(CVariant::VariantTypeObject);
+  trace["displayTimeUnit"] = "ms";
+  trace["otherData"]["frames"] = recorded.frames;
+  trace["otherData"]["droppedEvents"] = recorded.dropped;
+
+  CVariant& events = trace["traceEvents"];
+  events = CVariant(CVariant::VariantTypeArray);
+  std::vector<std::thread::id> threads;
+  for (const Event& event : recorded.events)
+  {
+    // the trace format wants small numbers for the threads
+    auto thread = std::find(threads.begin(), threads.end(), event.thread);
+    const auto tid = static_cast<int>(std::distance(threads.begin(), thread));
+    if (thread == threads.end())
+    {
+      threads.push_back(event.thread);
+
+      CVariant metadata(CVariant::VariantTypeObject);
+      metadata["name"] = "thread_name";
+      metadata["ph"] = "M";
+      metadata["pid"] = 1;
+      metadata["tid"] = tid;
+      metadata["args"]["name"] = tid == 0 ? std::string("GUI") : "thread " + std::to_string(tid);
+      events.push_back(metadata);
+    }
+
+    CVariant entry(CVariant::VariantTypeObject);
+    entry["name"] = event.name;
+    entry["cat"] = event.category;
+    entry["ph"] = "X";
+    entry["ts"] = (event.start - recorded.start) * usPerTick;
+    entry["dur"] = (event.end - event.start) * usPerTick;
+    entry["pid"] = 1;
+    entry["tid"] = tid;
+    if (!event.detail.empty())
+      entry["args"]["detail"] = event.detail;
+    events.push_back(entry);
+  }
+  return trace;
+}
+
+bool CGUIFrameProfiler::SaveTrace(const std::string& file) const
+{
+  std::shared_ptr<const Trace> trace;
+  {
+    std::unique_lock lock(m_critSection);
+    trace = m_trace;
+  }
+  return WriteTrace(*trace, file);
+}
+
+bool CGUIFrameProfiler::WriteTrace(const Trace& recorded, const std::string& file)
+{
+  std::string json;
+  if (!CJSONVariantWriter::Write(CreateTrace(recorded), json, true))
+    return false;
+
+  XFILE::CFile trace;
+  if (!trace.OpenForWrite(file, true) ||
+      trace.Write(json.c_str(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::Log(LOGERROR, "GUI frame profiler: failed to write {}", file);
+    return false;
+  }
+  return true;
+}
+
+size_t CGUIFrameProfiler::GetEventCount() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_trace->events.size();
+}
+
+CGUIFrameProfilerScope::CGUIFrameProfilerScope(const char* name, const char* category)
+  : m_name(name), m_category(category)
+{
+  if (CGUIFrameProfiler::IsRecording())
+    m_start = CurrentHostCounter();
+}
+
+CGUIFrameProfilerScope::~CGUIFrameProfilerScope()
+{
+  if (m_start)
+    CGUIFrameProfiler::GetInstance().AddEvent(m_name, m_category, m_start, CurrentHostCounter(),
+                                              std::move(m_detail));
+}
@@ -0,0 +1,137 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class CVariant;
+
+/*!
+ \ingroup guilib
+ \brief Records timed sections of the frames rendered by the GUI and exports them as a
+ Chrome trace (chrome://tracing, Perfetto).
+
+ The profiler is always compiled in. While it is not recording, every instrumented section only
+ costs the check of an atomic flag.
+ */
+class CGUIFrameProfiler
+{
+public:
+  static CGUIFrameProfiler& GetInstance();
+  static bool IsRecording() { return m_recording.load(std::memory_order_relaxed); }
+
+  /*! \brief Start recording
+   \param frames number of frames after which recording stops and the trace is saved
+   \param file the file the trace is saved to
+   */
+  void Start(unsigned int frames, const std::string& file);
+
+  /*! \brief Stop recording without saving the trace
+   */
+  void Stop();
+
+  /*! \brief Mark the end of a frame, called once per frame after the GUI was rendered
+
+   After the last frame the trace is saved by a job, so rendering isn't held up by it.
+   */
+  void EndFrame();
+
+  /*! \brief Add a completed section to the trace
+   \param name name of the section, must be a string literal
+   \param category category of the section, must be a string literal
+   \param start host counter at the start of the section
+   \param end host counter at the end of the section
+   \param detail optional details shown with the section
+   */
+  void AddEvent(const char* name,
+                const char* category,
+                int64_t start,
+                int64_t end,
+                std::string detail = {});
+
+  /*! \brief Get the recorded sections in the Chrome trace event format
+   */
+  CVariant GetTrace() const;
+
+  /*! \brief Save the recorded sections in the Chrome trace event format
+   \param file the file to write
+   \return true on success
+   */
+  bool SaveTrace(const std::string& file) const;
+
+  size_t GetEventCount() const;
+
+private:
+  CGUIFrameProfiler() = default;
+  ~CGUIFrameProfiler() = default;
+  CGUIFrameProfiler(const CGUIFrameProfiler&) = delete;
+  CGUIFrameProfiler& operator=(const CGUIFrameProfiler&) = delete;
+
+  struct Event
+  {
+    const char* name;
+    const char* category;
+    int64_t start;
+    int64_t end;
+    std::thread::id thread;
+    std::string detail;
+  };
+
+  /*! \brief The sections of a recording, left alone once recording stopped
+   */
+  struct Trace
+  {
+    std::vector<Event> events;
+    unsigned int dropped = 0;
+    unsigned int frames = 0;
+    int64_t start = 0;
+  };
+
+  static CVariant CreateTrace(const Trace& trace);
+  static bool WriteTrace(const Trace& trace, const std::string& file);
+
+  static std::atomic<bool> m_recording;
+
+  mutable CCriticalSection m_critSection;
+  std::shared_ptr<Trace> m_trace = std::make_shared<Trace>();
+  unsigned int m_maxFrames = 0;
+  int64_t m_frameStart = 0;
+  std::string m_file;
+};
+
+/*!
+ \ingroup guilib
+ \brief Adds the enclosing scope to the trace of the frame profiler if it is recording
+ */
+class CGUIFrameProfilerScope
+{
+public:
+  CGUIFrameProfilerScope(const char* name, const char* category);
+  ~CGUIFrameProfilerScope();
+
+  bool IsActive() const { return m_start != 0; }
+
+  /*! \brief Set details shown with the section, only call if the scope is active
+   */
+  void SetDetail(std::string detail) { m_detail = std::move(detail); }
+
+private:
+  const char* m_name;
+  const char* m_category;
+  int64_t m_start = 0;
+  std::string m_detail;
+};
@@ -16,6 +16,7 @@
 #include "input/actions/ActionIDs.h"
 #include "utils/StringUtils.h"
 
+#include <algorithm>
 #include <cassert>
 
 CGUIPanelContainer::CGUIPanelContainer(int parentID, int controlID, float posX, float posY, float width, float height, ORIENTATION orientation, const CScroller& scroller, int preloadItems)
@@ -45,15 +46,23 @@ void CGUIPanelContainer::Process(unsigned int currentTime, CDirtyRegionList &dir
   int cacheBefore, cacheAfter;
   GetCacheOffsets(cacheBefore, cacheAfter);
 
+  int prefetchBefore, prefetchAfter;
+  GetPrefetchOffsets(currentTime, prefetchBefore, prefetchAfter);
+
   // Free memory not used on screen
-  if ((int)m_items.size() > m_itemsPerPage + cacheBefore + cacheAfter)
-    FreeMemory(CorrectOffset(offset - cacheBefore, 0), CorrectOffset(offset + m_itemsPerPage + 1 + cacheAfter, 0));
+  if ((int)m_items.size() >
+      m_itemsPerPage + cacheBefore + cacheAfter + prefetchBefore + prefetchAfter)
+    FreeMemory(CorrectOffset(offset - cacheBefore - prefetchBefore, 0),
+               CorrectOffset(offset + m_itemsPerPage + 1 + cacheAfter + prefetchAfter, 0));
+  else
+    prefetchBefore = prefetchAfter = 0;
 
   CPoint origin = CPoint(m_posX, m_posY) + m_renderOffset;
   float pos = (m_orientation == VERTICAL) ? origin.y : origin.x;
   float end = (m_orientation == VERTICAL) ? m_posY + m_height : m_posX + m_width;
   pos += (offset - cacheBefore) * m_layout->Size(m_orientation) - m_scroller.GetValue();
   end += cacheAfter * m_layout->Size(m_orientation);
+  const float firstPos = pos;
 
   int current = (offset - cacheBefore) * m_itemsPerRow;
   int col = 0;
@@ -83,6 +92,25 @@ void CGUIPanelContainer::Process(unsigned int currentTime, CDirtyRegionList &dir
     current++;
   }
 
+  // prefetch the rows we are scrolling towards
+  const int firstItem = (offset - cacheBefore) * m_itemsPerRow;
+  auto prefetch = [&](int item)
+  {
+    const float rowPos = firstPos + (item / m_itemsPerRow - (offset - cacheBefore)) *
+                                        m_layout->Size(m_orientation);
+    const float colPos = (item % m_itemsPerRow) *
+                         m_layout->Size(m_orientation == VERTICAL ? HORIZONTAL : VERTICAL);
+    if (m_orientation == VERTICAL)
+      ProcessPrefetchItem(origin.x + colPos, rowPos, m_items[item], currentTime);
+    else
+      ProcessPrefetchItem(rowPos, origin.y + colPos, m_items[item], currentTime);
+  };
+  for (int item = std::max(firstItem - prefetchBefore * m_itemsPerRow, 0); item < firstItem; ++item)
+    prefetch(item);
+  for (int item = current;
+       item < current + prefetchAfter * m_itemsPerRow && item < (int)m_items.size(); ++item)
+    prefetch(item);
+
   // when we are scrolling up, offset will become lower (integer division, see offset calc)
   // to have same behaviour when scrolling down, we need to set page control to offset+1
   UpdatePageControl(offset + (m_scroller.IsScrollingDown() ? 1 : 0));
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUITextureBudget.h"
+
+#include "GUILargeTextureManager.h"
+#include "ServiceBroker.h"
+#include "TextureManager.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/MemUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+namespace
+{
+constexpr uint64_t MiB = 1024 * 1024;
+// never go below this, a skin needs that much to show a single window
+constexpr uint64_t MIN_BUDGET = 64 * MiB;
+} // namespace
+
+CGUITextureBudget::CGUITextureBudget(CGUITextureManager& textureManager,
+                                     CGUILargeTextureManager& largeTextureManager)
+  : m_textureManager(textureManager), m_largeTextureManager(largeTextureManager)
+{
+  KODI::MEMORY::MemoryStatus status{};
+  KODI::MEMORY::GetMemoryStatus(&status);
+  m_defaultBudget = std::max(status.totalPhys / 8, MIN_BUDGET);
+}
+
+uint64_t CGUITextureBudget::GetBudget() const
+{
+  const auto settings = CServiceBroker::GetSettingsComponent();
+  if (settings && settings->GetAdvancedSettings()->m_guiTextureMemoryBudget > 0)
+    return std::max(settings->GetAdvancedSettings()->m_guiTextureMemoryBudget * MiB, MIN_BUDGET);
+
+  return m_defaultBudget;
+}
+
+void CGUITextureBudget::Process()
+{
+  unsigned int lowMemory = 0;
+  if (m_lowMemory.exchange(false))
+  {
+    uint64_t unused = 0;
+    m_largeTextureManager.GetMemoryUsage(unused);
+    unused += m_textureManager.GetUnusedMemoryUsage();
+
+    m_largeTextureManager.CleanupUnusedImages(true);
+    m_textureManager.FreeUnusedTextures();
+    CLog::Log(LOGINFO, "CGUITextureBudget: low memory, freed {} KiB of unused textures",
+              unused / 1024);
+    lowMemory++;
+  }
+
+  uint64_t unused = 0;
+  uint64_t resident = m_largeTextureManager.GetMemoryUsage(unused);
+  resident += m_textureManager.GetMemoryUsage();
+  const uint64_t textureManagerUnused = m_textureManager.GetUnusedMemoryUsage();
+  resident += textureManagerUnused;
+  unused += textureManagerUnused;
+
+  // free the least recently used textures of both managers until we are within budget
+  const uint64_t budget = GetBudget();
+  unsigned int evicted = 0;
+  while (resident > budget)
+  {
+    std::chrono::steady_clock::time_point released;
+    std::chrono::steady_clock::time_point largeReleased;
+    const bool hasUnused = m_textureManager.GetOldestUnused(released);
+    const bool largeHasUnused = m_largeTextureManager.GetOldestUnused(largeReleased);
+
+    uint64_t freed = 0;
+    if (largeHasUnused && (!hasUnused || largeReleased < released))
+      freed = m_largeTextureManager.FreeOldestUnused();
+    else if (hasUnused)
+      freed = m_textureManager.FreeOldestUnused();
+    else
+      break; // everything left is in use
+
+    resident -= std::min(freed, resident);
+    unused -= std::min(freed, unused);
+    evicted++;
+  }
+
+  if (evicted)
+    CLog::Log(LOGDEBUG, "CGUITextureBudget: freed {} unused textures, {} KiB of {} KiB used",
+              evicted, resident / 1024, budget / 1024);
+
+  std::unique_lock lock(m_section);
+  m_stats.residentBytes = resident;
+  m_stats.unusedBytes = unused;
+  m_stats.budgetBytes = budget;
+  m_stats.evicted += evicted;
+  m_stats.lowMemory += lowMemory;
+}
+
+void CGUITextureBudget::OnLowMemory()
+{
+  m_lowMemory = true;
+}
+
+CGUITextureBudget::Stats CGUITextureBudget::GetStats() const
+{
+  std::unique_lock lock(m_section);
+  return m_stats;
+}
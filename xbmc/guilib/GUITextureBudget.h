@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <cstdint>
+
+class CGUILargeTextureManager;
+class CGUITextureManager;
+
+/*!
+ \ingroup textures
+ \brief Keeps the memory used by the textures of the GUI within a budget.
+
+ Textures no longer in use are kept for a while by CGUITextureManager and CGUILargeTextureManager,
+ so they can be reused. Once the textures of both managers exceed the budget, the unused ones are
+ freed least recently used first. On low memory all unused textures are freed.
+
+ The budget is set by <gui><texturememorybudget> of the advanced settings in MiB, by default it's
+ an eighth of the physical memory.
+ */
+class CGUITextureBudget
+{
+public:
+  CGUITextureBudget(CGUITextureManager& textureManager,
+                    CGUILargeTextureManager& largeTextureManager);
+
+  /*!
+   \brief Free unused textures until the budget is met (called from app thread only)
+   */
+  void Process();
+
+  /*!
+   \brief Free all unused textures on the next Process(), may be called from any thread
+   */
+  void OnLowMemory();
+
+  struct Stats
+  {
+    uint64_t residentBytes{0}; ///< memory used by all textures
+    uint64_t unusedBytes{0}; ///< memory used by the textures kept for reuse
+    uint64_t budgetBytes{0};
+    unsigned int evicted{0}; ///< textures freed to meet the budget
+    unsigned int lowMemory{0}; ///< low memory notifications handled
+  };
+
+  /*!
+   \brief Get the memory usage as of the last Process()
+   */
+  Stats GetStats() const;
+
+private:
+  uint64_t GetBudget() const;
+
+  CGUITextureManager& m_textureManager;
+  CGUILargeTextureManager& m_largeTextureManager;
+
+  uint64_t m_defaultBudget;
+  std::atomic<bool> m_lowMemory{false};
+
+  mutable CCriticalSection m_section;
+  Stats m_stats;
+};
@@ -10,6 +10,7 @@
 
 #include "GUIAudioManager.h"
 #include "GUIDialog.h"
+#include "GUIFrameProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIPassword.h"
 #include "GUITexture.h"
@@ -66,6 +67,7 @@
 #include "windows/GUIWindowStartup.h"
 #include "windows/GUIWindowSystemInfo.h"
 
+#include <chrono>
 #include <mutex>
 
 // Dialog includes
@@ -1233,6 +1235,7 @@ void CGUIWindowManager::Process(unsigned int currentTime)
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  CGUIFrameProfilerScope profile("Process", "gui");
 
   m_dirtyregions.clear();
 
@@ -1292,6 +1295,7 @@ void CGUIWindowManager::MarkDirty(const CRect& rect)
 
 void CGUIWindowManager::RenderPass() const
 {
+  CGUIFrameProfilerScope profile("RenderPass", "gui");
   if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiFrontToBackRendering)
     RenderPassDual();
   else
@@ -1374,20 +1378,31 @@ bool CGUIWindowManager::Render()
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  CGUIFrameProfilerScope profile("Render", "gui");
 
   int bufferAge = CServiceBroker::GetWinSystem()->GetBufferAge();
   bool visualizeDirtyRegions =
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiVisualizeDirtyRegions;
   if (visualizeDirtyRegions)
     bufferAge = 20;
-  if (bufferAge)
-    m_tracker.CleanMarkedRegions(bufferAge + 1);
-  else
-    m_tracker.CleanMarkedRegions(10);
 
-  CDirtyRegionList dirtyRegions = m_tracker.GetDirtyRegions();
+  CDirtyRegionList dirtyRegions;
+  {
+    CGUIFrameProfilerScope solve("SolveDirtyRegions", "gui");
+    if (bufferAge)
+      m_tracker.CleanMarkedRegions(bufferAge + 1);
+    else
+      m_tracker.CleanMarkedRegions(10);
+
+    dirtyRegions = m_tracker.GetDirtyRegions();
+    if (solve.IsActive())
+      solve.SetDetail(std::to_string(dirtyRegions.size()) + " regions");
+  }
 
   bool hasRendered = false;
+  const CRect viewport = CServiceBroker::GetWinSystem()->GetGfxContext().GetViewWindow();
+  CDirtyRegionList renderedRegions;
+  const auto renderStart = std::chrono::steady_clock::now();
   // If we visualize the regions we will always render the entire viewport
   // If the buffer age is zero, the current content is undefined and has to be rendered
   if (visualizeDirtyRegions || bufferAge == 0 ||
@@ -1396,6 +1411,7 @@ bool CGUIWindowManager::Render()
   {
     RenderPass();
     hasRendered = true;
+    renderedRegions.emplace_back(viewport);
   }
   else if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions == DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE)
   {
@@ -1403,6 +1419,7 @@ bool CGUIWindowManager::Render()
     {
       RenderPass();
       hasRendered = true;
+      renderedRegions.emplace_back(viewport);
     }
   }
   else
@@ -1418,10 +1435,17 @@ bool CGUIWindowManager::Render()
       CServiceBroker::GetWinSystem()->GetGfxContext().SetScissors(i);
       RenderPass();
       hasRendered = true;
+      renderedRegions.push_back(i);
     }
     CServiceBroker::GetWinSystem()->GetGfxContext().ResetScissors();
   }
 
+  // the timings let the adaptive solver learn the cost of a pass and of a pixel
+  if (hasRendered)
+    m_tracker.OnRendered(renderedRegions, viewport,
+                         std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::steady_clock::now() - renderStart));
+
   if (visualizeDirtyRegions)
   {
     CServiceBroker::GetWinSystem()->GetGfxContext().SetRenderingResolution(CServiceBroker::GetWinSystem()->GetGfxContext().GetResInfo(), false);
@@ -1435,6 +1459,11 @@ bool CGUIWindowManager::Render()
   return hasRendered;
 }
 
+CDirtyRegionTracker::Stats CGUIWindowManager::GetDirtyRegionStats() const
+{
+  return m_tracker.GetStats();
+}
+
 void CGUIWindowManager::AfterRender()
 {
   CServiceBroker::GetWinSystem()->GetGfxContext().ResetDepth();
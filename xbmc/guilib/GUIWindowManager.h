@@ -108,6 +108,10 @@ public:
 
   void RenderEx() const;
 
+  /*! \brief Get the dirty region solver and the pixels it saved in the last rendered frame
+   */
+  CDirtyRegionTracker::Stats GetDirtyRegionStats() const;
+
   /*! \brief Do any post render activities.
    */
   void AfterRender();
@@ -10,10 +10,14 @@
 
 #include "DirtyRegion.h"
 
+#include <chrono>
+#include <string>
+
 #define DIRTYREGION_SOLVER_FILL_VIEWPORT_ALWAYS 0
 #define DIRTYREGION_SOLVER_UNION 1
 #define DIRTYREGION_SOLVER_COST_REDUCTION 2
 #define DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE 3
+#define DIRTYREGION_SOLVER_ADAPTIVE 4
 
 class IDirtyRegionSolver
 {
@@ -22,4 +26,10 @@ public:
 
   // Takes a number of dirty regions which will become a number of needed rendering passes.
   virtual void Solve(const CDirtyRegionList &input, CDirtyRegionList &output) = 0;
+
+  // Describes the strategy used by the last Solve(), shown in the debug info.
+  virtual std::string GetStrategy() const = 0;
+
+  // Reports how long rendering the regions took, for solvers that adapt to the device.
+  virtual void OnRendered(const CDirtyRegionList& rendered, std::chrono::microseconds duration) {}
 };
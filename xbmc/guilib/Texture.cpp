@@ -249,7 +249,19 @@ bool CTexture::LoadIImage(IImage* pImage,
     return false;
 
   unsigned int maxTextureSize = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
-  if (!pImage->LoadImageFromMemory(buffer, bufSize, maxTextureSize, maxTextureSize))
+
+  // decoders may reduce the resolution of an image as long as it isn't smaller than fitted into
+  // the ideal size, which isn't enough for images stretched or scaled to fill it, nor for centered
+  // ones as they are drawn at the size of the texture
+  unsigned int decodeWidth = maxTextureSize;
+  unsigned int decodeHeight = maxTextureSize;
+  const bool reducedDecode = aspectRatio == CAspectRatio::KEEP && idealWidth && idealHeight;
+  if (reducedDecode)
+  {
+    decodeWidth = std::min(idealWidth, maxTextureSize);
+    decodeHeight = std::min(idealHeight, maxTextureSize);
+  }
+  if (!pImage->LoadImageFromMemory(buffer, bufSize, decodeWidth, decodeHeight))
     return false;
 
   if (pImage->Width() == 0 || pImage->Height() == 0)
@@ -284,6 +296,13 @@ bool CTexture::LoadIImage(IImage* pImage,
         width = (unsigned int)(height * aspect + 0.5f);
       else
         height = heightFromWidth;
+
+      // the texture is fitted into the control when drawn, so don't scale up what was decoded
+      if (reducedDecode && width > pImage->Width())
+      {
+        width = pImage->Width();
+        height = pImage->Height();
+      }
     }
   }
 
@@ -136,6 +136,16 @@ public:
     return !(textureFormat & KD_TEX_FMT_TYPE_MASK) && textureSwizzle == KD_TEX_SWIZ_RGBA;
   }
 
+  /*!
+   * \brief Checks if uploading a texture of the format/swizzle converts the given pixels in place
+   \param format the format of the texture.
+   \return true if UploadFromMemory may write to the pixels passed to it
+   */
+  virtual bool ConvertsInPlace(KD_TEX_FMT textureFormat, KD_TEX_SWIZ textureSwizzle) const
+  {
+    return false;
+  }
+
 private:
   // no copy constructor
   CTexture(const CTexture& copy) = delete;
@@ -26,8 +26,12 @@
 #include "windowing/WinSystem.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <exception>
+#include <memory>
+#include <utility>
 
 #include <lzo/lzo1x.h>
 #include <lzo/lzoconf.h>
@@ -65,6 +69,16 @@ void CTextureBundleXBT::CloseBundle()
     XFILE::CXbtManager::GetInstance().Release(CURL(m_path));
     CLog::Log(LOGDEBUG, "{} - Closed {}bundle", __FUNCTION__, m_themeBundle ? "theme " : "");
   }
+
+  if (m_loadedFrames > 0)
+  {
+    const std::chrono::duration<double, std::milli> loadTime = m_loadTime;
+    CLog::Log(LOGINFO, "{} - Loaded {} textures ({} KiB) from {} in {:.2f} ms", __FUNCTION__,
+              m_loadedFrames, m_loadedBytes / 1024, m_path, loadTime.count());
+    m_loadedFrames = 0;
+    m_loadedBytes = 0;
+    m_loadTime = {};
+  }
 }
 
 bool CTextureBundleXBT::OpenBundle()
@@ -211,45 +225,68 @@ std::optional<CTextureBundleXBT::Animation> CTextureBundleXBT::LoadAnim(const st
 std::unique_ptr<CTexture> CTextureBundleXBT::ConvertFrameToTexture(const std::string& name,
                                                                    const CXBTFFrame& frame)
 {
-  // found texture - allocate the necessary buffers
-  std::vector<unsigned char> buffer(static_cast<size_t>(frame.GetPackedSize()));
+  const auto start = std::chrono::steady_clock::now();
 
-  // load the compressed texture
-  if (!m_XBTFReader->Load(frame, buffer.data()))
+  // use the compressed texture straight from the mapped bundle if possible, otherwise load it
+  std::unique_ptr<uint8_t[]> packed;
+  const uint8_t* data = m_XBTFReader->GetFrameData(frame);
+  if (data == nullptr)
   {
-    CLog::Log(LOGERROR, "Error loading texture: {}", name);
-    return {};
+    packed = std::make_unique_for_overwrite<uint8_t[]>(static_cast<size_t>(frame.GetPackedSize()));
+    if (!m_XBTFReader->Load(frame, packed.get()))
+    {
+      CLog::Log(LOGERROR, "Error loading texture: {}", name);
+      return {};
+    }
+    data = packed.get();
   }
 
+  KD_TEX_FMT format = KD_TEX_FMT_SDR_BGRA8;
+  KD_TEX_ALPHA alpha = frame.HasAlpha() ? KD_TEX_ALPHA_STRAIGHT : KD_TEX_ALPHA_OPAQUE;
+  KD_TEX_SWIZ swizzle = KD_TEX_SWIZ_RGBA;
+  if (frame.GetKDFormatType())
+  {
+    format = frame.GetKDFormat();
+    alpha = frame.GetKDAlpha();
+    swizzle = frame.GetKDSwizzle();
+  }
+
+  // create an xbmc texture
+  std::unique_ptr<CTexture> texture = CTexture::CreateTexture();
+
   // check if it's packed with lzo
+  std::unique_ptr<uint8_t[]> unpacked;
   if (frame.IsPacked())
-  { // unpack
-    std::vector<unsigned char> unpacked(static_cast<size_t>(frame.GetUnpackedSize()));
+  { // unpack, every byte of the buffer is written by the decompressor
+    unpacked =
+        std::make_unique_for_overwrite<uint8_t[]>(static_cast<size_t>(frame.GetUnpackedSize()));
     lzo_uint s = (lzo_uint)frame.GetUnpackedSize();
-    if (lzo1x_decompress_safe(buffer.data(), static_cast<lzo_uint>(buffer.size()), unpacked.data(),
+    if (lzo1x_decompress_safe(data, static_cast<lzo_uint>(frame.GetPackedSize()), unpacked.get(),
                               &s, NULL) != LZO_E_OK ||
         s != frame.GetUnpackedSize())
     {
       CLog::Log(LOGERROR, "Error loading texture: {}: Decompression error", name);
       return {};
     }
-    buffer = std::move(unpacked);
   }
+  else if (packed)
+    unpacked = std::move(packed);
+  else if (texture->ConvertsInPlace(format, swizzle))
+  { // the mapping is read-only, so the pixels are only copied out of it if they get converted
+    unpacked =
+        std::make_unique_for_overwrite<uint8_t[]>(static_cast<size_t>(frame.GetUnpackedSize()));
+    std::memcpy(unpacked.get(), data, static_cast<size_t>(frame.GetUnpackedSize()));
+  }
+  unsigned char* pixels = unpacked ? unpacked.get() : const_cast<uint8_t*>(data);
 
-  // create an xbmc texture
-  std::unique_ptr<CTexture> texture = CTexture::CreateTexture();
+  if (frame.GetKDFormatType() || frame.GetFormat() == XB_FMT_A8R8G8B8)
+    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, pixels, format, alpha,
+                              swizzle);
+
+  m_loadedFrames++;
+  m_loadedBytes += frame.GetUnpackedSize();
+  m_loadTime += std::chrono::steady_clock::now() - start;
 
-  if (frame.GetKDFormatType())
-  {
-    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, buffer.data(),
-                              frame.GetKDFormat(), frame.GetKDAlpha(), frame.GetKDSwizzle());
-  }
-  else if (frame.GetFormat() == XB_FMT_A8R8G8B8)
-  {
-    KD_TEX_ALPHA alpha = frame.HasAlpha() ? KD_TEX_ALPHA_STRAIGHT : KD_TEX_ALPHA_OPAQUE;
-    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, buffer.data(),
-                              KD_TEX_FMT_SDR_BGRA8, alpha, KD_TEX_SWIZ_RGBA);
-  }
   return texture;
 }
 
@@ -272,17 +309,27 @@ std::string CTextureBundleXBT::Normalize(std::string name)
 std::optional<std::vector<uint8_t>> CTextureBundleXBT::UnpackFrame(const CXBTFReader& reader,
                                                                    const CXBTFFrame& frame)
 {
-  // load the compressed texture
-  std::vector<uint8_t> packedBuffer(static_cast<size_t>(frame.GetPackedSize()));
-  if (!reader.Load(frame, packedBuffer.data()))
+  // use the compressed texture from the mapped bundle if possible, otherwise load it
+  const uint8_t* data = reader.GetFrameData(frame);
+  std::vector<uint8_t> packedBuffer;
+  if (data == nullptr)
   {
-    CLog::Log(LOGERROR, "CTextureBundleXBT: error loading frame");
-    return std::nullopt;
+    packedBuffer.resize(static_cast<size_t>(frame.GetPackedSize()));
+    if (!reader.Load(frame, packedBuffer.data()))
+    {
+      CLog::Log(LOGERROR, "CTextureBundleXBT: error loading frame");
+      return std::nullopt;
+    }
+    data = packedBuffer.data();
   }
 
   // if the frame isn't packed there's nothing else to be done
   if (!frame.IsPacked())
+  {
+    if (packedBuffer.empty())
+      packedBuffer.assign(data, data + frame.GetPackedSize());
     return packedBuffer;
+  }
 
   // make sure lzo is initialized
   if (lzo_init() != LZO_E_OK)
@@ -293,7 +340,7 @@ std::optional<std::vector<uint8_t>> CTextureBundleXBT::UnpackFrame(const CXBTFRe
 
   lzo_uint size = static_cast<lzo_uint>(frame.GetUnpackedSize());
   std::vector<uint8_t> unpackedBuffer(static_cast<size_t>(frame.GetUnpackedSize()));
-  if (lzo1x_decompress_safe(packedBuffer.data(), static_cast<lzo_uint>(packedBuffer.size()),
+  if (lzo1x_decompress_safe(data, static_cast<lzo_uint>(frame.GetPackedSize()),
                             unpackedBuffer.data(), &size, nullptr) != LZO_E_OK ||
       size != frame.GetUnpackedSize())
   {
@@ -10,6 +10,7 @@
 
 #include "Texture.h"
 
+#include <chrono>
 #include <cstdint>
 #include <ctime>
 #include <memory>
@@ -69,6 +70,11 @@ private:
 
   time_t m_TimeStamp;
 
+  // load statistics of the open bundle, logged when it's closed
+  unsigned int m_loadedFrames = 0;
+  uint64_t m_loadedBytes = 0;
+  std::chrono::steady_clock::duration m_loadTime{};
+
   bool m_themeBundle;
   std::string m_path;
   std::shared_ptr<CXBTFReader> m_XBTFReader;
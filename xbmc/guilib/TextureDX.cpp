@@ -8,6 +8,7 @@
 
 #include "TextureDX.h"
 
+#include "guilib/GUIFrameProfiler.h"
 #include "utils/MemUtils.h"
 #include "utils/log.h"
 
@@ -76,6 +77,10 @@ void CDXTexture::LoadToGPU()
     return;
   }
 
+  CGUIFrameProfilerScope profile("LoadToGPU", "texture");
+  if (profile.IsActive())
+    profile.SetDetail(std::to_string(m_textureWidth) + "x" + std::to_string(m_textureHeight));
+
   bool needUpdate = true;
   D3D11_USAGE usage = D3D11_USAGE_DEFAULT;
   if (m_format == XB_FMT_RGB8)
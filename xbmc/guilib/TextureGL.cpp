@@ -9,6 +9,7 @@
 #include "TextureGL.h"
 
 #include "ServiceBroker.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/TextureFormats.h"
 #include "guilib/TextureManager.h"
 #include "rendering/GLExtensions.h"
@@ -175,6 +176,10 @@ void CGLTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+
+  CGUIFrameProfilerScope profile("LoadToGPU", "texture");
+  if (profile.IsActive())
+    profile.SetDetail(std::to_string(m_textureWidth) + "x" + std::to_string(m_textureHeight));
   if (m_texture == 0)
   {
     // Have OpenGL generate a texture object handle for us
@@ -9,6 +9,7 @@
 #include "TextureGLES.h"
 
 #include "ServiceBroker.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/TextureFormats.h"
 #include "guilib/TextureManager.h"
 #include "rendering/GLExtensions.h"
@@ -212,6 +213,10 @@ void CGLESTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+
+  CGUIFrameProfilerScope profile("LoadToGPU", "texture");
+  if (profile.IsActive())
+    profile.SetDetail(std::to_string(m_textureWidth) + "x" + std::to_string(m_textureHeight));
   if (m_texture == 0)
   {
     // Have OpenGL generate a texture object handle for us
@@ -403,6 +408,22 @@ void CGLESTexture::SwapBlueRedSwizzle(GLint& component)
     component = GL_RED;
 }
 
+bool CGLESTexture::ConvertsInPlace(KD_TEX_FMT textureFormat, KD_TEX_SWIZ textureSwizzle) const
+{
+  // GetFormatGLES20() swaps blue and red of BGRA textures if the driver can't take them as is
+  if (m_isGLESVersion30orNewer || textureFormat != KD_TEX_FMT_SDR_BGRA8 ||
+      textureSwizzle != KD_TEX_SWIZ_RGBA ||
+      CGLExtensions::IsExtensionSupported(CGLExtensions::EXT_texture_format_BGRA8888) ||
+      CGLExtensions::IsExtensionSupported(CGLExtensions::IMG_texture_format_BGRA8888))
+    return false;
+
+#if defined(GL_APPLE_texture_format_BGRA8888)
+  return !CGLExtensions::IsExtensionSupported(CGLExtensions::APPLE_texture_format_BGRA8888);
+#else
+  return true;
+#endif
+}
+
 TextureFormat CGLESTexture::GetFormatGLES20(KD_TEX_FMT textureFormat)
 {
   TextureFormat glFormat;
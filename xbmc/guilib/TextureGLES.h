@@ -40,6 +40,7 @@ public:
   void LoadToGPU() override;
   void BindToUnit(unsigned int unit) override;
   bool SupportsFormat(KD_TEX_FMT textureFormat, KD_TEX_SWIZ textureSwizzle) override;
+  bool ConvertsInPlace(KD_TEX_FMT textureFormat, KD_TEX_SWIZ textureSwizzle) const override;
 
   // GLES interface
   GLuint GetTextureID() const;
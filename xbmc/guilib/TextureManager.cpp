@@ -541,6 +541,42 @@ void CGUITextureManager::FreeUnusedTextures(unsigned int timeDelay)
   m_unusedHwTextures.clear();
 }
 
+uint64_t CGUITextureManager::GetUnusedMemoryUsage()
+{
+  std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  uint64_t memUsage = 0;
+  for (const auto& unused : m_unusedTextures)
+    memUsage += unused.first->GetMemoryUsage();
+  return memUsage;
+}
+
+bool CGUITextureManager::GetOldestUnused(std::chrono::steady_clock::time_point& released)
+{
+  std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  // textures released immediately have no timestamp, so they come first
+  auto oldest = std::ranges::min_element(m_unusedTextures, {}, [](const auto& unused)
+                                         { return unused.second; });
+  if (oldest == m_unusedTextures.end())
+    return false;
+
+  released = oldest->second;
+  return true;
+}
+
+uint64_t CGUITextureManager::FreeOldestUnused()
+{
+  std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  auto oldest = std::ranges::min_element(m_unusedTextures, {}, [](const auto& unused)
+                                         { return unused.second; });
+  if (oldest == m_unusedTextures.end())
+    return 0;
+
+  const uint64_t memUsage = oldest->first->GetMemoryUsage();
+  delete oldest->first;
+  m_unusedTextures.erase(oldest);
+  return memUsage;
+}
+
 void CGUITextureManager::ReleaseHwTexture(unsigned int texture)
 {
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
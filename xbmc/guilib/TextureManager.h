@@ -120,6 +120,25 @@ public:
 
   void FreeUnusedTextures(unsigned int timeDelay = 0); ///< Free textures (called from app thread only)
   void ReleaseHwTexture(unsigned int texture);
+
+  /*!
+   \brief Get the memory used by the released textures that are kept for reuse, in bytes.
+   */
+  uint64_t GetUnusedMemoryUsage();
+
+  /*!
+   \brief Get the time the least recently used of the released textures was released.
+   \return false if no released textures are kept
+   \sa CGUITextureBudget
+   */
+  bool GetOldestUnused(std::chrono::steady_clock::time_point& released);
+
+  /*!
+   \brief Free the least recently used of the released textures (called from app thread only)
+   \return the memory freed, in bytes
+   \sa CGUITextureBudget
+   */
+  uint64_t FreeOldestUnused();
 protected:
   std::vector<CTextureMap*> m_vecTextures;
   std::list<std::pair<CTextureMap*, std::chrono::time_point<std::chrono::steady_clock>>>
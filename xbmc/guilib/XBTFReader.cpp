@@ -14,6 +14,7 @@
 #include "XBTFReader.h"
 #include "guilib/XBTF.h"
 #include "utils/EndianSwap.h"
+#include "utils/log.h"
 
 #ifdef TARGET_WINDOWS
 #include "filesystem/SpecialProtocol.h"
@@ -21,6 +22,14 @@
 #include "platform/win32/PlatformDefs.h"
 #endif
 
+#if defined(TARGET_POSIX)
+#include "platform/posix/utils/Mmap.h"
+
+#include <system_error>
+
+#include <sys/stat.h>
+#endif
+
 static bool ReadString(FILE* file, char* str, size_t max_length)
 {
   if (file == nullptr || str == nullptr || max_length <= 0)
@@ -174,6 +183,24 @@ bool CXBTFReader::Open(const std::string& path)
   if (pos != GetHeaderSize())
     return false;
 
+#if defined(TARGET_POSIX)
+  // map the whole file so frames can be used without reading them into a buffer first
+  struct stat fileStat;
+  if (fstat(fileno(m_file), &fileStat) == 0 && fileStat.st_size > 0)
+  {
+    try
+    {
+      m_map = std::make_unique<KODI::UTILS::POSIX::CMmap>(
+          nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fileno(m_file), 0);
+    }
+    catch (const std::system_error& e)
+    {
+      CLog::Log(LOGDEBUG, "CXBTFReader: unable to map {}, reading frames instead: {}", m_path,
+                e.what());
+    }
+  }
+#endif
+
   return true;
 }
 
@@ -184,6 +211,10 @@ bool CXBTFReader::IsOpen() const
 
 void CXBTFReader::Close()
 {
+#if defined(TARGET_POSIX)
+  m_map.reset();
+#endif
+
   if (m_file != nullptr)
   {
     fclose(m_file);
@@ -211,6 +242,13 @@ bool CXBTFReader::Load(const CXBTFFrame& frame, unsigned char* buffer) const
   if (m_file == nullptr)
     return false;
 
+  const uint8_t* data = GetFrameData(frame);
+  if (data != nullptr)
+  {
+    memcpy(buffer, data, static_cast<size_t>(frame.GetPackedSize()));
+    return true;
+  }
+
 #if defined(TARGET_DARWIN) || defined(TARGET_FREEBSD)
   if (fseeko(m_file, static_cast<off_t>(frame.GetOffset()), SEEK_SET) == -1)
 #elif defined(TARGET_ANDROID)
@@ -225,3 +263,16 @@ bool CXBTFReader::Load(const CXBTFFrame& frame, unsigned char* buffer) const
 
   return true;
 }
+
+const uint8_t* CXBTFReader::GetFrameData(const CXBTFFrame& frame) const
+{
+#if defined(TARGET_POSIX)
+  if (m_map == nullptr || frame.GetOffset() > m_map->Size() ||
+      frame.GetPackedSize() > m_map->Size() - frame.GetOffset())
+    return nullptr;
+
+  return static_cast<const uint8_t*>(m_map->Data()) + frame.GetOffset();
+#else
+  return nullptr;
+#endif
+}
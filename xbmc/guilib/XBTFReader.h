@@ -15,6 +15,13 @@
 #include <string>
 #include <vector>
 
+#if defined(TARGET_POSIX)
+namespace KODI::UTILS::POSIX
+{
+class CMmap;
+}
+#endif
+
 class CXBTFReader : public CXBTFBase
 {
 public:
@@ -29,9 +36,19 @@ public:
 
   bool Load(const CXBTFFrame& frame, unsigned char* buffer) const;
 
+  /*!
+   * \brief Get the packed data of a frame without copying it.
+   * \return pointer to the data inside the memory mapped file, nullptr if the file couldn't be
+   * mapped. The data stays valid until the reader is closed.
+   */
+  const uint8_t* GetFrameData(const CXBTFFrame& frame) const;
+
 private:
   std::string m_path;
   FILE* m_file = nullptr;
+#if defined(TARGET_POSIX)
+  std::unique_ptr<KODI::UTILS::POSIX::CMmap> m_map;
+#endif
 };
 
 typedef std::shared_ptr<CXBTFReader> CXBTFReaderPtr;
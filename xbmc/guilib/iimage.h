@@ -23,6 +23,8 @@ public:
    \param width The ideal width of the texture
    \param height The ideal height of the texture
    \return true if the image could be loaded
+   \note Loaders may reduce the resolution of large images, Width() and Height() then return
+   the reduced size. The image is never reduced below its size when fitted into the ideal size.
    */
   virtual bool LoadImageFromMemory(unsigned char* buffer, unsigned int bufSize, unsigned int width, unsigned int height)=0;
   /*!
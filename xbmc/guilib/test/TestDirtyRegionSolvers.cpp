@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/DirtyRegionSolvers.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// two small regions in opposite corners of a 1080p viewport
+const CDirtyRegionList CORNERS = {CDirtyRegion(CRect(0, 0, 100, 100)),
+                                  CDirtyRegion(CRect(1820, 980, 1920, 1080))};
+
+// renders frames of varying passes and sizes taking the given costs in microseconds
+void Train(CAdaptiveDirtyRegionSolver& solver, double costPerPass, double costPerMegapixel)
+{
+  for (int frame = 0; frame < 200; frame++)
+  {
+    CDirtyRegionList rendered;
+    const int passes = 1 + frame % 4;
+    const float size = 100.0f + (frame % 7) * 150.0f;
+    for (int pass = 0; pass < passes; pass++)
+      rendered.emplace_back(CRect(pass * size, 0, (pass + 1) * size, size));
+
+    const double pixels = passes * size * size / 1000000.0;
+    solver.OnRendered(rendered, std::chrono::microseconds(static_cast<int64_t>(
+                                    passes * costPerPass + pixels * costPerMegapixel)));
+  }
+}
+} // namespace
+
+TEST(TestDirtyRegionSolvers, Greedy)
+{
+  CGreedyDirtyRegionSolver solver;
+  CDirtyRegionList output;
+  solver.Solve(CORNERS, output);
+  EXPECT_EQ(2u, output.size());
+
+  // regions are merged once a pass costs more than the pixels in between
+  output.clear();
+  solver.SetCosts(1000000.0f, 0.01f);
+  solver.Solve(CORNERS, output);
+  ASSERT_EQ(1u, output.size());
+  EXPECT_EQ(CRect(0, 0, 1920, 1080), output[0]);
+}
+
+TEST(TestDirtyRegionSolvers, AdaptivePixelBound)
+{
+  CAdaptiveDirtyRegionSolver solver;
+  Train(solver, 50.0, 8000.0);
+  EXPECT_NEAR(50.0, solver.GetCostPerPass(), 5.0);
+  EXPECT_NEAR(8000.0, solver.GetCostPerMegapixel(), 100.0);
+
+  CDirtyRegionList output;
+  solver.Solve(CORNERS, output);
+  EXPECT_EQ(2u, output.size());
+  EXPECT_EQ(0u, solver.GetStrategy().find("adaptive cost reduction"));
+}
+
+TEST(TestDirtyRegionSolvers, AdaptivePassBound)
+{
+  CAdaptiveDirtyRegionSolver solver;
+  Train(solver, 20000.0, 100.0);
+  EXPECT_NEAR(20000.0, solver.GetCostPerPass(), 200.0);
+  EXPECT_NEAR(100.0, solver.GetCostPerMegapixel(), 100.0);
+
+  CDirtyRegionList output;
+  solver.Solve(CORNERS, output);
+  ASSERT_EQ(1u, output.size());
+  EXPECT_EQ(CRect(0, 0, 1920, 1080), output[0]);
+
+  // the solver follows when the costs change
+  Train(solver, 50.0, 8000.0);
+  output.clear();
+  solver.Solve(CORNERS, output);
+  EXPECT_EQ(2u, output.size());
+}
+
+TEST(TestDirtyRegionSolvers, AdaptiveOutlier)
+{
+  CAdaptiveDirtyRegionSolver solver;
+  Train(solver, 500.0, 2000.0);
+  const double costPerPass = solver.GetCostPerPass();
+
+  // a frame stalled by loading textures must not throw off the costs
+  solver.OnRendered({CDirtyRegion(CRect(0, 0, 100, 100))}, 2s);
+  EXPECT_LT(solver.GetCostPerPass(), costPerPass * 2);
+}
@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/FFmpegImage.h"
+#include "guilib/TextureFormats.h"
+#include "test/TestUtils.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// 1920x1080, progressive
+constexpr unsigned int WIDTH = 1920;
+constexpr unsigned int HEIGHT = 1080;
+
+std::vector<unsigned char> ReadSplash()
+{
+  std::ifstream file(XBMC_REF_FILE_PATH("media/splash.jpg"), std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+// decodes the image scaled to width x height
+std::vector<uint8_t> Decode(std::vector<unsigned char>& data,
+                            unsigned int idealWidth,
+                            unsigned int idealHeight,
+                            unsigned int width,
+                            unsigned int height)
+{
+  CFFmpegImage image("image/jpeg");
+  if (!image.LoadImageFromMemory(data.data(), static_cast<unsigned int>(data.size()), idealWidth,
+                                 idealHeight))
+    return {};
+
+  std::vector<uint8_t> pixels(width * height * 4);
+  if (!image.Decode(pixels.data(), width, height, width * 4, XB_FMT_A8R8G8B8))
+    return {};
+  return pixels;
+}
+} // namespace
+
+TEST(TestFFmpegImage, ReducedResolution)
+{
+  std::vector<unsigned char> data = ReadSplash();
+  ASSERT_FALSE(data.empty());
+
+  CFFmpegImage full("image/jpeg");
+  ASSERT_TRUE(full.LoadImageFromMemory(data.data(), static_cast<unsigned int>(data.size()), 0, 0));
+  EXPECT_EQ(WIDTH, full.Width());
+  EXPECT_EQ(HEIGHT, full.Height());
+
+  // a quarter is still larger than the image fitted into 400x300, an eighth wouldn't be
+  CFFmpegImage reduced("image/jpeg");
+  ASSERT_TRUE(
+      reduced.LoadImageFromMemory(data.data(), static_cast<unsigned int>(data.size()), 400, 300));
+  EXPECT_EQ(WIDTH / 4, reduced.Width());
+  EXPECT_EQ(HEIGHT / 4, reduced.Height());
+  EXPECT_EQ(WIDTH, reduced.originalWidth());
+  EXPECT_EQ(HEIGHT, reduced.originalHeight());
+
+  // scaled down to the same size, the images only differ by the filtering
+  const std::vector<uint8_t> expected = Decode(data, 0, 0, WIDTH / 4, HEIGHT / 4);
+  const std::vector<uint8_t> actual = Decode(data, 400, 300, WIDTH / 4, HEIGHT / 4);
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected.size(), actual.size());
+  uint64_t difference = 0;
+  for (size_t i = 0; i < expected.size(); i++)
+    difference += std::abs(expected[i] - actual[i]);
+  EXPECT_LT(difference / expected.size(), 4u);
+}
+
+TEST(TestFFmpegImage, DISABLED_Benchmark)
+{
+  std::vector<unsigned char> data = ReadSplash();
+  ASSERT_FALSE(data.empty());
+
+  // decoded for a thumbnail of the default image resolution
+  constexpr int ROUNDS = 20;
+  auto measure = [&data](unsigned int idealWidth, unsigned int idealHeight)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round)
+      EXPECT_FALSE(Decode(data, idealWidth, idealHeight, 640, 360).empty());
+    return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - start)
+                                .count() /
+                            ROUNDS);
+  };
+
+  const int fullUs = measure(0, 0);
+  const int reducedUs = measure(640, 360);
+
+  RecordProperty("FullUs", fullUs);
+  RecordProperty("ReducedUs", reducedUs);
+}
@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "filesystem/File.h"
+#include "guilib/GUIFrameProfiler.h"
+#include "jobs/JobManager.h"
+#include "test/MtTestUtils.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/Variant.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr int SCOPES = 1000000;
+} // namespace
+
+class TestGUIFrameProfiler : public ::testing::Test
+{
+protected:
+  ~TestGUIFrameProfiler() override { profiler.Stop(); }
+
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+};
+
+TEST_F(TestGUIFrameProfiler, RecordsOnlyWhileStarted)
+{
+  {
+    CGUIFrameProfilerScope scope("Idle", "test");
+    EXPECT_FALSE(scope.IsActive());
+  }
+
+  profiler.Start(10, "");
+  EXPECT_TRUE(CGUIFrameProfiler::IsRecording());
+  EXPECT_EQ(0u, profiler.GetEventCount());
+  {
+    CGUIFrameProfilerScope outer("Render", "gui");
+    CGUIFrameProfilerScope inner("LoadToGPU", "texture");
+    ASSERT_TRUE(inner.IsActive());
+    inner.SetDetail("256x256");
+  }
+  profiler.EndFrame();
+  profiler.Stop();
+  {
+    CGUIFrameProfilerScope scope("Stopped", "test");
+  }
+
+  const CVariant trace = profiler.GetTrace();
+  EXPECT_EQ(1, trace["otherData"]["frames"].asInteger());
+  const CVariant& events = trace["traceEvents"];
+  // the name of the thread, both scopes and the frame
+  ASSERT_EQ(4u, events.size());
+  EXPECT_EQ("thread_name", events[0]["name"].asString());
+  EXPECT_EQ("M", events[0]["ph"].asString());
+
+  // scopes are added when they end, so the inner one comes first
+  EXPECT_EQ("LoadToGPU", events[1]["name"].asString());
+  EXPECT_EQ("texture", events[1]["cat"].asString());
+  EXPECT_EQ("X", events[1]["ph"].asString());
+  EXPECT_EQ("256x256", events[1]["args"]["detail"].asString());
+  EXPECT_EQ("Render", events[2]["name"].asString());
+  EXPECT_LE(events[2]["ts"].asDouble(), events[1]["ts"].asDouble());
+  EXPECT_GE(events[2]["dur"].asDouble(), events[1]["dur"].asDouble());
+  EXPECT_EQ("Frame", events[3]["name"].asString());
+  EXPECT_EQ(events[1]["tid"].asInteger(), events[3]["tid"].asInteger());
+}
+
+TEST_F(TestGUIFrameProfiler, StopsAfterFrames)
+{
+  profiler.Start(3, "");
+  for (int i = 0; i < 5; ++i)
+  {
+    CGUIFrameProfilerScope scope("Process", "gui");
+    profiler.EndFrame();
+  }
+  EXPECT_FALSE(CGUIFrameProfiler::IsRecording());
+  EXPECT_EQ(3, profiler.GetTrace()["otherData"]["frames"].asInteger());
+}
+
+TEST_F(TestGUIFrameProfiler, SavesTraceInJob)
+{
+  CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+  const std::string file = "special://temp/TestGUIFrameProfiler.json";
+  XFILE::CFile::Delete(file);
+
+  profiler.Start(2, file);
+  profiler.EndFrame();
+  profiler.EndFrame();
+  EXPECT_FALSE(CGUIFrameProfiler::IsRecording());
+
+  // recording again doesn't touch the trace being saved
+  profiler.Start(2, "");
+  profiler.EndFrame();
+
+  CVariant trace;
+  EXPECT_TRUE(ConditionPoll::poll(
+      [&file, &trace]
+      {
+        std::vector<uint8_t> json;
+        XFILE::CFile loader;
+        return loader.LoadFile(file, json) > 0 &&
+               CJSONVariantParser::Parse(std::string(json.begin(), json.end()), trace);
+      }));
+  EXPECT_EQ(2, trace["otherData"]["frames"].asInteger());
+  EXPECT_EQ(1, profiler.GetTrace()["otherData"]["frames"].asInteger());
+
+  XFILE::CFile::Delete(file);
+  CServiceBroker::GetJobManager()->CancelJobs();
+  CServiceBroker::UnregisterJobManager();
+}
+
+TEST_F(TestGUIFrameProfiler, DISABLED_IdleOverhead)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < SCOPES; ++i)
+  {
+    CGUIFrameProfilerScope scope("Idle", "test");
+  }
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count() /
+                  SCOPES;
+
+  RecordProperty("IdleScopeNs", static_cast<int>(ns));
+}
@@ -16,6 +16,7 @@
 #include "dialogs/GUIDialogNumeric.h"
 #include "filesystem/Directory.h"
 #include "guilib/GUIComponent.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
 #include "guilib/StereoscopicsManager.h"
@@ -34,6 +35,8 @@
 #include "utils/log.h"
 #include "windows/GUIMediaWindow.h"
 
+#include <algorithm>
+
 using namespace KODI;
 
 namespace
@@ -397,6 +400,21 @@ static int ToggleDirty(const std::vector<std::string>&)
 
   return 0;
 }
+
+/*! \brief Record a trace of the frames rendered by the GUI.
+ *  \param params The parameters.
+ *  \details params[0] = Number of frames to record (optional).
+ */
+static int TraceFrames(const std::vector<std::string>& params)
+{
+  int frames = 300;
+  if (!params.empty())
+    frames = std::max(atoi(params[0].c_str()), 1);
+
+  CGUIFrameProfiler::GetInstance().Start(frames, "special://temp/guiframetrace.json");
+
+  return 0;
+}
 } // namespace
 
 // Note: For new Texts with comma add a "\" before!!! Is used for table text.
@@ -580,6 +598,18 @@ static int ToggleDirty(const std::vector<std::string>&)
 ///     ,
 ///     makes dirty regions visible for debugging proposes.
 ///   }
+///   \table_row2_l{
+///     <b>`TraceFrames([frames])`</b>
+///     \anchor Builtin_TraceFrames,
+///     Records the time spent processing and rendering the GUI\, uploading
+///     textures\, caching font glyphs and solving dirty regions. The trace is
+///     saved to special://temp/guiframetrace.json in the Chrome trace event
+///     format\, which can be opened with chrome://tracing or Perfetto.
+///     @param[in] frames                Number of frames to record (default 300).
+///     <p><hr>
+///     @skinning_v22 **[New builtin]** \link Builtin_TraceFrames `TraceFrames([frames])`\endlink
+///     <p>
+///   }
 ///  \table_end
 ///
 
@@ -601,6 +631,7 @@ CBuiltins::CommandMap CGUIBuiltins::GetOperations() const
            {"setproperty",                    {"Sets a window property for the current focused window/dialog (key,value)", 2, SetProperty}},
            {"setstereomode",                  {"Changes the stereo mode of the GUI. Params can be: toggle, next, previous, select, tomono or any of the supported stereomodes (off, split_vertical, split_horizontal, row_interleaved, hardware_based, anaglyph_cyan_red, anaglyph_green_magenta, anaglyph_yellow_blue, monoscopic)", 1, SetStereoMode}},
            {"takescreenshot",                 {"Takes a Screenshot", 0, Screenshot}},
-           {"toggledirtyregionvisualization", {"Enables/disables dirty-region visualization", 0, ToggleDirty}}
+           {"toggledirtyregionvisualization", {"Enables/disables dirty-region visualization", 0, ToggleDirty}},
+           {"traceframes",                    {"Records a trace of the frames rendered by the GUI", 0, TraceFrames}}
          };
 }
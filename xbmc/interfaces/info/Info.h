@@ -16,4 +16,21 @@ namespace INFO
     value unless specifically bound to a given window.
     */
 constexpr int DEFAULT_CONTEXT = 0;
+
+/*! Inputs the value of an info condition depends on
+    @note conditions are only evaluated again once one of their inputs was invalidated, see
+    CGUIInfoManager::ResetCache. Inputs which don't notify about changes (focus, windows, containers
+    and most providers) are all covered by DEPENDS_OTHER and invalidated every frame.
+    */
+enum InfoDependency : unsigned int
+{
+  DEPENDS_NONE = 0, ///< constant, e.g. true or System.Platform.Linux
+  DEPENDS_PLAYER = 1 << 0, ///< state of the player and the playing item
+  DEPENDS_TIME = 1 << 1, ///< wall clock, i.e. System.Time and System.Date
+  DEPENDS_SKIN = 1 << 2, ///< skin settings
+  DEPENDS_LISTITEM = 1 << 3, ///< focused list item
+  DEPENDS_OTHER = 1 << 4, ///< anything else
+  DEPENDS_ALL = (1 << 5) - 1,
+};
+constexpr unsigned int DEPENDS_COUNT = 5;
 } // namespace INFO
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include "Info.h"
+
+#include <array>
 #include <memory>
 #include <string>
 
@@ -16,6 +19,47 @@ class CGUIInfoManager;
 
 namespace INFO
 {
+/*!
+ \ingroup info
+ \brief Tracks which inputs of the info bools changed, one counter per InfoDependency
+ */
+class InfoRefreshCounters
+{
+public:
+  /*! \brief Mark all info bools depending on one of the given inputs as dirty
+   \param dependencies a combination of InfoDependency flags
+   */
+  void Invalidate(unsigned int dependencies)
+  {
+    for (unsigned int i = 0; i < DEPENDS_COUNT; ++i)
+    {
+      if (dependencies & (1u << i))
+        ++m_counters[i];
+    }
+  }
+
+  /*! \brief Get a stamp which changes whenever one of the given inputs is invalidated
+   \param dependencies a combination of InfoDependency flags
+   */
+  unsigned int GetStamp(unsigned int dependencies) const
+  {
+    // the counters only grow, so does their sum
+    unsigned int stamp = 0;
+    for (unsigned int i = 0; i < DEPENDS_COUNT; ++i)
+    {
+      if (dependencies & (1u << i))
+        stamp += m_counters[i];
+    }
+    return stamp;
+  }
+
+  unsigned int m_evaluations = 0; ///< info bools evaluated since the last reset
+  unsigned int m_cached = 0; ///< info bools served from cache since the last reset
+
+private:
+  std::array<unsigned int, DEPENDS_COUNT> m_counters{};
+};
+
 /*!
  \ingroup info
  \brief Base class, wrapping boolean conditions and expressions
@@ -23,7 +67,7 @@ namespace INFO
 class InfoBool
 {
 public:
-  InfoBool(const std::string &expression, int context, unsigned int &refreshCounter);
+  InfoBool(const std::string& expression, int context, InfoRefreshCounters& refresh);
   virtual ~InfoBool() = default;
 
   virtual void Initialize(CGUIInfoManager* infoMgr) { m_infoMgr = infoMgr; }
@@ -36,12 +80,22 @@ public:
   inline bool Get(int contextWindow, const CGUIListItem* item = nullptr)
   {
     if (item && m_listItemDependent)
+    {
       Update(contextWindow, item);
-    else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
+      ++m_refresh.m_evaluations;
+      return m_value;
+    }
+
+    const unsigned int stamp = m_refresh.GetStamp(m_dependencies);
+    if (stamp != m_stamp || !m_evaluated)
     {
       Update(contextWindow, nullptr);
-      m_refreshCounter = m_parentRefreshCounter;
+      ++m_refresh.m_evaluations;
+      m_stamp = stamp;
+      m_evaluated = true;
     }
+    else
+      ++m_refresh.m_cached;
     return m_value;
   }
 
@@ -68,16 +122,24 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+
+  /*! \brief Get the inputs the value of this info bool depends on
+   \return a combination of InfoDependency flags
+   */
+  unsigned int GetDependencies() const { return m_dependencies; }
+
 protected:
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
+  unsigned int m_dependencies = DEPENDS_ALL; ///< inputs which make the cached value stale
   std::string  m_expression;   ///< original expression
   CGUIInfoManager* m_infoMgr;
 
 private:
-  unsigned int m_refreshCounter = 0;
-  unsigned int &m_parentRefreshCounter;
+  bool m_evaluated = false;
+  unsigned int m_stamp = 0;
+  InfoRefreshCounters& m_refresh;
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
@@ -17,10 +17,17 @@
 
 using namespace INFO;
 
+namespace
+{
+// executions of an expression after which its groups are reordered
+constexpr unsigned int REORDER_INTERVAL = 64;
+} // namespace
+
 void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+  m_dependencies = m_infoMgr->GetDependencies(m_condition);
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
@@ -39,6 +46,15 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
     m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
   }
+  Compile();
+
+  // the expression only needs to be evaluated again if one of its operands may have changed
+  m_dependencies = DEPENDS_NONE;
+  for (const Instruction& instruction : m_program)
+  {
+    if (instruction.info)
+      m_dependencies |= instruction.info->GetDependencies();
+  }
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
@@ -46,14 +62,22 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
   // use propagated context in case this info expression has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
-  m_value = m_expression_tree->Evaluate(context, item);
+  m_value = Execute(context, item);
+
+  if (++m_executions == REORDER_INTERVAL)
+  {
+    m_expression_tree->Reorder(m_program);
+    Compile();
+  }
 }
 
 /* Expressions are rewritten at parse time into a form which favours the
- * formation of groups of associative nodes. These groups are then reordered at
- * evaluation time such that nodes whose value renders the evaluation of the
- * remainder of the group unnecessary tend to be evaluated first (these are
- * true nodes for OR subexpressions, or false nodes for AND subexpressions).
+ * formation of groups of associative nodes. The tree is then compiled into a
+ * flat program where every group short-circuits by jumping past its remaining
+ * children. The program records how often each child settled its group (true
+ * nodes for OR subexpressions, false nodes for AND subexpressions) and every
+ * REORDER_INTERVAL executions the groups are reordered so those children are
+ * evaluated first, and the program is compiled again.
  * The end effect is to minimise the number of leaf nodes that need to be
  * evaluated in order to determine the value of the expression. The runtime
  * adaptability has the advantage of not being customised for any particular skin.
@@ -67,9 +91,54 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
  *    operations. So [A|B]|[C|D+[[E|F]|G] becomes A|B|C|[D+[E|F|G]].
  */
 
-bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* item)
+void InfoExpression::Compile()
 {
-  return m_invert ^ m_info->Get(contextWindow, item);
+  m_program.clear();
+  m_expression_tree->Compile(m_program);
+  m_executions = 0;
+
+  // a jump landing on a jump of the opposite kind can't take that one, so skip it
+  for (Instruction& instruction : m_program)
+  {
+    if (instruction.op != OP_JUMP_IF_TRUE && instruction.op != OP_JUMP_IF_FALSE)
+      continue;
+    const opcode_t opposite =
+        instruction.op == OP_JUMP_IF_TRUE ? OP_JUMP_IF_FALSE : OP_JUMP_IF_TRUE;
+    while (instruction.target < m_program.size() && m_program[instruction.target].op == opposite)
+      instruction.target++;
+  }
+}
+
+bool InfoExpression::Execute(int contextWindow, const CGUIListItem* item)
+{
+  bool value = false;
+  for (size_t pc = 0; pc < m_program.size(); ++pc)
+  {
+    Instruction& instruction = m_program[pc];
+    switch (instruction.op)
+    {
+      case OP_GET:
+        value = instruction.info->Get(contextWindow, item);
+        break;
+      case OP_GET_NOT:
+        value = !instruction.info->Get(contextWindow, item);
+        break;
+      case OP_JUMP_IF_TRUE:
+      case OP_JUMP_IF_FALSE:
+        if (value == (instruction.op == OP_JUMP_IF_TRUE))
+        {
+          instruction.taken++;
+          pc = instruction.target - 1;
+        }
+        break;
+    }
+  }
+  return value;
+}
+
+void InfoExpression::InfoLeaf::Compile(Program& program)
+{
+  program.push_back({m_invert ? OP_GET_NOT : OP_GET, m_info.get()});
 }
 
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
@@ -84,7 +153,7 @@ InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
 
 void InfoExpression::InfoAssociativeGroup::AddChild(const InfoSubexpressionPtr &child)
 {
-  m_children.push_front(child); // largely undoes the effect of parsing right-associative
+  m_children.push_front({child}); // largely undoes the effect of parsing right-associative
 }
 
 void InfoExpression::InfoAssociativeGroup::Merge(const std::shared_ptr<InfoAssociativeGroup>& other)
@@ -92,27 +161,32 @@ void InfoExpression::InfoAssociativeGroup::Merge(const std::shared_ptr<InfoAssoc
   m_children.splice(m_children.end(), other->m_children);
 }
 
-bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGUIListItem* item)
+void InfoExpression::InfoAssociativeGroup::Compile(Program& program)
 {
-  /* Handle either AND or OR by using the relation
-   * A AND B == !(!A OR !B)
-   * to convert ANDs into ORs
-   */
-  std::list<InfoSubexpressionPtr>::iterator last = m_children.end();
-  std::list<InfoSubexpressionPtr>::iterator it = m_children.begin();
-  bool use_and = (m_type == NODE_AND);
-  bool result = use_and ^ (*it)->Evaluate(contextWindow, item);
-  while (!result && ++it != last)
+  // the jump after the last child only lands on the end of the group, but counts its settlements
+  // as well, so the last child can be moved to the front like any other
+  const opcode_t jump = m_type == NODE_AND ? OP_JUMP_IF_FALSE : OP_JUMP_IF_TRUE;
+  for (Child& child : m_children)
   {
-    result = use_and ^ (*it)->Evaluate(contextWindow, item);
-    if (result)
-    {
-      /* Move this child to the head of the list so we evaluate faster next time */
-      m_children.push_front(*it);
-      m_children.erase(it);
-    }
+    child.node->Compile(program);
+    child.jump = static_cast<unsigned int>(program.size());
+    program.push_back({jump});
+  }
+
+  const auto end = static_cast<unsigned int>(program.size());
+  for (const Child& child : m_children)
+    program[child.jump].target = end;
+}
+
+void InfoExpression::InfoAssociativeGroup::Reorder(const Program& program)
+{
+  for (Child& child : m_children)
+  {
+    // older history counts half, so the order follows what the skin currently shows
+    child.taken = child.taken / 2 + program[child.jump].taken;
+    child.node->Reorder(program);
   }
-  return use_and ^ result;
+  m_children.sort([](const Child& a, const Child& b) { return a.taken > b.taken; });
 }
 
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
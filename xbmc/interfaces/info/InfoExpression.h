@@ -24,8 +24,8 @@ namespace INFO
 class InfoSingle : public InfoBool
 {
 public:
-  InfoSingle(const std::string& expression, int context, unsigned int& refreshCounter)
-    : InfoBool(expression, context, refreshCounter)
+  InfoSingle(const std::string& expression, int context, InfoRefreshCounters& refresh)
+    : InfoBool(expression, context, refresh)
   {
   }
   void Initialize(CGUIInfoManager* infoMgr) override;
@@ -40,9 +40,11 @@ private:
  */
 class InfoExpression : public InfoBool
 {
+  friend class TestInfoExpressionHelper;
+
 public:
-  InfoExpression(const std::string& expression, int context, unsigned int& refreshCounter)
-    : InfoBool(expression, context, refreshCounter)
+  InfoExpression(const std::string& expression, int context, InfoRefreshCounters& refresh)
+    : InfoBool(expression, context, refresh)
   {
   }
   ~InfoExpression() override = default;
@@ -69,13 +71,33 @@ private:
     NODE_OR,
   } node_type_t;
 
+  typedef enum
+  {
+    OP_GET, // value = condition
+    OP_GET_NOT, // value = !condition
+    OP_JUMP_IF_TRUE, // skip the rest of an OR group
+    OP_JUMP_IF_FALSE, // skip the rest of an AND group
+  } opcode_t;
+
+  // An instruction of the compiled expression
+  struct Instruction
+  {
+    opcode_t op;
+    InfoBool* info = nullptr; // condition of OP_GET and OP_GET_NOT, owned by the expression tree
+    unsigned int target = 0; // where a jump continues
+    unsigned int taken = 0; // how often a jump was taken since the last reordering
+  };
+
+  typedef std::vector<Instruction> Program;
+
   // An abstract base class for nodes in the expression tree
   class InfoSubexpression
   {
   public:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
-    virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
     virtual node_type_t Type() const=0;
+    virtual void Compile(Program& program) = 0;
+    virtual void Reorder(const Program& program) {}
   };
 
   typedef std::shared_ptr<InfoSubexpression> InfoSubexpressionPtr;
@@ -85,8 +107,8 @@ private:
   {
   public:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return NODE_LEAF; }
+    void Compile(Program& program) override;
 
   private:
     InfoPtr m_info;
@@ -100,18 +122,31 @@ private:
     InfoAssociativeGroup(node_type_t type, const InfoSubexpressionPtr &left, const InfoSubexpressionPtr &right);
     void AddChild(const InfoSubexpressionPtr &child);
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return m_type; }
+    void Compile(Program& program) override;
+    void Reorder(const Program& program) override;
 
   private:
+    struct Child
+    {
+      InfoSubexpressionPtr node;
+      unsigned int jump = 0; // index of the jump following the child's code, the last child has one too
+      unsigned int taken = 0; // decaying count of the times the child settled the group
+    };
+
     node_type_t m_type;
-    std::list<InfoSubexpressionPtr> m_children;
+    std::list<Child> m_children;
   };
 
   static operator_t GetOperator(char ch);
   static void OperatorPop(std::stack<operator_t> &operator_stack, bool &invert, std::stack<InfoSubexpressionPtr> &nodes);
   bool Parse(const std::string &expression);
+  void Compile();
+  bool Execute(int contextWindow, const CGUIListItem* item);
+
   InfoSubexpressionPtr m_expression_tree;
+  Program m_program;
+  unsigned int m_executions = 0; ///< executions of the program since it was compiled
 };
 
 };
@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "interfaces/info/InfoBool.h"
+
+#include <gtest/gtest.h>
+
+using namespace INFO;
+
+namespace
+{
+class CountingInfoBool : public InfoBool
+{
+public:
+  CountingInfoBool(unsigned int dependencies, InfoRefreshCounters& refresh)
+    : InfoBool("counting", 0, refresh)
+  {
+    m_dependencies = dependencies;
+  }
+
+  void SetListItemDependent() { m_listItemDependent = true; }
+
+  void Update(int contextWindow, const CGUIListItem* item) override
+  {
+    ++m_updates;
+    m_value = !m_value;
+  }
+
+  int m_updates = 0;
+};
+} // namespace
+
+TEST(TestInfoBool, CachesUntilDependencyChanges)
+{
+  InfoRefreshCounters refresh;
+  CountingInfoBool info(DEPENDS_SKIN, refresh);
+
+  EXPECT_TRUE(info.Get(0));
+  EXPECT_TRUE(info.Get(0));
+  EXPECT_EQ(1, info.m_updates);
+
+  // unrelated inputs keep the cached value
+  refresh.Invalidate(DEPENDS_PLAYER | DEPENDS_TIME | DEPENDS_OTHER);
+  EXPECT_TRUE(info.Get(0));
+  EXPECT_EQ(1, info.m_updates);
+
+  refresh.Invalidate(DEPENDS_SKIN);
+  EXPECT_FALSE(info.Get(0));
+  EXPECT_EQ(2, info.m_updates);
+
+  EXPECT_EQ(2u, refresh.m_evaluations);
+  EXPECT_EQ(2u, refresh.m_cached);
+}
+
+TEST(TestInfoBool, ConstantIsEvaluatedOnce)
+{
+  InfoRefreshCounters refresh;
+  CountingInfoBool info(DEPENDS_NONE, refresh);
+
+  info.Get(0);
+  refresh.Invalidate(DEPENDS_ALL);
+  info.Get(0);
+  EXPECT_EQ(1, info.m_updates);
+}
+
+TEST(TestInfoBool, ListItemIsNeverCached)
+{
+  InfoRefreshCounters refresh;
+  CountingInfoBool info(DEPENDS_LISTITEM, refresh);
+  info.SetListItemDependent();
+  const CFileItem item("item");
+
+  info.Get(0, &item);
+  info.Get(0, &item);
+  EXPECT_EQ(2, info.m_updates);
+
+  // without an item the value is cached like any other
+  info.Get(0);
+  info.Get(0);
+  EXPECT_EQ(3, info.m_updates);
+}
@@ -0,0 +1,216 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "interfaces/info/InfoExpression.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace INFO
+{
+class TestInfoExpressionHelper
+{
+public:
+  using Node = InfoExpression::InfoSubexpressionPtr;
+
+  explicit TestInfoExpressionHelper(InfoRefreshCounters& refresh) : m_expression("test", 0, refresh)
+  {
+  }
+
+  static Node Leaf(const InfoPtr& info, bool invert = false)
+  {
+    return std::make_shared<InfoExpression::InfoLeaf>(info, invert);
+  }
+
+  static Node And(const std::vector<Node>& children) { return Group(InfoExpression::NODE_AND, children); }
+  static Node Or(const std::vector<Node>& children) { return Group(InfoExpression::NODE_OR, children); }
+
+  void Compile(const Node& tree)
+  {
+    m_expression.m_expression_tree = tree;
+    m_expression.Compile();
+  }
+
+  // the program as text: a leaf is its (lowercase) expression, a jump its kind and target, e.g. "T>4"
+  std::string Dump() const
+  {
+    std::string dump;
+    for (const InfoExpression::Instruction& instruction : m_expression.m_program)
+    {
+      if (!dump.empty())
+        dump += ' ';
+      switch (instruction.op)
+      {
+        case InfoExpression::OP_GET:
+          dump += instruction.info->GetExpression();
+          break;
+        case InfoExpression::OP_GET_NOT:
+          dump += "!" + instruction.info->GetExpression();
+          break;
+        case InfoExpression::OP_JUMP_IF_TRUE:
+          dump += "T>" + std::to_string(instruction.target);
+          break;
+        case InfoExpression::OP_JUMP_IF_FALSE:
+          dump += "F>" + std::to_string(instruction.target);
+          break;
+      }
+    }
+    return dump;
+  }
+
+  InfoExpression& Expression() { return m_expression; }
+
+private:
+  static Node Group(InfoExpression::node_type_t type, const std::vector<Node>& children)
+  {
+    // children are added to the front
+    auto group = std::make_shared<InfoExpression::InfoAssociativeGroup>(
+        type, children[children.size() - 2], children.back());
+    for (size_t i = children.size() - 2; i > 0; --i)
+      group->AddChild(children[i - 1]);
+    return group;
+  }
+
+  InfoExpression m_expression;
+};
+} // namespace INFO
+
+using namespace INFO;
+
+namespace
+{
+class FixedInfoBool : public InfoBool
+{
+public:
+  FixedInfoBool(const std::string& name, InfoRefreshCounters& refresh)
+    : InfoBool(name, 0, refresh)
+  {
+    m_dependencies = DEPENDS_OTHER;
+  }
+
+  void Update(int contextWindow, const CGUIListItem* item) override
+  {
+    ++m_updates;
+    m_value = m_result;
+  }
+
+  bool m_result = false;
+  int m_updates = 0;
+};
+
+class TestInfoExpression : public ::testing::Test
+{
+protected:
+  std::shared_ptr<FixedInfoBool> MakeLeaf(const std::string& name)
+  {
+    return std::make_shared<FixedInfoBool>(name, refresh);
+  }
+
+  bool Run()
+  {
+    refresh.Invalidate(DEPENDS_OTHER);
+    return helper.Expression().Get(0);
+  }
+
+  InfoRefreshCounters refresh;
+  TestInfoExpressionHelper helper{refresh};
+};
+
+using Helper = TestInfoExpressionHelper;
+} // namespace
+
+TEST_F(TestInfoExpression, CompilesShortCircuitJumps)
+{
+  const auto a = MakeLeaf("a");
+  const auto b = MakeLeaf("b");
+
+  helper.Compile(Helper::Or({Helper::Leaf(a), Helper::Leaf(b)}));
+  EXPECT_EQ("a T>4 b T>4", helper.Dump());
+
+  helper.Compile(Helper::And({Helper::Leaf(a), Helper::Leaf(b, true)}));
+  EXPECT_EQ("a F>4 !b F>4", helper.Dump());
+}
+
+TEST_F(TestInfoExpression, ThreadsJumpsPastOppositeKind)
+{
+  const auto a = MakeLeaf("a");
+  const auto b = MakeLeaf("b");
+  const auto c = MakeLeaf("c");
+  const auto d = MakeLeaf("d");
+
+  // A|[B+C]|D: a false B+C goes on with D, not with the jump after the group
+  helper.Compile(Helper::Or(
+      {Helper::Leaf(a), Helper::And({Helper::Leaf(b), Helper::Leaf(c)}), Helper::Leaf(d)}));
+  EXPECT_EQ("a T>9 b F>7 c F>7 T>9 d T>9", helper.Dump());
+  for (int bits = 0; bits < 16; ++bits)
+  {
+    a->m_result = bits & 1;
+    b->m_result = bits & 2;
+    c->m_result = bits & 4;
+    d->m_result = bits & 8;
+    EXPECT_EQ(a->m_result || (b->m_result && c->m_result) || d->m_result, Run()) << bits;
+  }
+
+  // A+[B|[C+D]]: a false C+D lands on the jump of the outer group, which counts it
+  helper.Compile(Helper::And(
+      {Helper::Leaf(a),
+       Helper::Or({Helper::Leaf(b), Helper::And({Helper::Leaf(c), Helper::Leaf(d)})})}));
+  EXPECT_EQ("a F>10 b T>10 c F>9 d F>9 T>10 F>10", helper.Dump());
+  for (int bits = 0; bits < 16; ++bits)
+  {
+    a->m_result = bits & 1;
+    b->m_result = bits & 2;
+    c->m_result = bits & 4;
+    d->m_result = bits & 8;
+    EXPECT_EQ(a->m_result && (b->m_result || (c->m_result && d->m_result)), Run()) << bits;
+  }
+}
+
+TEST_F(TestInfoExpression, ReordersLastChildToFront)
+{
+  const auto a = MakeLeaf("a");
+  const auto b = MakeLeaf("b");
+  b->m_result = true;
+
+  helper.Compile(Helper::Or({Helper::Leaf(a), Helper::Leaf(b)}));
+  for (int i = 0; i < 64; ++i)
+    EXPECT_TRUE(Run());
+  EXPECT_EQ("b T>4 a T>4", helper.Dump());
+  EXPECT_EQ(64, a->m_updates);
+
+  // B settles the expression on its own now
+  for (int i = 0; i < 10; ++i)
+    EXPECT_TRUE(Run());
+  EXPECT_EQ(64, a->m_updates);
+  EXPECT_EQ(74, b->m_updates);
+}
+
+TEST_F(TestInfoExpression, ReordersGroups)
+{
+  const auto a = MakeLeaf("a");
+  const auto b = MakeLeaf("b");
+  const auto c = MakeLeaf("c");
+  b->m_result = true;
+  c->m_result = true;
+
+  helper.Compile(Helper::Or({Helper::Leaf(a), Helper::And({Helper::Leaf(b), Helper::Leaf(c)})}));
+  EXPECT_EQ("a T>7 b F>7 c F>7 T>7", helper.Dump());
+  for (int i = 0; i < 64; ++i)
+    EXPECT_TRUE(Run());
+  EXPECT_EQ("b F>5 c F>5 T>7 a T>7", helper.Dump());
+
+  // once A settles the expression it goes first again
+  a->m_result = true;
+  b->m_result = false;
+  for (int i = 0; i < 64; ++i)
+    EXPECT_TRUE(Run());
+  EXPECT_EQ("a T>7 b F>7 c F>7 T>7", helper.Dump());
+}
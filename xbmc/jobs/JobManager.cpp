@@ -17,6 +17,7 @@
 #include <mutex>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -34,10 +35,22 @@ size_t CJob::GetPendingCallbackCount() const
   return 0;
 }
 
+namespace
+{
+// Identifies the job manager and the queue shard owned by the current worker thread
+thread_local const CJobManager* workerManager{nullptr};
+thread_local size_t workerShard{0};
+// The shard of the job currently processed by this worker thread, used as a lookup hint
+thread_local size_t processingShard{0};
+} // namespace
+
 class CJobManager::CJobWorker : private CThread
 {
 public:
-  explicit CJobWorker(CJobManager& manager) : CThread("JobWorker"), m_jobManager(manager)
+  CJobWorker(CJobManager& manager, size_t shard)
+    : CThread("JobWorker"),
+      m_jobManager(manager),
+      m_shard(shard)
   {
     Create(true); // start work immediately, and kill ourselves when we're done
   }
@@ -52,6 +65,8 @@ public:
   void Process() override
   {
     SetPriority(ThreadPriority::LOWEST);
+    workerManager = &m_jobManager;
+    workerShard = m_shard;
     while (true)
     {
       // request an item from our manager (this call is blocking)
@@ -70,10 +85,12 @@ public:
       }
       m_jobManager.OnJobComplete(success, job);
     }
+    workerManager = nullptr;
   }
 
 private:
   CJobManager& m_jobManager;
+  const size_t m_shard;
 };
 
 struct CJobManager::JobFinder
@@ -84,50 +101,60 @@ struct CJobManager::JobFinder
   const CJob* m_job{nullptr};
 };
 
+CJobManager::CJobManager(Scheduler scheduler, unsigned int maxWorkers)
+  : m_maxWorkers(std::max(maxWorkers, 1u))
+{
+  const size_t shards = scheduler == Scheduler::WORK_STEALING ? m_maxWorkers : 1;
+  for (size_t i = 0; i < shards; ++i)
+    m_shards.emplace_back(std::make_unique<CQueueShard>());
+}
+
 bool CJobManager::IsRunning() const
 {
-  std::unique_lock lock(m_section);
   return m_running;
 }
 
 void CJobManager::Restart()
 {
-  std::unique_lock lock(m_section);
-
-  if (m_running)
+  bool running{false};
+  if (!m_running.compare_exchange_strong(running, true))
     throw std::logic_error("CJobManager already running");
-  m_running = true;
 }
 
 void CJobManager::CancelJobs()
 {
-  std::unique_lock lock(m_section);
   m_running = false;
 
-  // clear any pending jobs
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
-       ++priority)
+  for (const auto& shard : m_shards)
   {
-    std::ranges::for_each(m_jobQueue[priority],
+    std::unique_lock lock(shard->m_section);
+
+    // clear any pending jobs
+    for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE;
+         priority <= CJob::PRIORITY_DEDICATED; ++priority)
+    {
+      std::ranges::for_each(shard->m_jobQueue[priority],
+                            [](CWorkItem& wi)
+                            {
+                              for (auto* callback : wi.GetCallbacks())
+                                callback->OnJobAbort(wi.GetId(), wi.GetJob());
+                              wi.FreeJob();
+                            });
+      shard->m_jobQueue[priority].clear();
+    }
+
+    // cancel any callbacks on jobs still processing
+    std::ranges::for_each(shard->m_processing,
                           [](CWorkItem& wi)
                           {
                             for (auto* callback : wi.GetCallbacks())
                               callback->OnJobAbort(wi.GetId(), wi.GetJob());
-                            wi.FreeJob();
+                            wi.Cancel();
                           });
-    m_jobQueue[priority].clear();
   }
 
-  // cancel any callbacks on jobs still processing
-  std::ranges::for_each(m_processing,
-                        [](CWorkItem& wi)
-                        {
-                          for (auto* callback : wi.GetCallbacks())
-                            callback->OnJobAbort(wi.GetId(), wi.GetJob());
-                          wi.Cancel();
-                        });
-
   // tell our workers to finish
+  std::unique_lock lock(m_section);
   while (!m_workers.empty())
   {
     lock.unlock();
@@ -139,45 +166,65 @@ void CJobManager::CancelJobs()
 
 unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORITY priority)
 {
-  std::unique_lock lock(m_section);
-
   if (!m_running)
   {
     delete job;
     return 0;
   }
 
-  // Check if we have this job already in the queue - if so, add callback to existing job
-  auto it = std::ranges::find_if(m_jobQueue[priority],
-                                 [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); });
-  if (it != m_jobQueue[priority].end())
+  // Check if we have this job already queued or processing - if so, add callback to existing job.
+  // Note: Jobs that have moved to completion phase (removed from processing) won't be found here,
+  // causing a new job to be created. This is intentional - the completing job's results are about
+  // to be delivered to existing callbacks.
+  const auto addToExisting = [job, callback, priority](CQueueShard& shard) -> unsigned int
   {
-    it->AddCallback(callback);
-    delete job;
-    return it->GetId();
-  }
+    auto it = std::ranges::find_if(shard.m_jobQueue[priority], [job](const CWorkItem& wi)
+                                   { return wi.GetJob()->Equals(job); });
+    if (it != shard.m_jobQueue[priority].end())
+    {
+      it->AddCallback(callback);
+      return it->GetId();
+    }
+
+    auto procIt = std::ranges::find_if(shard.m_processing, [job](const CWorkItem& wi)
+                                       { return wi.GetJob()->Equals(job); });
+    if (procIt != shard.m_processing.end())
+    {
+      procIt->AddCallback(callback);
+      return procIt->GetId();
+    }
+    return 0;
+  };
+
+  // All shards are locked in index order while looking for an equal job and queueing this one, so
+  // of two equal jobs added at the same time to different shards the second one finds the first.
+  // Nothing else holds more than one shard lock at a time.
+  std::vector<std::unique_lock<CCriticalSection>> locks;
+  locks.reserve(m_shards.size());
+  for (const auto& shard : m_shards)
+    locks.emplace_back(shard->m_section);
 
-  // Check if an equal job is already processing - if so, add callback to it.
-  // Note: Jobs that have moved to completion phase (removed from m_processing)
-  // won't be found here, causing a new job to be created. This is intentional -
-  // the completing job's results are about to be delivered to existing callbacks.
-  auto procIt = std::ranges::find_if(m_processing, [job](const CWorkItem& wi)
-                                     { return wi.GetJob()->Equals(job); });
-  if (procIt != m_processing.end())
+  // CancelJobs() may have cleared the shards since we last checked
+  if (!m_running)
   {
-    procIt->AddCallback(callback);
     delete job;
-    return procIt->GetId();
+    return 0;
   }
 
-  // increment the job counter, ensuring 0 (invalid job) is never hit
-  m_jobCounter++;
-  if (m_jobCounter == 0)
-    m_jobCounter++;
+  for (const auto& shard : m_shards)
+  {
+    if (const unsigned int id = addToExisting(*shard); id != 0)
+    {
+      delete job;
+      return id;
+    }
+  }
 
-  // create a work item for this job
-  CWorkItem work(job, m_jobCounter, priority, callback);
-  m_jobQueue[priority].emplace_back(work);
+  // create a work item for this job. Jobs added by a worker go to its own queue, others are
+  // distributed over all queues.
+  CWorkItem work(job, NextJobId(), priority, callback);
+  m_shards[GetHomeShard()]->m_jobQueue[priority].emplace_back(work);
+  locks.clear();
 
   StartWorkers(priority);
   return work.GetId();
@@ -185,67 +232,133 @@ unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORI
 
 void CJobManager::CancelJob(unsigned int jobID)
 {
-  std::unique_lock lock(m_section);
-
-  // check whether we have this job in the queue
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
-       ++priority)
+  for (const auto& shard : m_shards)
   {
-    const auto i = std::ranges::find_if(m_jobQueue[priority],
-                                        [jobID](const auto& wi) { return wi.GetId() == jobID; });
-    if (i != m_jobQueue[priority].cend())
+    std::unique_lock lock(shard->m_section);
+
+    // check whether we have this job in the queue
+    for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE;
+         priority <= CJob::PRIORITY_DEDICATED; ++priority)
+    {
+      const auto i = std::ranges::find_if(shard->m_jobQueue[priority], [jobID](const auto& wi)
+                                          { return wi.GetId() == jobID; });
+      if (i != shard->m_jobQueue[priority].cend())
+      {
+        CWorkItem item(std::move(*i));
+        shard->m_jobQueue[priority].erase(i);
+        item.FreeJob();
+        return;
+      }
+    }
+    // or if we're processing it
+    const auto it = std::ranges::find_if(shard->m_processing,
+                                         [jobID](const auto& wi) { return wi.GetId() == jobID; });
+    if (it != shard->m_processing.cend())
     {
-      CWorkItem item(std::move(*i));
-      m_jobQueue[priority].erase(i);
-      item.FreeJob();
+      it->Cancel(); // job is in progress, so only thing to do is to remove all callbacks
       return;
     }
   }
-  // or if we're processing it
-  const auto it =
-      std::ranges::find_if(m_processing, [jobID](const auto& wi) { return wi.GetId() == jobID; });
-  if (it != m_processing.cend())
-    it->Cancel(); // job is in progress, so only thing to do is to remove all callbacks
 }
 
-void CJobManager::StartWorkers(CJob::PRIORITY priority)
+bool CJobManager::ChangeJobPriority(unsigned int jobID, CJob::PRIORITY priority)
 {
-  std::unique_lock lock(m_section);
+  for (const auto& shard : m_shards)
+  {
+    std::unique_lock lock(shard->m_section);
+
+    for (unsigned int queued = CJob::PRIORITY_LOW_PAUSABLE; queued <= CJob::PRIORITY_DEDICATED;
+         ++queued)
+    {
+      auto& queue = shard->m_jobQueue[queued];
+      const auto i =
+          std::ranges::find_if(queue, [jobID](const auto& wi) { return wi.GetId() == jobID; });
+      if (i == queue.end())
+        continue;
+
+      if (queued != priority)
+      {
+        CWorkItem item(std::move(*i));
+        queue.erase(i);
+        item.SetPriority(priority);
+        shard->m_jobQueue[priority].emplace_back(std::move(item));
+        lock.unlock();
+
+        StartWorkers(priority);
+      }
+      return true;
+    }
+  }
+  return false;
+}
 
+void CJobManager::StartWorkers(CJob::PRIORITY priority)
+{
   // check how many free threads we have
-  if (m_processing.size() >= GetMaxWorkers(priority))
+  if (m_processingCount >= GetMaxWorkers(priority))
     return;
 
   // do we have any sleeping threads?
-  if (m_processing.size() < m_workers.size())
+  if (m_processingCount < m_workerCount)
+  {
+    m_jobEvent.Set();
+    return;
+  }
+
+  std::unique_lock lock(m_section);
+  if (m_processingCount < m_workers.size())
   {
     m_jobEvent.Set();
     return;
   }
 
   // everyone is busy - we need more workers
-  m_workers.emplace_back(new CJobWorker(*this));
+  m_workers.emplace_back(new CJobWorker(*this, m_nextWorkerShard++ % m_shards.size()));
+  m_workerCount = m_workers.size();
+}
+
+bool CJobManager::ReserveWorker(CJob::PRIORITY priority)
+{
+  const size_t maxWorkers = GetMaxWorkers(priority);
+  size_t processing = m_processingCount;
+  do
+  {
+    if (processing >= maxWorkers)
+      return false;
+  } while (!m_processingCount.compare_exchange_weak(processing, processing + 1));
+  return true;
 }
 
 CJob* CJobManager::PopJob()
 {
-  std::unique_lock lock(m_section);
+  const size_t home = GetHomeShard();
   for (int priority = CJob::PRIORITY_DEDICATED; priority >= CJob::PRIORITY_LOW_PAUSABLE; --priority)
   {
     // Check whether we're pausing pausable jobs
     if (priority == CJob::PRIORITY_LOW_PAUSABLE && m_pauseJobs)
       continue;
 
-    if (!m_jobQueue[priority].empty() &&
-        m_processing.size() < GetMaxWorkers(CJob::PRIORITY(priority)))
+    // try our own queue first, then steal from the others
+    for (size_t i = 0; i < m_shards.size(); ++i)
     {
+      const size_t index = (home + i) % m_shards.size();
+      CQueueShard& shard = *m_shards[index];
+      std::unique_lock lock(shard.m_section);
+
+      if (shard.m_jobQueue[priority].empty())
+        continue;
+
+      if (!ReserveWorker(CJob::PRIORITY(priority)))
+        break;
+
       // pop the job off the queue
-      const CWorkItem job{m_jobQueue[priority].front()};
-      m_jobQueue[priority].pop_front();
+      const CWorkItem job{shard.m_jobQueue[priority].front()};
+      shard.m_jobQueue[priority].pop_front();
 
       // add to the processing vector
-      m_processing.emplace_back(job);
+      shard.m_processing.emplace_back(job);
       job.GetJob()->SetProgressCallback(this);
+      processingShard = index;
       return job.GetJob();
     }
   }
@@ -254,43 +367,49 @@ CJob* CJobManager::PopJob()
 
 void CJobManager::PauseJobs()
 {
-  std::unique_lock lock(m_section);
   m_pauseJobs = true;
 }
 
 void CJobManager::UnPauseJobs()
 {
-  std::unique_lock lock(m_section);
   m_pauseJobs = false;
 }
 
 bool CJobManager::IsProcessing(const CJob::PRIORITY& priority) const
 {
-  std::unique_lock lock(m_section);
-
   if (m_pauseJobs && priority == CJob::PRIORITY::PRIORITY_LOW_PAUSABLE)
     return false;
 
-  return std::ranges::any_of(m_processing,
-                             [priority](const auto& wi) { return wi.GetPriority() == priority; });
+  return std::ranges::any_of(m_shards,
+                             [priority](const auto& shard)
+                             {
+                               std::unique_lock lock(shard->m_section);
+                               return std::ranges::any_of(shard->m_processing,
+                                                          [priority](const auto& wi)
+                                                          { return wi.GetPriority() == priority; });
+                             });
 }
 
 int CJobManager::IsProcessing(const std::string& type) const
 {
-  std::unique_lock lock(m_section);
-
-  return static_cast<int>(std::ranges::count_if(
-      m_processing,
-      [this, &type](const auto& wi)
-      {
-        return (!m_pauseJobs || wi.GetPriority() != CJob::PRIORITY::PRIORITY_LOW_PAUSABLE) &&
-               (std::string(wi.GetJob()->GetType()) == type);
-      }));
+  const bool paused = m_pauseJobs;
+  int count = 0;
+  for (const auto& shard : m_shards)
+  {
+    std::unique_lock lock(shard->m_section);
+    count += static_cast<int>(std::ranges::count_if(
+        shard->m_processing,
+        [paused, &type](const auto& wi)
+        {
+          return (!paused || wi.GetPriority() != CJob::PRIORITY::PRIORITY_LOW_PAUSABLE) &&
+                 (std::string(wi.GetJob()->GetType()) == type);
+        }));
+  }
+  return count;
 }
 
 CJob* CJobManager::GetNextJob()
 {
-  std::unique_lock lock(m_section);
   while (m_running)
   {
     // grab a job off the queue if we have one
@@ -298,25 +417,21 @@ CJob* CJobManager::GetNextJob()
     if (job)
       return job;
     // no jobs are left - sleep for 30 seconds to allow new jobs to come in
-    lock.unlock();
-    bool newJob = m_jobEvent.Wait(30000ms);
-    lock.lock();
-    if (!newJob)
+    if (!m_jobEvent.Wait(30000ms))
       break;
   }
   // ensure no jobs have come in during the period after
-  // timeout and before we held the lock
+  // timeout and before we checked the queues
   return PopJob();
 }
 
 bool CJobManager::OnJobProgress(unsigned int progress, unsigned int total, const CJob* job) const
 {
-  std::unique_lock lock(m_section);
+  std::unique_lock<CCriticalSection> lock;
   // find the job in the processing queue, and check whether it's cancelled (no callbacks)
-  const auto i = std::ranges::find_if(m_processing, JobFinder(job));
-  if (i != m_processing.cend())
+  if (const CQueueShard* shard = LockProcessingShard(job, lock))
   {
-    CWorkItem item(*i);
+    CWorkItem item(*std::ranges::find_if(shard->m_processing, JobFinder(job)));
     lock.unlock(); // leave section prior to call
     if (!item.GetCallbacks().empty())
     {
@@ -330,46 +445,51 @@ bool CJobManager::OnJobProgress(unsigned int progress, unsigned int total, const
 
 void CJobManager::OnJobComplete(bool success, CJob* job)
 {
-  std::unique_lock lock(m_section);
+  std::unique_lock<CCriticalSection> shardLock;
   // find the job in the processing queue
-  auto i = std::ranges::find_if(m_processing, JobFinder(job));
-  if (i != m_processing.end())
+  CQueueShard* shard = LockProcessingShard(job, shardLock);
+  if (!shard)
+    return;
+
+  // Move work item out of the processing queue to avoid iterator invalidation
+  // when another thread modifies it during callback execution
+  auto i = std::ranges::find_if(shard->m_processing, JobFinder(job));
+  CWorkItem item(std::move(*i));
+  shard->m_processing.erase(i);
+  --m_processingCount;
+  shardLock.unlock();
+
+  // Handle cancelled jobs (no callbacks remaining)
+  if (item.GetCallbacks().empty())
   {
-    // Move work item out of m_processing to avoid iterator invalidation
-    // when another thread modifies m_processing during callback execution
-    CWorkItem item(std::move(*i));
-    m_processing.erase(i);
+    item.FreeJob();
+    return;
+  }
 
-    // Handle cancelled jobs (no callbacks remaining)
-    if (item.GetCallbacks().empty())
-    {
-      item.FreeJob();
-      return;
-    }
+  std::unique_lock lock(m_section);
 
-    // Track pending callbacks so CJob::IsShared() can query the count.
-    // Last callback (count==1) doesn't need to copy since it's the sole owner.
-    m_pendingCallbacks[job] = item.GetCallbacks().size();
+  // Track pending callbacks so CJob::IsShared() can query the count.
+  // Last callback (count==1) doesn't need to copy since it's the sole owner.
+  m_pendingCallbacks[job] = item.GetCallbacks().size();
 
-    while (IJobCallback* callback = item.PopCallback())
+  while (IJobCallback* callback = item.PopCallback())
+  {
+    lock.unlock();
+    try
     {
-      lock.unlock();
-      try
-      {
-        callback->OnJobComplete(item.GetId(), success, job);
-      }
-      catch (...)
-      {
-        CLog::LogF(LOGERROR, "Error processing job {}", job->GetType());
-      }
-      lock.lock();
-      // Update pending count for next callback
-      m_pendingCallbacks[job] = item.GetCallbacks().size();
+      callback->OnJobComplete(item.GetId(), success, job);
     }
-
-    m_pendingCallbacks.erase(job);
-    item.FreeJob();
+    catch (...)
+    {
+      CLog::LogF(LOGERROR, "Error processing job {}", job->GetType());
+    }
+    lock.lock();
+    // Update pending count for next callback
+    m_pendingCallbacks[job] = item.GetCallbacks().size();
   }
+
+  m_pendingCallbacks.erase(job);
+  item.FreeJob();
 }
 
 size_t CJobManager::GetPendingCallbackCount(const CJob* job) const
@@ -386,12 +506,49 @@ void CJobManager::RemoveWorker(const CJobWorker* worker)
   const auto i = std::ranges::find(m_workers, worker);
   if (i != m_workers.cend())
     m_workers.erase(i); // workers auto-delete
+  m_workerCount = m_workers.size();
+}
+
+CJobManager::CQueueShard* CJobManager::LockProcessingShard(
+    const CJob* job, std::unique_lock<CCriticalSection>& lock) const
+{
+  // the worker processing the job knows its shard, so this usually succeeds on the first try
+  const size_t hint = workerManager == this ? processingShard : 0;
+  for (size_t i = 0; i < m_shards.size(); ++i)
+  {
+    CQueueShard* shard = m_shards[(hint + i) % m_shards.size()].get();
+    std::unique_lock shardLock(shard->m_section);
+    if (std::ranges::any_of(shard->m_processing, JobFinder(job)))
+    {
+      lock = std::move(shardLock);
+      return shard;
+    }
+  }
+  return nullptr;
+}
+
+size_t CJobManager::GetHomeShard() const
+{
+  if (m_shards.size() == 1)
+    return 0;
+  if (workerManager == this)
+    return workerShard;
+  return m_nextShard++ % m_shards.size();
+}
+
+unsigned int CJobManager::NextJobId()
+{
+  // increment the job counter, ensuring 0 (invalid job) is never hit
+  unsigned int id = ++m_jobCounter;
+  if (id == 0)
+    id = ++m_jobCounter;
+  return id;
 }
 
-unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority)
+unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority) const
 {
-  static const unsigned int max_workers = 5;
   if (priority == CJob::PRIORITY_DEDICATED)
     return 10000; // A large number..
-  return max_workers - (CJob::PRIORITY_HIGH - priority);
+  const unsigned int reserved = CJob::PRIORITY_HIGH - priority;
+  return m_maxWorkers > reserved ? m_maxWorkers - reserved : 1;
 }
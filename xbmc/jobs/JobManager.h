@@ -15,6 +15,8 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <memory>
 #include <queue>
 #include <string>
 #include <unordered_map>
@@ -31,12 +33,29 @@ class IJobCallback;
  on priority levels.  Lower priority jobs are executed only if there are sufficient
  spare worker threads free to allow for higher priority jobs that may arise.
 
+ Two schedulers are available. The shared queue scheduler keeps all pending jobs in a single
+ queue, while the work-stealing scheduler gives each worker its own queue (guarded by its own
+ lock) and lets idle workers steal jobs from the queues of busy ones. Priority ordering and the
+ IsProcessing() queries behave identically for both.
+
  \sa CJob and IJobCallback
  */
 class CJobManager final
 {
 public:
-  CJobManager() = default;
+  enum class Scheduler
+  {
+    SHARED_QUEUE, //!< all workers pick up jobs from one queue
+    WORK_STEALING, //!< one queue per worker, idle workers steal from the others
+  };
+
+  /*!
+   \brief Create a job manager.
+   \param scheduler the scheduler used to distribute jobs to the workers.
+   \param maxWorkers the number of workers available for PRIORITY_HIGH jobs. Lower priorities get
+   one worker less per priority level (but at least one), dedicated jobs are not limited.
+   */
+  explicit CJobManager(Scheduler scheduler = Scheduler::SHARED_QUEUE, unsigned int maxWorkers = 5);
 
   /*!
    \brief Returns whether the job manager is currently running.
@@ -92,6 +111,16 @@ public:
    */
   void CancelJob(unsigned int jobID);
 
+  /*!
+   \brief Change the priority of a job that is still queued.
+   \param jobID the id of the job, retrieved previously from AddJob()
+   \param priority the new priority of the job.
+   \return true if the job is queued with the given priority now, including when it already was,
+   false if it is already processing or unknown.
+   \sa AddJob()
+   */
+  bool ChangeJobPriority(unsigned int jobID, CJob::PRIORITY priority);
+
   /*!
    \brief Cancel all remaining jobs, preparing for shutdown
    Should be called prior to destroying any objects that may be being used as callbacks
@@ -212,6 +241,7 @@ private:
       return callback;
     }
     CJob::PRIORITY GetPriority() const { return m_priority; }
+    void SetPriority(CJob::PRIORITY priority) { m_priority = priority; }
 
   private:
     CJob* m_job{nullptr};
@@ -220,29 +250,59 @@ private:
     CJob::PRIORITY m_priority{CJob::PRIORITY::PRIORITY_LOW};
   };
 
-  /*! \brief Pop a job off the job queue and add to the processing queue ready to process
+  using JobQueue = std::deque<CWorkItem>;
+  using Processing = std::vector<CWorkItem>;
+  using Workers = std::vector<CJobWorker*>;
+
+  /*! \brief Pending and processing jobs of one queue. The shared queue scheduler uses a single
+   shard, the work-stealing scheduler one shard per worker. A job stays in the shard it was queued
+   in until it has completed, regardless of the worker processing it.
+   */
+  struct CQueueShard
+  {
+    mutable CCriticalSection m_section;
+    std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
+    Processing m_processing;
+  };
+
+  /*! \brief Pop a job off the job queues and add to the processing queue ready to process.
+   The queue owned by the calling worker is tried first, then the queues of the other workers.
    \return the job to process, nullptr if no jobs are available
    */
   CJob* PopJob();
 
+  /*! \brief Reserve a worker slot for a job of the given priority.
+   \return true if the job may be processed, false if all workers for this priority are busy
+   */
+  bool ReserveWorker(CJob::PRIORITY priority);
+
+  /*! \brief Find the shard processing the given job and lock it.
+   \return the locked shard, nullptr if the job is not being processed
+   */
+  CQueueShard* LockProcessingShard(const CJob* job, std::unique_lock<CCriticalSection>& lock) const;
+
+  size_t GetHomeShard() const;
+  unsigned int NextJobId();
   void StartWorkers(CJob::PRIORITY priority);
   void RemoveWorker(const CJobWorker* worker);
-  static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
+  unsigned int GetMaxWorkers(CJob::PRIORITY priority) const;
 
-  unsigned int m_jobCounter{0};
+  const unsigned int m_maxWorkers;
+  std::atomic<unsigned int> m_jobCounter{0};
 
-  using JobQueue = std::deque<CWorkItem>;
-  using Processing = std::vector<CWorkItem>;
-  using Workers = std::vector<CJobWorker*>;
+  std::vector<std::unique_ptr<CQueueShard>> m_shards;
+  mutable std::atomic<size_t> m_nextShard{0};
+  std::atomic<size_t> m_processingCount{0};
+  std::atomic<bool> m_pauseJobs{false};
 
-  std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
-  bool m_pauseJobs{false};
-  Processing m_processing;
+  // m_section guards the workers and the pending callbacks, the queues are guarded by their shards
   Workers m_workers;
+  std::atomic<size_t> m_workerCount{0};
+  size_t m_nextWorkerShard{0};
 
   mutable CCriticalSection m_section;
   CEvent m_jobEvent;
-  bool m_running{true};
+  std::atomic<bool> m_running{true};
 
   // Tracks pending callback count for jobs in completion phase, used by CJob::IsShared()
   std::unordered_map<const CJob*, size_t> m_pendingCallbacks;
@@ -40,9 +40,11 @@
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "imagefiles/ImageFileURL.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobManager.h"
 #include "messaging/helpers/DialogHelper.h"
 #include "messaging/helpers/DialogOKHelper.h"
 #include "music/MusicDbUrl.h"
+#include "music/MusicLibraryIndex.h"
 #include "music/MusicLibraryQueue.h"
 #include "music/tags/MusicInfoTag.h"
 #include "network/Network.h"
@@ -70,6 +72,7 @@
 #include <inttypes.h>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -4046,6 +4049,18 @@ void CMusicDatabase::IncrementPlayCount(const CFileItem& item)
                                  "WHERE idSong=%i",
                                  strDateNow.c_str(), idSong);
     m_pDS->exec(sql);
+
+    // only the play count of the album changed, keep the index of the library
+    sql = PrepareSQL("SELECT idAlbum, iTimesPlayed, lastplayed FROM albumview "
+                     "WHERE idAlbum = (SELECT idAlbum FROM song WHERE idSong = %i)",
+                     idSong);
+    if (m_pDS->query(sql))
+    {
+      if (!m_pDS->eof())
+        CMusicLibraryIndex::SetAlbumPlayed(m_pDS->fv(0).get_asInt(), m_pDS->fv(1).get_asInt(),
+                                           CDateTime::FromDBDateTime(m_pDS->fv(2).get_asString()));
+      m_pDS->close();
+    }
   }
   catch (...)
   {
@@ -5561,7 +5576,11 @@ bool CMusicDatabase::GetArtistsByWhere(
     Filter extFilter = filter;
     CMusicDbUrl musicUrl;
     SortDescription sorting = sortDescription;
-    if (!musicUrl.FromString(strBaseDir) || !GetFilter(musicUrl, extFilter, sorting))
+    if (!musicUrl.FromString(strBaseDir))
+      return false;
+    if (GetArtistsFromIndex(musicUrl, filter, items, sortDescription, countOnly))
+      return true;
+    if (!GetFilter(musicUrl, extFilter, sorting))
       return false;
 
     bool extended = false;
@@ -5800,7 +5819,11 @@ bool CMusicDatabase::GetAlbumsByWhere(
     Filter extFilter = filter;
     CMusicDbUrl musicUrl;
     SortDescription sorting = sortDescription;
-    if (!musicUrl.FromString(baseDir) || !GetFilter(musicUrl, extFilter, sorting))
+    if (!musicUrl.FromString(baseDir))
+      return false;
+    if (GetAlbumsFromIndex(musicUrl, filter, items, sortDescription, countOnly))
+      return true;
+    if (!GetFilter(musicUrl, extFilter, sorting))
       return false;
 
     bool extended = false;
@@ -5954,6 +5977,272 @@ bool CMusicDatabase::GetAlbumsByWhere(
   return false;
 }
 
+namespace
+{
+// whether a filter has no conditions beyond those of the url, which the library index can apply
+bool IsIndexedFilter(const CDatabase::Filter& filter)
+{
+  return filter.join.empty() && filter.where.empty() && filter.order.empty() &&
+         filter.group.empty() && filter.limit.empty() &&
+         (filter.fields.empty() || filter.fields == "*");
+}
+
+// the rows of a listing within the limits of a sort description
+std::span<const size_t> GetLimitedRows(const std::vector<size_t>& rows,
+                                       const SortDescription& sortDescription)
+{
+  const size_t start = std::min(static_cast<size_t>(std::max(sortDescription.limitStart, 0)),
+                                rows.size());
+  size_t end = rows.size();
+  if (sortDescription.limitEnd > 0)
+    end = std::clamp(static_cast<size_t>(sortDescription.limitEnd), start, rows.size());
+  return std::span(rows).subspan(start, end - start);
+}
+} // namespace
+
+std::shared_ptr<const CMusicLibraryIndex> CMusicDatabase::GetLibraryIndex() const
+{
+  if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bMusicLibraryMemoryIndex)
+    return nullptr;
+
+  std::shared_ptr<const CMusicLibraryIndex> index =
+      CMusicLibraryIndex::Get(GetLibraryLastUpdated());
+  // not while scanning, the index would be outdated by the time it's built
+  uint64_t generation;
+  if (!index && !CMusicLibraryQueue::GetInstance().IsScanningLibrary() &&
+      CMusicLibraryIndex::BeginBuild(generation))
+  {
+    CServiceBroker::GetJobManager()->Submit(
+        [generation]
+        {
+          CMusicDatabase musicdatabase;
+          std::shared_ptr<const CMusicLibraryIndex> built;
+          std::string lastUpdated;
+          if (musicdatabase.Open())
+          {
+            lastUpdated = musicdatabase.GetLibraryLastUpdated();
+            built = musicdatabase.BuildLibraryIndex();
+            musicdatabase.Close();
+          }
+          CMusicLibraryIndex::EndBuild(generation, std::move(built), lastUpdated);
+        });
+  }
+  return index;
+}
+
+std::shared_ptr<const CMusicLibraryIndex> CMusicDatabase::BuildLibraryIndex()
+{
+  if (m_pDB == nullptr || m_pDS == nullptr)
+    return nullptr;
+
+  try
+  {
+    auto start = std::chrono::steady_clock::now();
+    CMusicLibraryIndex::Source source;
+
+    if (!m_pDS->query("SELECT artistview.* FROM artistview"))
+      return nullptr;
+    source.artists.reserve(m_pDS->num_rows());
+    while (!m_pDS->eof())
+    {
+      source.artists.emplace_back(GetArtistFromDataset(m_pDS->get_sql_record(), 0, false));
+      m_pDS->next();
+    }
+    m_pDS->close();
+
+    if (!m_pDS->query("SELECT albumview.* FROM albumview"))
+      return nullptr;
+    source.albums.reserve(m_pDS->num_rows());
+    while (!m_pDS->eof())
+    {
+      source.albums.emplace_back(GetAlbumFromDataset(m_pDS->get_sql_record()));
+      m_pDS->next();
+    }
+    m_pDS->close();
+
+    const auto getLinks = [this](const std::string& sql, std::vector<std::pair<int, int>>& links)
+    {
+      if (!m_pDS->query(sql))
+        return false;
+      links.reserve(m_pDS->num_rows());
+      while (!m_pDS->eof())
+      {
+        links.emplace_back(m_pDS->fv(0).get_asInt(), m_pDS->fv(1).get_asInt());
+        m_pDS->next();
+      }
+      m_pDS->close();
+      return true;
+    };
+    if (!getLinks("SELECT idAlbum, idArtist FROM album_artist", source.albumArtists) ||
+        !getLinks("SELECT idSong, idAlbum FROM song", source.songs) ||
+        !getLinks("SELECT idSong, idGenre FROM song_genre", source.songGenres) ||
+        !getLinks(PrepareSQL("SELECT idSong, idArtist FROM song_artist WHERE idRole = %i",
+                             ROLE_ARTIST),
+                  source.songArtists))
+      return nullptr;
+
+    const size_t artists = source.artists.size();
+    const size_t albums = source.albums.size();
+    auto index = std::make_shared<const CMusicLibraryIndex>(std::move(source));
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    CLog::LogF(LOGDEBUG, "Indexed {} artists, {} albums and {} songs in {} ms", artists, albums,
+               index->GetSongCount(), duration.count());
+    return index;
+  }
+  catch (...)
+  {
+    m_pDS->close();
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return nullptr;
+}
+
+bool CMusicDatabase::GetArtistsFromIndex(const CMusicDbUrl& musicUrl,
+                                         const Filter& filter,
+                                         CFileItemList& items,
+                                         const SortDescription& sortDescription,
+                                         bool countOnly) const
+{
+  // the index applies the options of the library nodes, anything else is left to SQL
+  if (musicUrl.GetType() != "artists" || !IsIndexedFilter(filter) ||
+      sortDescription.sortBy != SortByNone)
+    return false;
+
+  CMusicLibraryIndex::ArtistFilter artistFilter;
+  for (const auto& [option, value] : musicUrl.GetOptions())
+  {
+    if (option == "albumartistsonly")
+      artistFilter.albumArtistsOnly = value.asBoolean();
+    else if (option == "genreid")
+      artistFilter.idGenre = static_cast<int>(value.asInteger());
+    else if (option != "useoriginalyear")
+      return false;
+  }
+
+  const std::shared_ptr<const CMusicLibraryIndex> index = GetLibraryIndex();
+  if (!index)
+    return false;
+
+  auto start = std::chrono::steady_clock::now();
+  const std::vector<size_t> rows = index->GetArtists(artistFilter);
+  if (countOnly)
+  {
+    auto pItem{std::make_shared<CFileItem>()};
+    pItem->SetProperty("total", static_cast<int>(rows.size()));
+    items.Add(std::move(pItem));
+    return true;
+  }
+  if (rows.empty())
+    return true;
+
+  items.SetProperty("total", static_cast<int>(rows.size()));
+  items.SetSortMethod(sortDescription.sortBy);
+  items.SetSortOrder(sortDescription.sortOrder);
+
+  const std::span<const size_t> limited = GetLimitedRows(rows, sortDescription);
+  items.Reserve(limited.size());
+  for (const size_t row : limited)
+  {
+    const CArtist& artist = index->GetArtist(row);
+    auto pItem{std::make_shared<CFileItem>(artist)};
+
+    CMusicDbUrl itemUrl = musicUrl;
+    std::string path = StringUtils::Format("{}/", artist.idArtist);
+    itemUrl.AppendPath(path);
+    pItem->SetPath(itemUrl.ToString());
+
+    pItem->GetMusicInfoTag()->SetDatabaseId(artist.idArtist, MediaTypeArtist);
+    // Set icon now to avoid slow per item processing in FillInDefaultIcon later
+    pItem->SetProperty("icon_never_overlay", true);
+    pItem->SetArt("icon", "DefaultArtist.png");
+
+    SetPropertiesFromArtist(*pItem, artist);
+    items.Add(std::move(pItem));
+  }
+
+  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  CLog::LogF(LOGDEBUG, "Time to fill list with artists from the library index {} ms",
+             duration.count());
+  return true;
+}
+
+bool CMusicDatabase::GetAlbumsFromIndex(const CMusicDbUrl& musicUrl,
+                                        const Filter& filter,
+                                        CFileItemList& items,
+                                        const SortDescription& sortDescription,
+                                        bool countOnly) const
+{
+  // the index applies the options of the library nodes, anything else is left to SQL
+  if (musicUrl.GetType() != "albums" || !IsIndexedFilter(filter) ||
+      sortDescription.sortBy != SortByNone)
+    return false;
+
+  CMusicLibraryIndex::AlbumFilter albumFilter;
+  for (const auto& [option, value] : musicUrl.GetOptions())
+  {
+    if (option == "albumartistsonly")
+      albumFilter.albumArtistsOnly = value.asBoolean();
+    else if (option == "artistid")
+      albumFilter.idArtist = static_cast<int>(value.asInteger());
+    else if (option == "genreid")
+      albumFilter.idGenre = static_cast<int>(value.asInteger());
+    else if (option == "show_singles")
+      albumFilter.showSingles = value.asBoolean();
+    else if (option != "useoriginalyear")
+      return false;
+  }
+
+  const std::shared_ptr<const CMusicLibraryIndex> index = GetLibraryIndex();
+  if (!index)
+    return false;
+
+  auto start = std::chrono::steady_clock::now();
+  const std::vector<size_t> rows = index->GetAlbums(albumFilter);
+  if (countOnly)
+  {
+    auto pItem{std::make_shared<CFileItem>()};
+    pItem->SetProperty("total", static_cast<int>(rows.size()));
+    items.Add(std::move(pItem));
+    return true;
+  }
+  if (rows.empty())
+    return true;
+
+  items.SetProperty("total", static_cast<int>(rows.size()));
+  items.SetSortMethod(sortDescription.sortBy);
+  items.SetSortOrder(sortDescription.sortOrder);
+
+  const std::span<const size_t> limited = GetLimitedRows(rows, sortDescription);
+  items.Reserve(limited.size());
+  for (const size_t row : limited)
+  {
+    const CAlbum& album = index->GetAlbum(row);
+    CMusicDbUrl itemUrl = musicUrl;
+    std::string path = StringUtils::Format("{}/", album.idAlbum);
+    itemUrl.AppendPath(path);
+
+    auto pItem{std::make_shared<CFileItem>(itemUrl.ToString(), album)};
+    int timesPlayed;
+    CDateTime lastPlayed;
+    index->GetAlbumPlayed(row, timesPlayed, lastPlayed);
+    pItem->GetMusicInfoTag()->SetPlayCount(timesPlayed);
+    pItem->GetMusicInfoTag()->SetLastPlayed(lastPlayed);
+    // Set icon now to avoid slow per item processing in FillInDefaultIcon later
+    pItem->SetProperty("icon_never_overlay", true);
+    pItem->SetArt("icon", "DefaultAlbumCover.png");
+    items.Add(std::move(pItem));
+  }
+
+  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  CLog::LogF(LOGDEBUG, "Time to fill list with albums from the library index {} ms",
+             duration.count());
+  return true;
+}
+
 bool CMusicDatabase::GetDiscsNav(const std::string& strBaseDir,
                                  CFileItemList& items,
                                  int idAlbum,
@@ -9537,6 +9826,7 @@ std::string CMusicDatabase::GetLibraryLastUpdated() const
 
 void CMusicDatabase::SetLibraryLastUpdated()
 {
+  CMusicLibraryIndex::Invalidate();
   CDateTime dateUpdated = CDateTime::GetUTCDateTime();
   m_pDS->exec(PrepareSQL("UPDATE versiontagscan SET lastscanned = '%s'",
                          dateUpdated.GetAsDBDateTime().c_str()));
@@ -10990,6 +11280,7 @@ bool CMusicDatabase::UpdateArtistSortNames(int idArtist /*=-1*/)
   bool bisMySQL = StringUtils::EqualsNoCase(
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseMusic.type, "mysql");
 
+  CMusicLibraryIndex::Invalidate();
   BeginMultipleExecute();
   if (bisMySQL)
     strSQL = "(SELECT GROUP_CONCAT("
@@ -11493,6 +11784,7 @@ bool CMusicDatabase::SetSongUserrating(int idSong, int userrating)
     std::string sql =
         PrepareSQL("UPDATE song SET userrating ='%i' WHERE idSong = %i", userrating, idSong);
     m_pDS->exec(sql);
+    CMusicLibraryIndex::Invalidate();
     return true;
   }
   catch (...)
@@ -11516,6 +11808,7 @@ bool CMusicDatabase::SetAlbumUserrating(const int idAlbum, int userrating)
     std::string sql =
         PrepareSQL("UPDATE album SET iUserrating='%i' WHERE idAlbum = %i", userrating, idAlbum);
     m_pDS->exec(sql);
+    CMusicLibraryIndex::Invalidate();
     return true;
   }
   catch (...)
@@ -11543,6 +11836,7 @@ bool CMusicDatabase::SetSongVotes(const std::string& filePath, int votes)
     std::string sql = PrepareSQL("UPDATE song SET votes ='%i' WHERE idSong = %i", votes, songID);
 
     m_pDS->exec(sql);
+    CMusicLibraryIndex::Invalidate();
     return true;
   }
   catch (...)
@@ -12914,6 +13208,7 @@ void CMusicDatabase::SetItemUpdated(int mediaId, const std::string& mediaType)
     else // MediaTypeSong
       strSQL = PrepareSQL("UPDATE song SET strTitle = strTitle WHERE idSong = %i", mediaId);
     m_pDS->exec(strSQL);
+    CMusicLibraryIndex::Invalidate();
   }
   catch (...)
   {
@@ -23,6 +23,7 @@
 
 #include <cctype>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -31,6 +32,7 @@
 class CArtist;
 class CFileItem;
 class CMusicDbUrl;
+class CMusicLibraryIndex;
 class TiXmlNode;
 
 namespace dbiplus
@@ -889,6 +891,35 @@ private:
                  std::string& strPath,
                  std::string& strFileName) const;
 
+  /*! \brief Get the in-memory index of the library, when enabled and up to date
+   Starts building the index in the background when it isn't.
+   \return the index, nullptr if the database must be queried
+   */
+  std::shared_ptr<const CMusicLibraryIndex> GetLibraryIndex() const;
+
+  /*! \brief Query the library for the in-memory index
+   \return the index, nullptr on failure
+   */
+  std::shared_ptr<const CMusicLibraryIndex> BuildLibraryIndex();
+
+  /*! \brief List artists from the in-memory index of the library if the index covers the filter
+   \return true if listed, false if the database must be queried
+   */
+  bool GetArtistsFromIndex(const CMusicDbUrl& musicUrl,
+                           const Filter& filter,
+                           CFileItemList& items,
+                           const SortDescription& sortDescription,
+                           bool countOnly) const;
+
+  /*! \brief List albums from the in-memory index of the library if the index covers the filter
+   \return true if listed, false if the database must be queried
+   */
+  bool GetAlbumsFromIndex(const CMusicDbUrl& musicUrl,
+                          const Filter& filter,
+                          CFileItemList& items,
+                          const SortDescription& sortDescription,
+                          bool countOnly) const;
+
   CSong GetSongFromDataset();
   CSong GetSongFromDataset(const dbiplus::sql_record* const record, int offset = 0) const;
   CArtist GetArtistFromDataset(dbiplus::Dataset* pDS, int offset = 0, bool needThumb = true) const;
@@ -0,0 +1,315 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicLibraryIndex.h"
+
+#include "threads/CriticalSection.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+struct LibraryIndex
+{
+  CCriticalSection section;
+  std::shared_ptr<const CMusicLibraryIndex> index;
+  std::string lastUpdated;
+  uint64_t generation{0}; ///< incremented when the library changes
+  bool building{false};
+};
+
+LibraryIndex& GetLibraryIndex()
+{
+  static LibraryIndex s_index;
+  return s_index;
+}
+
+// row of an id in a column of ascending ids
+uint32_t FindRow(const std::vector<int>& ids, int id)
+{
+  const auto it = std::ranges::lower_bound(ids, id);
+  if (it == ids.end() || *it != id)
+    return UINT32_MAX;
+  return static_cast<uint32_t>(it - ids.begin());
+}
+
+template<typename T>
+std::vector<int> SortById(std::vector<T>& rows, int T::*id)
+{
+  std::ranges::sort(rows, {}, id);
+  std::vector<int> ids;
+  ids.reserve(rows.size());
+  for (const auto& row : rows)
+    ids.emplace_back(row.*id);
+  return ids;
+}
+
+std::vector<size_t> GetRows(const std::vector<uint8_t>& flags)
+{
+  std::vector<size_t> rows;
+  for (size_t row = 0; row < flags.size(); row++)
+  {
+    if (flags[row])
+      rows.emplace_back(row);
+  }
+  return rows;
+}
+} // namespace
+
+CMusicLibraryIndex::CMusicLibraryIndex(Source source)
+  : m_artists(std::move(source.artists)), m_albums(std::move(source.albums))
+{
+  m_artistIds = SortById(m_artists, &CArtist::idArtist);
+  m_albumIds = SortById(m_albums, &CAlbum::idAlbum);
+
+  m_albumIsSingle.reserve(m_albums.size());
+  m_albumPlayed.reserve(m_albums.size());
+  for (const auto& album : m_albums)
+  {
+    m_albumIsSingle.emplace_back(album.releaseType != CAlbum::Album);
+    m_albumPlayed.emplace_back(Played{album.iTimesPlayed, album.lastPlayed});
+  }
+
+  std::vector<std::pair<uint32_t, uint32_t>> pairs;
+  pairs.reserve(source.albumArtists.size());
+  for (const auto& [idAlbum, idArtist] : source.albumArtists)
+  {
+    const uint32_t album = FindRow(m_albumIds, idAlbum);
+    const uint32_t artist = FindRow(m_artistIds, idArtist);
+    if (album != NO_ROW && artist != NO_ROW)
+      pairs.emplace_back(album, artist);
+  }
+  m_albumArtists = CreateLinks(m_albums.size(), pairs);
+
+  std::ranges::sort(source.songs);
+  std::vector<int> songIds;
+  songIds.reserve(source.songs.size());
+  m_songAlbums.reserve(source.songs.size());
+  for (const auto& [idSong, idAlbum] : source.songs)
+  {
+    songIds.emplace_back(idSong);
+    m_songAlbums.emplace_back(FindRow(m_albumIds, idAlbum));
+  }
+
+  pairs.clear();
+  pairs.reserve(source.songGenres.size());
+  for (const auto& [idSong, idGenre] : source.songGenres)
+  {
+    const uint32_t song = FindRow(songIds, idSong);
+    if (song != NO_ROW && idGenre > 0)
+      pairs.emplace_back(song, static_cast<uint32_t>(idGenre));
+  }
+  m_songGenres = CreateLinks(songIds.size(), pairs);
+
+  pairs.clear();
+  pairs.reserve(source.songArtists.size());
+  for (const auto& [idSong, idArtist] : source.songArtists)
+  {
+    const uint32_t song = FindRow(songIds, idSong);
+    const uint32_t artist = FindRow(m_artistIds, idArtist);
+    if (song != NO_ROW && artist != NO_ROW)
+      pairs.emplace_back(song, artist);
+  }
+  m_songArtists = CreateLinks(songIds.size(), pairs);
+}
+
+CMusicLibraryIndex::Links CMusicLibraryIndex::CreateLinks(
+    size_t rows, std::vector<std::pair<uint32_t, uint32_t>>& pairs)
+{
+  std::ranges::sort(pairs);
+  const auto duplicates = std::ranges::unique(pairs);
+  pairs.erase(duplicates.begin(), duplicates.end());
+
+  Links links;
+  links.offsets.resize(rows + 1, 0);
+  links.values.reserve(pairs.size());
+  for (const auto& [row, value] : pairs)
+  {
+    links.offsets[row + 1]++;
+    links.values.emplace_back(value);
+  }
+  for (size_t row = 0; row < rows; row++)
+    links.offsets[row + 1] += links.offsets[row];
+  return links;
+}
+
+bool CMusicLibraryIndex::SongHasGenre(size_t song, int idGenre) const
+{
+  const auto begin = m_songGenres.values.begin();
+  return std::find(begin + m_songGenres.Begin(song), begin + m_songGenres.End(song),
+                   static_cast<uint32_t>(idGenre)) != begin + m_songGenres.End(song);
+}
+
+std::vector<uint8_t> CMusicLibraryIndex::GetAlbumsWithGenre(int idGenre) const
+{
+  std::vector<uint8_t> albums(m_albums.size(), 0);
+  for (size_t song = 0; song < m_songAlbums.size(); song++)
+  {
+    if (m_songAlbums[song] != NO_ROW && SongHasGenre(song, idGenre))
+      albums[m_songAlbums[song]] = 1;
+  }
+  return albums;
+}
+
+std::vector<size_t> CMusicLibraryIndex::GetArtists(const ArtistFilter& filter) const
+{
+  const bool byGenre = filter.idGenre > 0;
+  std::vector<uint8_t> artists(m_artists.size(), 0);
+
+  // artists of the songs, of that genre
+  if (!filter.albumArtistsOnly)
+  {
+    for (size_t song = 0; song < m_songAlbums.size(); song++)
+    {
+      if (byGenre && !SongHasGenre(song, filter.idGenre))
+        continue;
+      for (size_t link = m_songArtists.Begin(song); link < m_songArtists.End(song); link++)
+        artists[m_songArtists.values[link]] = 1;
+    }
+  }
+
+  // artists of the albums, with songs of that genre
+  const std::vector<uint8_t> albums =
+      byGenre ? GetAlbumsWithGenre(filter.idGenre) : std::vector<uint8_t>(m_albums.size(), 1);
+  for (size_t album = 0; album < m_albums.size(); album++)
+  {
+    if (!albums[album])
+      continue;
+    for (size_t link = m_albumArtists.Begin(album); link < m_albumArtists.End(album); link++)
+      artists[m_albumArtists.values[link]] = 1;
+  }
+
+  for (size_t artist = 0; artist < m_artists.size(); artist++)
+  {
+    if (m_artists[artist].strArtist.empty())
+      artists[artist] = 0;
+  }
+  return GetRows(artists);
+}
+
+std::vector<size_t> CMusicLibraryIndex::GetAlbums(const AlbumFilter& filter) const
+{
+  const bool byGenre = filter.idGenre > 0;
+  std::vector<uint8_t> albums =
+      byGenre ? GetAlbumsWithGenre(filter.idGenre) : std::vector<uint8_t>(m_albums.size(), 1);
+
+  if (filter.idArtist <= 0)
+  {
+    if (!filter.showSingles)
+    {
+      for (size_t album = 0; album < m_albums.size(); album++)
+      {
+        if (m_albumIsSingle[album])
+          albums[album] = 0;
+      }
+    }
+    return GetRows(albums);
+  }
+
+  const uint32_t artist = FindRow(m_artistIds, filter.idArtist);
+  if (artist == NO_ROW)
+    return {};
+
+  // albums of the artist, with songs of that genre
+  std::vector<uint8_t> artistAlbums(m_albums.size(), 0);
+  for (size_t album = 0; album < m_albums.size(); album++)
+  {
+    if (!albums[album])
+      continue;
+    const auto begin = m_albumArtists.values.begin();
+    if (std::find(begin + m_albumArtists.Begin(album), begin + m_albumArtists.End(album), artist) !=
+        begin + m_albumArtists.End(album))
+      artistAlbums[album] = 1;
+  }
+
+  // albums with songs of the artist of that genre
+  if (!filter.albumArtistsOnly)
+  {
+    for (size_t song = 0; song < m_songAlbums.size(); song++)
+    {
+      if (m_songAlbums[song] == NO_ROW || (byGenre && !SongHasGenre(song, filter.idGenre)))
+        continue;
+      const auto begin = m_songArtists.values.begin();
+      if (std::find(begin + m_songArtists.Begin(song), begin + m_songArtists.End(song), artist) !=
+          begin + m_songArtists.End(song))
+        artistAlbums[m_songAlbums[song]] = 1;
+    }
+  }
+  return GetRows(artistAlbums);
+}
+
+void CMusicLibraryIndex::GetAlbumPlayed(size_t row, int& timesPlayed, CDateTime& lastPlayed) const
+{
+  std::unique_lock lock(m_playedSection);
+  timesPlayed = m_albumPlayed[row].timesPlayed;
+  lastPlayed = m_albumPlayed[row].lastPlayed;
+}
+
+std::shared_ptr<const CMusicLibraryIndex> CMusicLibraryIndex::Get(const std::string& lastUpdated)
+{
+  LibraryIndex& library = GetLibraryIndex();
+  std::unique_lock lock(library.section);
+  if (library.lastUpdated != lastUpdated)
+    return nullptr;
+  return library.index;
+}
+
+bool CMusicLibraryIndex::BeginBuild(uint64_t& generation)
+{
+  LibraryIndex& library = GetLibraryIndex();
+  std::unique_lock lock(library.section);
+  if (library.building)
+    return false;
+  library.building = true;
+  generation = library.generation;
+  return true;
+}
+
+void CMusicLibraryIndex::EndBuild(uint64_t generation,
+                                  std::shared_ptr<const CMusicLibraryIndex> index,
+                                  const std::string& lastUpdated)
+{
+  LibraryIndex& library = GetLibraryIndex();
+  std::unique_lock lock(library.section);
+  library.building = false;
+  if (!index || generation != library.generation)
+    return;
+  library.index = std::move(index);
+  library.lastUpdated = lastUpdated;
+}
+
+void CMusicLibraryIndex::Invalidate()
+{
+  LibraryIndex& library = GetLibraryIndex();
+  std::unique_lock lock(library.section);
+  library.generation++;
+  library.index.reset();
+  library.lastUpdated.clear();
+}
+
+void CMusicLibraryIndex::SetAlbumPlayed(int idAlbum,
+                                        int timesPlayed,
+                                        const CDateTime& lastPlayed)
+{
+  LibraryIndex& library = GetLibraryIndex();
+  std::unique_lock lock(library.section);
+  // an index being built may have read the album before it was played
+  if (library.building)
+    library.generation++;
+  if (!library.index)
+    return;
+
+  const CMusicLibraryIndex& index = *library.index;
+  const uint32_t album = FindRow(index.m_albumIds, idAlbum);
+  if (album == NO_ROW)
+    return;
+
+  std::unique_lock playedLock(index.m_playedSection);
+  index.m_albumPlayed[album] = {timesPlayed, lastPlayed};
+}
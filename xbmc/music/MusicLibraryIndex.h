@@ -0,0 +1,180 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "XBDateTime.h"
+#include "music/Album.h"
+#include "music/Artist.h"
+#include "threads/CriticalSection.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ \brief In-memory index of the artists, albums and songs of the music library.
+
+ Answers the artist and album listings of the library nodes, optionally filtered by genre and
+ artist, without querying the database. The links between songs, albums, artists and genres
+ are kept in columns of ids, with the links of each row stored contiguously. Filtering scans
+ these columns, the artist and album details are only copied for the rows listed.
+
+ Only the links of the songs are indexed, listings of songs are left to the database.
+
+ An index is immutable once created, except for the play counts of the albums. The index of the
+ library is created in the background and replaced whenever the library changes, see Get() and
+ Invalidate(). Playing a song only updates the album in place, see SetAlbumPlayed().
+ */
+class CMusicLibraryIndex
+{
+public:
+  /*!
+   \brief The contents of the library to create the index from
+   */
+  struct Source
+  {
+    std::vector<CArtist> artists;
+    std::vector<CAlbum> albums;
+    std::vector<std::pair<int, int>> albumArtists; ///< idAlbum, idArtist
+    std::vector<std::pair<int, int>> songs; ///< idSong, idAlbum
+    std::vector<std::pair<int, int>> songGenres; ///< idSong, idGenre
+    std::vector<std::pair<int, int>> songArtists; ///< idSong, idArtist in the role of artist
+  };
+
+  explicit CMusicLibraryIndex(Source source);
+
+  /*!
+   \brief Filter of the artists, as applied by CMusicDatabase::GetFilter() for the role of artist
+   */
+  struct ArtistFilter
+  {
+    bool albumArtistsOnly{false};
+    int idGenre{-1};
+  };
+
+  /*!
+   \brief Filter of the albums, as applied by CMusicDatabase::GetFilter() for the role of artist
+   */
+  struct AlbumFilter
+  {
+    bool albumArtistsOnly{false};
+    int idArtist{-1};
+    int idGenre{-1};
+    bool showSingles{false}; ///< include single albums when not filtered by artist
+  };
+
+  /*!
+   \brief Get the rows of the artists matching a filter, in the order of their ids
+   */
+  std::vector<size_t> GetArtists(const ArtistFilter& filter) const;
+
+  /*!
+   \brief Get the rows of the albums matching a filter, in the order of their ids
+   */
+  std::vector<size_t> GetAlbums(const AlbumFilter& filter) const;
+
+  const CArtist& GetArtist(size_t row) const { return m_artists[row]; }
+
+  /*!
+   \brief Get the details of an album
+   \note The play count and last played time are as of the creation of the index, see
+   GetAlbumPlayed()
+   */
+  const CAlbum& GetAlbum(size_t row) const { return m_albums[row]; }
+
+  /*!
+   \brief Get the current play count and last played time of an album
+   */
+  void GetAlbumPlayed(size_t row, int& timesPlayed, CDateTime& lastPlayed) const;
+
+  size_t GetSongCount() const { return m_songAlbums.size(); }
+
+  /*!
+   \brief Get the index of the library if it's up to date
+   \param lastUpdated time the library was last updated, as stored in the database
+   \return the index, or nullptr if it needs to be (re)built
+   */
+  static std::shared_ptr<const CMusicLibraryIndex> Get(const std::string& lastUpdated);
+
+  /*!
+   \brief Start building the index of the library, unless already building
+   \param generation [out] to pass to EndBuild()
+   \return true if the caller should build the index
+   */
+  static bool BeginBuild(uint64_t& generation);
+
+  /*!
+   \brief Set the index of the library built by the caller of BeginBuild()
+   \param generation as returned by BeginBuild(), the index is dropped if invalidated since
+   \param index the index, nullptr if building failed
+   \param lastUpdated time the library was last updated when the build started
+   */
+  static void EndBuild(uint64_t generation,
+                       std::shared_ptr<const CMusicLibraryIndex> index,
+                       const std::string& lastUpdated);
+
+  /*!
+   \brief Drop the index of the library after it has been changed
+   */
+  static void Invalidate();
+
+  /*!
+   \brief Update the play count of an album in the index of the library after one of its songs
+   was played
+   \param idAlbum id of the album
+   \param timesPlayed play count of the album, as in albumview
+   \param lastPlayed last played time of the album, as in albumview
+   */
+  static void SetAlbumPlayed(int idAlbum, int timesPlayed, const CDateTime& lastPlayed);
+
+private:
+  struct Played
+  {
+    int timesPlayed{0};
+    CDateTime lastPlayed;
+  };
+
+  static constexpr uint32_t NO_ROW = UINT32_MAX;
+
+  /*!
+   \brief Links from the rows of a table to rows or ids of another, the links of row i are
+   values[offsets[i]] to values[offsets[i + 1]]
+   */
+  struct Links
+  {
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> values;
+
+    size_t Begin(size_t row) const { return offsets[row]; }
+    size_t End(size_t row) const { return offsets[row + 1]; }
+  };
+
+  static Links CreateLinks(size_t rows, std::vector<std::pair<uint32_t, uint32_t>>& pairs);
+  std::vector<uint8_t> GetAlbumsWithGenre(int idGenre) const;
+  bool SongHasGenre(size_t song, int idGenre) const;
+
+  // artists ordered by id
+  std::vector<int> m_artistIds;
+  std::vector<CArtist> m_artists;
+
+  // albums ordered by id
+  std::vector<int> m_albumIds;
+  std::vector<uint8_t> m_albumIsSingle;
+  Links m_albumArtists; ///< artist rows of the album artists
+  std::vector<CAlbum> m_albums;
+  mutable CCriticalSection m_playedSection;
+  mutable std::vector<Played> m_albumPlayed; ///< updated by SetAlbumPlayed()
+
+  // songs ordered by id
+  std::vector<uint32_t> m_songAlbums; ///< album row of the song, NO_ROW if unknown
+  Links m_songGenres; ///< genre ids of the songs
+  Links m_songArtists; ///< artist rows of the song artists in the role of artist
+};
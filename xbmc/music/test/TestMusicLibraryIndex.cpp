@@ -0,0 +1,167 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "music/MusicLibraryIndex.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+enum Genre
+{
+  ROCK = 1,
+  JAZZ = 2
+};
+
+CArtist Artist(int id, const std::string& name)
+{
+  CArtist artist;
+  artist.idArtist = id;
+  artist.strArtist = name;
+  return artist;
+}
+
+CAlbum Album(int id, const std::string& title, CAlbum::ReleaseType releaseType = CAlbum::Album)
+{
+  CAlbum album;
+  album.idAlbum = id;
+  album.strAlbum = title;
+  album.releaseType = releaseType;
+  return album;
+}
+
+/*
+ artist 1 has rock album 10 and jazz single 11
+ artist 2 has jazz album 12, and features on a rock song of album 10
+ artist 3 only features on songs, artist 4 has no name
+ */
+CMusicLibraryIndex::Source CreateLibrary()
+{
+  CMusicLibraryIndex::Source source;
+  // out of order, the index orders by id
+  source.artists = {Artist(2, "Two"), Artist(1, "One"), Artist(3, "Three"), Artist(4, "")};
+  source.albums = {Album(12, "Jazz"), Album(10, "Rock"), Album(11, "Single", CAlbum::Single)};
+  source.albumArtists = {{10, 1}, {11, 1}, {12, 2}, {12, 4}};
+  source.songs = {{100, 10}, {101, 10}, {102, 11}, {103, 12}, {104, 12}};
+  source.songGenres = {{100, ROCK}, {101, ROCK}, {102, JAZZ}, {103, JAZZ}, {104, JAZZ}};
+  source.songArtists = {{100, 1}, {101, 1}, {101, 2}, {102, 1}, {103, 2}, {104, 3}};
+  return source;
+}
+
+std::vector<int> GetArtistIds(const CMusicLibraryIndex& index,
+                              const CMusicLibraryIndex::ArtistFilter& filter)
+{
+  std::vector<int> ids;
+  for (const size_t row : index.GetArtists(filter))
+    ids.emplace_back(index.GetArtist(row).idArtist);
+  return ids;
+}
+
+std::vector<int> GetAlbumIds(const CMusicLibraryIndex& index,
+                             const CMusicLibraryIndex::AlbumFilter& filter)
+{
+  std::vector<int> ids;
+  for (const size_t row : index.GetAlbums(filter))
+    ids.emplace_back(index.GetAlbum(row).idAlbum);
+  return ids;
+}
+} // namespace
+
+TEST(TestMusicLibraryIndex, Artists)
+{
+  const CMusicLibraryIndex index(CreateLibrary());
+  EXPECT_EQ(5u, index.GetSongCount());
+
+  EXPECT_EQ((std::vector<int>{1, 2, 3}), GetArtistIds(index, {}));
+  EXPECT_EQ((std::vector<int>{1, 2}), GetArtistIds(index, {.albumArtistsOnly = true}));
+
+  // artist 2 features on a rock song, artist 1 has a jazz single
+  EXPECT_EQ((std::vector<int>{1, 2}), GetArtistIds(index, {.idGenre = ROCK}));
+  EXPECT_EQ((std::vector<int>{1}), GetArtistIds(index, {.albumArtistsOnly = true, .idGenre = ROCK}));
+  EXPECT_EQ((std::vector<int>{1, 2, 3}), GetArtistIds(index, {.idGenre = JAZZ}));
+}
+
+TEST(TestMusicLibraryIndex, Albums)
+{
+  const CMusicLibraryIndex index(CreateLibrary());
+
+  EXPECT_EQ((std::vector<int>{10, 12}), GetAlbumIds(index, {}));
+  EXPECT_EQ((std::vector<int>{10, 11, 12}), GetAlbumIds(index, {.showSingles = true}));
+  EXPECT_EQ((std::vector<int>{12}), GetAlbumIds(index, {.idGenre = JAZZ}));
+
+  // singles are listed for an artist, and albums the artist features on
+  EXPECT_EQ((std::vector<int>{10, 11}), GetAlbumIds(index, {.idArtist = 1}));
+  EXPECT_EQ((std::vector<int>{10, 12}), GetAlbumIds(index, {.idArtist = 2}));
+  EXPECT_EQ((std::vector<int>{12}), GetAlbumIds(index, {.albumArtistsOnly = true, .idArtist = 2}));
+  EXPECT_EQ((std::vector<int>{12}), GetAlbumIds(index, {.idArtist = 3}));
+  EXPECT_EQ((std::vector<int>{11}), GetAlbumIds(index, {.idArtist = 1, .idGenre = JAZZ}));
+  EXPECT_EQ((std::vector<int>{12}), GetAlbumIds(index, {.idArtist = 4}));
+  EXPECT_TRUE(GetAlbumIds(index, {.idArtist = 5}).empty());
+}
+
+TEST(TestMusicLibraryIndex, Invalidate)
+{
+  uint64_t generation;
+  ASSERT_TRUE(CMusicLibraryIndex::BeginBuild(generation));
+  uint64_t other;
+  EXPECT_FALSE(CMusicLibraryIndex::BeginBuild(other));
+  CMusicLibraryIndex::EndBuild(generation, std::make_shared<CMusicLibraryIndex>(CreateLibrary()),
+                               "2025-01-01 00:00:00");
+
+  EXPECT_NE(nullptr, CMusicLibraryIndex::Get("2025-01-01 00:00:00"));
+  // changed by another client of the database
+  EXPECT_EQ(nullptr, CMusicLibraryIndex::Get("2025-01-02 00:00:00"));
+
+  // an index built while the library changed is dropped
+  ASSERT_TRUE(CMusicLibraryIndex::BeginBuild(generation));
+  CMusicLibraryIndex::Invalidate();
+  EXPECT_EQ(nullptr, CMusicLibraryIndex::Get("2025-01-01 00:00:00"));
+  CMusicLibraryIndex::EndBuild(generation, std::make_shared<CMusicLibraryIndex>(CreateLibrary()),
+                               "2025-01-01 00:00:00");
+  EXPECT_EQ(nullptr, CMusicLibraryIndex::Get("2025-01-01 00:00:00"));
+}
+
+TEST(TestMusicLibraryIndex, SetAlbumPlayed)
+{
+  uint64_t generation;
+  ASSERT_TRUE(CMusicLibraryIndex::BeginBuild(generation));
+  CMusicLibraryIndex::EndBuild(generation, std::make_shared<CMusicLibraryIndex>(CreateLibrary()),
+                               "2025-01-01 00:00:00");
+  const auto index = CMusicLibraryIndex::Get("2025-01-01 00:00:00");
+  ASSERT_NE(nullptr, index);
+
+  // playing a song keeps the index and updates its album
+  const CDateTime played(2025, 1, 2, 12, 0, 0);
+  CMusicLibraryIndex::SetAlbumPlayed(12, 3, played);
+  CMusicLibraryIndex::SetAlbumPlayed(13, 1, played);
+  EXPECT_EQ(index, CMusicLibraryIndex::Get("2025-01-01 00:00:00"));
+
+  const std::vector<size_t> rows = index->GetAlbums({.idGenre = JAZZ});
+  ASSERT_EQ(1u, rows.size());
+  int timesPlayed;
+  CDateTime lastPlayed;
+  index->GetAlbumPlayed(rows[0], timesPlayed, lastPlayed);
+  EXPECT_EQ(3, timesPlayed);
+  EXPECT_EQ(played, lastPlayed);
+  index->GetAlbumPlayed(index->GetAlbums({.idGenre = ROCK})[0], timesPlayed, lastPlayed);
+  EXPECT_EQ(0, timesPlayed);
+
+  // an index being built may have missed the play
+  ASSERT_TRUE(CMusicLibraryIndex::BeginBuild(generation));
+  CMusicLibraryIndex::SetAlbumPlayed(12, 4, played);
+  CMusicLibraryIndex::EndBuild(generation, std::make_shared<CMusicLibraryIndex>(CreateLibrary()),
+                               "2025-01-01 00:00:00");
+  EXPECT_EQ(index, CMusicLibraryIndex::Get("2025-01-01 00:00:00"));
+  index->GetAlbumPlayed(rows[0], timesPlayed, lastPlayed);
+  EXPECT_EQ(4, timesPlayed);
+  CMusicLibraryIndex::Invalidate();
+}
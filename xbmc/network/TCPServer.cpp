@@ -540,14 +540,18 @@ bool CTCPServer::CTCPClient::SetAnnouncementFlags(int flags)
   return true;
 }
 
-void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
+bool CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
 {
   unsigned int sent = 0;
   do
   {
     std::unique_lock lock(m_critSection);
-    sent += send(m_socket, data + sent, size - sent, 0);
+    const auto result = send(m_socket, data + sent, size - sent, 0);
+    if (result < 0)
+      return false;
+    sent += static_cast<unsigned int>(result);
   } while (sent < size);
+  return true;
 }
 
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
@@ -613,8 +617,7 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
       }
       if (m_beginBrackets > 0 && m_endBrackets > 0 && m_beginBrackets == m_endBrackets)
       {
-        std::string line = CJSONRPC::MethodCall(m_buffer, host, this);
-        Send(line.c_str(), line.size());
+        SendResponse(host, m_buffer);
         m_beginChar = m_beginBrackets = m_endBrackets = 0;
         m_buffer.clear();
       }
@@ -622,6 +625,46 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
   }
 }
 
+void CTCPServer::CTCPClient::SendResponse(CTCPServer* host, const std::string& request)
+{
+  // send the response while it's written, keeping announcements from being sent in between. The
+  // first chunk is held back, so a response fitting into it is only sent once it's complete.
+  std::unique_lock lock(m_critSection, std::defer_lock);
+  std::string first;
+  bool held = false;
+  const bool success = CJSONRPC::MethodCall(
+      request, host, this,
+      [this, &lock, &first, &held](std::string_view chunk)
+      {
+        if (!held)
+        {
+          first.assign(chunk);
+          held = true;
+          return true;
+        }
+        if (!lock.owns_lock())
+        {
+          lock.lock();
+          if (!Send(first.data(), static_cast<unsigned int>(first.size())))
+            return false;
+        }
+        return Send(chunk.data(), static_cast<unsigned int>(chunk.size()));
+      });
+
+  if (success && held && !lock.owns_lock())
+  {
+    lock.lock();
+    Send(first.data(), static_cast<unsigned int>(first.size()));
+  }
+  else if (!success && lock.owns_lock())
+  {
+    // the client can't tell the truncated response from the rest of the stream
+    CLog::Log(LOGERROR, "JSONRPC Server: Failed to write the response, closing the connection");
+    lock.unlock();
+    Disconnect();
+  }
+}
+
 void CTCPServer::CTCPClient::Disconnect()
 {
   if (m_socket > 0)
@@ -683,15 +726,20 @@ CTCPServer::CWebSocketClient& CTCPServer::CWebSocketClient::operator=(const CWeb
   return *this;
 }
 
-void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
+bool CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
 {
   const CWebSocketMessage *msg = m_websocket->Send(WebSocketTextFrame, data, size);
   if (msg == NULL || !msg->IsComplete())
-    return;
+    return false;
 
   std::vector<const CWebSocketFrame *> frames = msg->GetFrames();
   for (unsigned int index = 0; index < frames.size(); index++)
-    CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
+  {
+    if (!CTCPClient::Send(frames.at(index)->GetFrameData(),
+                          (unsigned int)frames.at(index)->GetFrameLength()))
+      return false;
+  }
+  return true;
 }
 
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
@@ -739,6 +787,13 @@ void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buff
     Disconnect();
 }
 
+void CTCPServer::CWebSocketClient::SendResponse(CTCPServer* host, const std::string& request)
+{
+  // the response has to be sent as a single message
+  std::string response = CJSONRPC::MethodCall(request, host, this);
+  Send(response.c_str(), static_cast<unsigned int>(response.size()));
+}
+
 void CTCPServer::CWebSocketClient::Disconnect()
 {
   if (m_socket > 0)
@@ -64,12 +64,13 @@ namespace JSONRPC
       int GetAnnouncementFlags() override;
       bool SetAnnouncementFlags(int flags) override;
 
-      virtual void Send(const char *data, unsigned int size);
+      virtual bool Send(const char *data, unsigned int size);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
+      virtual void SendResponse(CTCPServer* host, const std::string& request);
       virtual void Disconnect();
 
       virtual bool IsNew() const { return m_new; }
-      virtual bool Closing() const { return false; }
+      virtual bool Closing() const { return m_socket == INVALID_SOCKET; }
 
       SOCKET m_socket{INVALID_SOCKET};
       sockaddr_storage m_cliaddr;
@@ -95,8 +96,9 @@ namespace JSONRPC
       CWebSocketClient& operator=(const CWebSocketClient& client);
       ~CWebSocketClient() override;
 
-      void Send(const char *data, unsigned int size) override;
+      bool Send(const char *data, unsigned int size) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
+      void SendResponse(CTCPServer* host, const std::string& request) override;
       void Disconnect() override;
 
       bool IsNew() const override { return m_websocket == NULL; }
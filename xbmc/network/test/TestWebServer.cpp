@@ -13,6 +13,7 @@
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "filesystem/CurlFile.h"
+#include "filesystem/DllLibCurl.h"
 #include "filesystem/File.h"
 #include "interfaces/json-rpc/JSONRPC.h"
 #include "network/DNSNameCache.h"
@@ -573,6 +574,27 @@ TEST_F(TestWebServer, CanGetFile)
   CheckHtmlTestFileResponse(curl);
 }
 
+TEST_F(TestWebServer, CanReuseConnectionAcrossCurlFiles)
+{
+  const XCURL::DllLibCurlGlobal::Stats before = g_curlInterface.GetStats();
+
+  for (int i = 0; i < 3; i++)
+  {
+    std::string result;
+    CCurlFile curl;
+    curl.SetRequestHeader(MHD_HTTP_HEADER_RANGE, "");
+    ASSERT_TRUE(curl.Get(GetUrlOfTestFile(TEST_FILES_HTML), result));
+    ASSERT_STREQ(TEST_FILES_DATA, result.c_str());
+  }
+
+  // the first request may find a session of a previous test, later requests find this one's
+  const XCURL::DllLibCurlGlobal::Stats after = g_curlInterface.GetStats();
+  EXPECT_EQ(3u, after.transfers - before.transfers);
+  EXPECT_GE(after.sessionsReused - before.sessionsReused, 2u);
+  EXPECT_LE(after.connectionsCreated - before.connectionsCreated, 1u);
+  EXPECT_GE(after.connectionsReused - before.connectionsReused, 2u);
+}
+
 TEST_F(TestWebServer, CanGetFileForcingNoCache)
 {
   // check non-cacheable HTML with Control-Cache: no-cache
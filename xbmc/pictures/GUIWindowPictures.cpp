@@ -16,6 +16,7 @@
 #include "GUIWindowSlideShow.h"
 #include "PictureInfoLoader.h"
 #include "ServiceBroker.h"
+#include "TextureCacheJob.h"
 #include "URL.h"
 #include "Util.h"
 #include "addons/gui/GUIDialogAddonInfo.h"
@@ -27,6 +28,7 @@
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/actions/ActionIDs.h"
+#include "jobs/JobManager.h"
 #include "media/MediaLockState.h"
 #include "messaging/helpers/DialogOKHelper.h"
 #include "pictures/SlideShowDelegator.h"
@@ -434,6 +436,12 @@ void CGUIWindowPictures::OnRegenerateThumbs()
   m_thumbLoader.Load(*m_vecItems);
 }
 
+void CGUIWindowPictures::OnCacheThumbsRecursive(const std::string& strPath)
+{
+  CServiceBroker::GetJobManager()->AddJob(new CTextureCacheBatchJob(strPath), nullptr,
+                                          CJob::PRIORITY_LOW_PAUSABLE);
+}
+
 void CGUIWindowPictures::GetContextButtons(int itemNumber, CContextButtons &buttons)
 {
   CFileItemPtr item;
@@ -463,6 +471,8 @@ void CGUIWindowPictures::GetContextButtons(int itemNumber, CContextButtons &butt
 
         if (!m_thumbLoader.IsLoading())
           buttons.Add(CONTEXT_BUTTON_REFRESH_THUMBS, 13315);         // Create Thumbnails
+        if (item->IsFolder() && !item->IsParentFolder())
+          buttons.Add(CONTEXT_BUTTON_RECURSIVE_THUMBS, 13316); // Recursive thumbnails
         if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(CSettings::SETTING_FILELISTS_ALLOWFILEDELETION) && !item->IsReadOnly())
         {
           buttons.Add(CONTEXT_BUTTON_DELETE, 117);
@@ -503,6 +513,10 @@ bool CGUIWindowPictures::OnContextButton(int itemNumber, CONTEXT_BUTTON button)
   case CONTEXT_BUTTON_REFRESH_THUMBS:
     OnRegenerateThumbs();
     return true;
+  case CONTEXT_BUTTON_RECURSIVE_THUMBS:
+    if (item)
+      OnCacheThumbsRecursive(item->GetPath());
+    return true;
   case CONTEXT_BUTTON_DELETE:
     OnDeleteItem(itemNumber);
     return true;
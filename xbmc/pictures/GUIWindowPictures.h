@@ -34,6 +34,7 @@ protected:
   std::string GetStartFolder(const std::string &dir) override;
 
   void OnRegenerateThumbs();
+  void OnCacheThumbsRecursive(const std::string& strPath);
   bool OnPlayMedia(int iItem, const std::string &player = "") override;
   bool ShowPicture(int iItem, bool startSlideShow);
   void OnShowPictureRecursive(const std::string& strPath);
@@ -22,13 +22,262 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <vector>
 
 extern "C" {
 #include <libswscale/swscale.h>
 }
 
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#define PICTURE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PICTURE_NEON
+#include <arm_neon.h>
+#endif
+
 using namespace XFILE;
 
+namespace
+{
+constexpr size_t MAX_CACHED_SCALE_CONTEXTS = 4;
+// edge length in pixels of the tiles transposed at once, so their source and destination lines
+// stay in the cache and TLB
+constexpr unsigned int TRANSPOSE_TILE_SIZE = 16;
+
+struct ScaleParams
+{
+  unsigned int inWidth;
+  unsigned int inHeight;
+  AVPixelFormat inFormat;
+  unsigned int outWidth;
+  unsigned int outHeight;
+  AVPixelFormat outFormat;
+  int flags;
+
+  bool operator==(const ScaleParams& other) const = default;
+};
+
+/*!
+ * \brief The swscale contexts last used by a thread, most recently used first.
+ *
+ * Creating a context computes the filter coefficients, which takes about as long as scaling a
+ * thumbnail. Images of a library mostly share a few sizes, so the contexts are kept for reuse.
+ */
+class CScaleContextCache
+{
+public:
+  ~CScaleContextCache()
+  {
+    for (const auto& [_, context] : m_contexts)
+      sws_freeContext(context);
+  }
+
+  SwsContext* Get(const ScaleParams& params)
+  {
+    auto it = std::ranges::find(m_contexts, params, &std::pair<ScaleParams, SwsContext*>::first);
+    if (it == m_contexts.end())
+    {
+      SwsContext* context = sws_getContext(params.inWidth, params.inHeight, params.inFormat,
+                                           params.outWidth, params.outHeight, params.outFormat,
+                                           params.flags, nullptr, nullptr, nullptr);
+      if (!context)
+        return nullptr;
+
+      if (m_contexts.size() == MAX_CACHED_SCALE_CONTEXTS)
+      {
+        sws_freeContext(m_contexts.back().second);
+        m_contexts.pop_back();
+      }
+      it = m_contexts.emplace(m_contexts.end(), params, context);
+    }
+
+    std::rotate(m_contexts.begin(), it, it + 1);
+    return m_contexts.front().second;
+  }
+
+private:
+  std::vector<std::pair<ScaleParams, SwsContext*>> m_contexts;
+};
+
+thread_local CScaleContextCache scaleContextCache;
+
+#if defined(PICTURE_SSE2)
+using Pixels4 = __m128i;
+
+Pixels4 Load4(const uint32_t* src)
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+void Store4(uint32_t* dst, Pixels4 pixels)
+{
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), pixels);
+}
+
+Pixels4 Reverse4(Pixels4 pixels)
+{
+  return _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+void Transpose4x4(Pixels4& row0, Pixels4& row1, Pixels4& row2, Pixels4& row3)
+{
+  const __m128i t0 = _mm_unpacklo_epi32(row0, row1);
+  const __m128i t1 = _mm_unpacklo_epi32(row2, row3);
+  const __m128i t2 = _mm_unpackhi_epi32(row0, row1);
+  const __m128i t3 = _mm_unpackhi_epi32(row2, row3);
+  row0 = _mm_unpacklo_epi64(t0, t1);
+  row1 = _mm_unpackhi_epi64(t0, t1);
+  row2 = _mm_unpacklo_epi64(t2, t3);
+  row3 = _mm_unpackhi_epi64(t2, t3);
+}
+#elif defined(PICTURE_NEON)
+using Pixels4 = uint32x4_t;
+
+Pixels4 Load4(const uint32_t* src)
+{
+  return vld1q_u32(src);
+}
+
+void Store4(uint32_t* dst, Pixels4 pixels)
+{
+  vst1q_u32(dst, pixels);
+}
+
+Pixels4 Reverse4(Pixels4 pixels)
+{
+  const uint32x4_t swapped = vrev64q_u32(pixels);
+  return vcombine_u32(vget_high_u32(swapped), vget_low_u32(swapped));
+}
+
+void Transpose4x4(Pixels4& row0, Pixels4& row1, Pixels4& row2, Pixels4& row3)
+{
+  const uint32x4x2_t t01 = vtrnq_u32(row0, row1);
+  const uint32x4x2_t t23 = vtrnq_u32(row2, row3);
+  row0 = vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0]));
+  row1 = vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1]));
+  row2 = vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0]));
+  row3 = vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1]));
+}
+#endif
+
+/*!
+ * \brief Swap line1[x] with line2[width - 1 - x]. Reverses the line if both are the same.
+ */
+void SwapReversed(uint32_t* line1, uint32_t* line2, unsigned int width)
+{
+  uint32_t* left = line1;
+  uint32_t* right = line2 + width;
+  if (line1 == line2)
+    width /= 2;
+
+#if defined(PICTURE_SSE2) || defined(PICTURE_NEON)
+  for (; width >= 4; width -= 4)
+  {
+    right -= 4;
+    const Pixels4 pixels = Load4(left);
+    Store4(left, Reverse4(Load4(right)));
+    Store4(right, Reverse4(pixels));
+    left += 4;
+  }
+#endif
+
+  for (; width > 0; --width)
+    std::swap(*left++, *--right);
+}
+
+/*!
+ * \brief Copy 4x4 pixels to their transposed position.
+ * \param src first pixel of the block
+ * \param dst destination of the first column of the block
+ * \param dstRowStep distance of the destinations of consecutive columns
+ * \param reverse store the columns right to left
+ */
+void TransposeBlock(
+    const uint32_t* src, ptrdiff_t srcStride, uint32_t* dst, ptrdiff_t dstRowStep, bool reverse)
+{
+#if defined(PICTURE_SSE2) || defined(PICTURE_NEON)
+  Pixels4 rows[4] = {Load4(src), Load4(src + srcStride), Load4(src + 2 * srcStride),
+                     Load4(src + 3 * srcStride)};
+  Transpose4x4(rows[0], rows[1], rows[2], rows[3]);
+  for (const Pixels4& row : rows)
+  {
+    Store4(dst, reverse ? Reverse4(row) : row);
+    dst += dstRowStep;
+  }
+#else
+  for (int x = 0; x < 4; ++x, dst += dstRowStep)
+  {
+    for (int y = 0; y < 4; ++y)
+      dst[reverse ? 3 - y : y] = src[y * srcStride + x];
+  }
+#endif
+}
+
+/*!
+ * \brief Allocate the uninitialized buffer for a transposed image, with the same padding as the
+ * buffers of scaled images, as the encoders may read a few pixels past the last line.
+ */
+std::unique_ptr<uint32_t[]> CreateTransposedBuffer(unsigned int width, unsigned int height)
+{
+  return std::make_unique_for_overwrite<uint32_t[]>(static_cast<size_t>(width) * height + 4);
+}
+
+/*!
+ * \brief Write the transposed image, optionally mirrored, to a buffer of height x width pixels.
+ * \param flipX the columns of the source become the destination rows from bottom to top
+ * \param flipY the rows of the source become the destination columns from right to left
+ */
+void TransposeImage(const uint32_t* src,
+                    unsigned int width,
+                    unsigned int height,
+                    unsigned int stridePixels,
+                    uint32_t* dst,
+                    bool flipX,
+                    bool flipY)
+{
+  const ptrdiff_t srcStride = stridePixels;
+  const ptrdiff_t dstStride = height;
+  auto destination = [&](unsigned int x, unsigned int y)
+  {
+    return dst + (flipX ? width - 1 - x : x) * dstStride + (flipY ? height - 1 - y : y);
+  };
+
+  // whole blocks of 4x4 pixels, a tile at a time
+  const unsigned int blocksWidth = width & ~3u;
+  const unsigned int blocksHeight = height & ~3u;
+  for (unsigned int tileY = 0; tileY < blocksHeight; tileY += TRANSPOSE_TILE_SIZE)
+  {
+    const unsigned int tileEndY = std::min(tileY + TRANSPOSE_TILE_SIZE, blocksHeight);
+    for (unsigned int tileX = 0; tileX < blocksWidth; tileX += TRANSPOSE_TILE_SIZE)
+    {
+      const unsigned int tileEndX = std::min(tileX + TRANSPOSE_TILE_SIZE, blocksWidth);
+      for (unsigned int y = tileY; y < tileEndY; y += 4)
+      {
+        for (unsigned int x = tileX; x < tileEndX; x += 4)
+        {
+          // the first pixel in the destination row of the block's first column
+          uint32_t* dstBlock = destination(x, flipY ? y + 3 : y);
+          TransposeBlock(src + y * srcStride + x, srcStride, dstBlock,
+                         flipX ? -dstStride : dstStride, flipY);
+        }
+      }
+    }
+  }
+
+  // the remaining columns on the right and rows at the bottom
+  for (unsigned int y = 0; y < height; ++y)
+  {
+    const uint32_t* line = src + y * srcStride;
+    for (unsigned int x = y < blocksHeight ? blocksWidth : 0; x < width; ++x)
+      *destination(x, y) = line[x];
+  }
+}
+} // unnamed namespace
+
 bool CPicture::GetThumbnailFromSurface(const unsigned char* buffer, int width, int height, int stride, const std::string &thumbFile, uint8_t* &result, size_t& result_size)
 {
   unsigned char *thumb = NULL;
@@ -355,9 +604,9 @@ bool CPicture::ScaleImage(uint8_t* in_pixels,
                           CPictureScalingAlgorithm::Algorithm
                               scalingAlgorithm /* = CPictureScalingAlgorithm::NoAlgorithm */)
 {
-  struct SwsContext* context =
-      sws_getContext(in_width, in_height, in_format, out_width, out_height, out_format,
-                     CPictureScalingAlgorithm::ToSwscale(scalingAlgorithm), NULL, NULL, NULL);
+  SwsContext* context =
+      scaleContextCache.Get({in_width, in_height, in_format, out_width, out_height, out_format,
+                             CPictureScalingAlgorithm::ToSwscale(scalingAlgorithm)});
 
   uint8_t *src[] = { in_pixels, 0, 0, 0 };
   int     srcStride[] = { (int)in_pitch, 0, 0, 0 };
@@ -367,7 +616,6 @@ bool CPicture::ScaleImage(uint8_t* in_pixels,
   if (context)
   {
     sws_scale(context, src, srcStride, 0, in_height, dst, dstStride);
-    sws_freeContext(context);
     return true;
   }
   return false;
@@ -379,7 +627,6 @@ bool CPicture::OrientateImage(std::unique_ptr<uint32_t[]>& pixels,
                               int orientation,
                               unsigned int& stridePixels)
 {
-  // ideas for speeding these functions up: http://cgit.freedesktop.org/pixman/tree/pixman/pixman-fast-path.c
   bool out = false;
   switch (orientation)
   {
@@ -420,8 +667,7 @@ bool CPicture::FlipHorizontal(std::unique_ptr<uint32_t[]>& pixels,
   for (unsigned int y = 0; y < height; ++y)
   {
     uint32_t* line = pixels.get() + y * stridePixels;
-    for (unsigned int x = 0; x < width / 2; ++x)
-      std::swap(line[x], line[width - 1 - x]);
+    SwapReversed(line, line, width);
   }
   return true;
 }
@@ -436,8 +682,7 @@ bool CPicture::FlipVertical(std::unique_ptr<uint32_t[]>& pixels,
   {
     uint32_t* line1 = pixels.get() + y * stridePixels;
     uint32_t* line2 = pixels.get() + (height - 1 - y) * stridePixels;
-    for (unsigned int x = 0; x < width; ++x)
-      std::swap(*line1++, *line2++);
+    std::swap_ranges(line1, line1 + width, line2);
   }
   return true;
 }
@@ -451,15 +696,13 @@ bool CPicture::Rotate180CCW(std::unique_ptr<uint32_t[]>& pixels,
   for (unsigned int y = 0; y < height / 2; ++y)
   {
     uint32_t* line1 = pixels.get() + y * stridePixels;
-    uint32_t* line2 = pixels.get() + (height - 1 - y) * stridePixels + width - 1;
-    for (unsigned int x = 0; x < width; ++x)
-      std::swap(*line1++, *line2--);
+    uint32_t* line2 = pixels.get() + (height - 1 - y) * stridePixels;
+    SwapReversed(line1, line2, width);
   }
   if (height % 2)
   { // height is odd, so flip the middle row as well
     uint32_t* line = pixels.get() + (height - 1) / 2 * stridePixels;
-    for (unsigned int x = 0; x < width / 2; ++x)
-      std::swap(line[x], line[width - 1 - x]);
+    SwapReversed(line, line, width);
   }
   return true;
 }
@@ -469,18 +712,8 @@ bool CPicture::Rotate90CCW(std::unique_ptr<uint32_t[]>& pixels,
                            unsigned int& height,
                            unsigned int& stridePixels)
 {
-  auto dest = std::make_unique<uint32_t[]>(width * height * 4);
-  unsigned int d_height = width, d_width = height;
-  for (unsigned int y = 0; y < d_height; y++)
-  {
-    const uint32_t* src = pixels.get() + (d_height - 1 - y); // y-th col from right, starting at top
-    uint32_t* dst = dest.get() + d_width * y; // y-th row from top, starting at left
-    for (unsigned int x = 0; x < d_width; x++)
-    {
-      *dst++ = *src;
-      src += stridePixels;
-    }
-  }
+  auto dest = CreateTransposedBuffer(width, height);
+  TransposeImage(pixels.get(), width, height, stridePixels, dest.get(), true, false);
   pixels = std::move(dest);
   std::swap(width, height);
   stridePixels = width;
@@ -492,20 +725,8 @@ bool CPicture::Rotate270CCW(std::unique_ptr<uint32_t[]>& pixels,
                             unsigned int& height,
                             unsigned int& stridePixels)
 {
-  auto dest = std::make_unique<uint32_t[]>(width * height * 4);
-  unsigned int d_height = width, d_width = height;
-  for (unsigned int y = 0; y < d_height; y++)
-  {
-    const uint32_t* src =
-        pixels.get() + stridePixels * (d_width - 1) + y; // y-th col from left, starting at bottom
-    uint32_t* dst = dest.get() + d_width * y; // y-th row from top, starting at left
-    for (unsigned int x = 0; x < d_width; x++)
-    {
-      *dst++ = *src;
-      src -= stridePixels;
-    }
-  }
-
+  auto dest = CreateTransposedBuffer(width, height);
+  TransposeImage(pixels.get(), width, height, stridePixels, dest.get(), false, true);
   pixels = std::move(dest);
   std::swap(width, height);
   stridePixels = width;
@@ -517,19 +738,8 @@ bool CPicture::Transpose(std::unique_ptr<uint32_t[]>& pixels,
                          unsigned int& height,
                          unsigned int& stridePixels)
 {
-  auto dest = std::make_unique<uint32_t[]>(width * height * 4);
-  unsigned int d_height = width, d_width = height;
-  for (unsigned int y = 0; y < d_height; y++)
-  {
-    const uint32_t* src = pixels.get() + y; // y-th col from left, starting at top
-    uint32_t* dst = dest.get() + d_width * y; // y-th row from top, starting at left
-    for (unsigned int x = 0; x < d_width; x++)
-    {
-      *dst++ = *src;
-      src += stridePixels;
-    }
-  }
-
+  auto dest = CreateTransposedBuffer(width, height);
+  TransposeImage(pixels.get(), width, height, stridePixels, dest.get(), false, false);
   pixels = std::move(dest);
   std::swap(width, height);
   stridePixels = width;
@@ -541,20 +751,8 @@ bool CPicture::TransposeOffAxis(std::unique_ptr<uint32_t[]>& pixels,
                                 unsigned int& height,
                                 unsigned int& stridePixels)
 {
-  auto dest = std::make_unique<uint32_t[]>(width * height * 4);
-  unsigned int d_height = width, d_width = height;
-  for (unsigned int y = 0; y < d_height; y++)
-  {
-    const uint32_t* src = pixels.get() + stridePixels * (d_width - 1) +
-                          (d_height - 1 - y); // y-th col from right, starting at bottom
-    uint32_t* dst = dest.get() + d_width * y; // y-th row, starting at left
-    for (unsigned int x = 0; x < d_width; x++)
-    {
-      *dst++ = *src;
-      src -= stridePixels;
-    }
-  }
-
+  auto dest = CreateTransposedBuffer(width, height);
+  TransposeImage(pixels.get(), width, height, stridePixels, dest.get(), true, true);
   pixels = std::move(dest);
   std::swap(width, height);
   stridePixels = width;
@@ -75,13 +75,21 @@ public:
       AVPixelFormat out_format,
       CPictureScalingAlgorithm::Algorithm scalingAlgorithm = CPictureScalingAlgorithm::NoAlgorithm);
 
-private:
+  /*! \brief Flip or rotate an image of 32 bit pixels according to its EXIF orientation
+   \param pixels [in/out] the image - replaced with a new buffer if rotated by 90 or 270 degrees
+   \param width [in/out] width in pixels - swapped with the height if rotated by 90 or 270 degrees
+   \param height [in/out] height in pixels
+   \param orientation the EXIF orientation minus one, from 1 to 7
+   \param stridePixels [in/out] distance of the lines in pixels - the width if a new buffer is used
+   \return true if successful, false for an unknown orientation
+   */
   static bool OrientateImage(std::unique_ptr<uint32_t[]>& pixels,
                              unsigned int& width,
                              unsigned int& height,
                              int orientation,
                              unsigned int& stridePixels);
 
+private:
   static bool FlipHorizontal(std::unique_ptr<uint32_t[]>& pixels,
                              const unsigned int& width,
                              const unsigned int& height,
@@ -0,0 +1,201 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "pictures/Picture.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <libswscale/swscale.h>
+}
+
+namespace
+{
+std::vector<uint32_t> CreateImage(unsigned int stridePixels, unsigned int height)
+{
+  std::vector<uint32_t> pixels(stridePixels * height);
+  for (size_t i = 0; i < pixels.size(); i++)
+    pixels[i] = static_cast<uint32_t>(i * 2654435761u);
+  return pixels;
+}
+
+// the source pixel shown at (x, y) for an orientation as used by CPicture::OrientateImage
+uint32_t GetOrientedPixel(const std::vector<uint32_t>& pixels,
+                          unsigned int width,
+                          unsigned int height,
+                          unsigned int stridePixels,
+                          int orientation,
+                          unsigned int x,
+                          unsigned int y)
+{
+  switch (orientation)
+  {
+    case 1: // flip horizontal
+      return pixels[y * stridePixels + width - 1 - x];
+    case 2: // rotate 180
+      return pixels[(height - 1 - y) * stridePixels + width - 1 - x];
+    case 3: // flip vertical
+      return pixels[(height - 1 - y) * stridePixels + x];
+    case 4: // transpose
+      return pixels[x * stridePixels + y];
+    case 5: // rotate 270 ccw
+      return pixels[(height - 1 - x) * stridePixels + y];
+    case 6: // transpose off axis
+      return pixels[(height - 1 - x) * stridePixels + width - 1 - y];
+    default: // rotate 90 ccw
+      return pixels[x * stridePixels + width - 1 - y];
+  }
+}
+
+bool Scale(const std::vector<uint32_t>& in,
+           unsigned int inWidth,
+           unsigned int inHeight,
+           std::vector<uint32_t>& out,
+           unsigned int outWidth,
+           unsigned int outHeight)
+{
+  out.assign(outWidth * outHeight + 4, 0);
+  return CPicture::ScaleImage(
+      reinterpret_cast<uint8_t*>(const_cast<uint32_t*>(in.data())), inWidth, inHeight, inWidth * 4,
+      AV_PIX_FMT_BGRA, reinterpret_cast<uint8_t*>(out.data()), outWidth, outHeight, outWidth * 4,
+      AV_PIX_FMT_BGRA, CPictureScalingAlgorithm::Bicubic);
+}
+} // namespace
+
+TEST(TestPicture, OrientateImage)
+{
+  // sizes around the blocks and tiles of the kernels, lines with and without padding
+  for (const auto& [width, height] : std::vector<std::pair<unsigned int, unsigned int>>{
+           {1, 1}, {1, 7}, {7, 1}, {3, 5}, {4, 4}, {17, 9}, {64, 33}, {100, 67}, {67, 130}})
+  {
+    for (unsigned int padding : {0u, 3u})
+    {
+      const unsigned int stridePixels = width + padding;
+      const std::vector<uint32_t> image = CreateImage(stridePixels, height);
+      for (int orientation = 1; orientation <= 7; orientation++)
+      {
+        auto pixels = std::make_unique<uint32_t[]>(image.size());
+        std::ranges::copy(image, pixels.get());
+        unsigned int orientedWidth = width;
+        unsigned int orientedHeight = height;
+        unsigned int orientedStride = stridePixels;
+        ASSERT_TRUE(CPicture::OrientateImage(pixels, orientedWidth, orientedHeight, orientation,
+                                             orientedStride));
+        ASSERT_EQ(orientation >= 4 ? height : width, orientedWidth);
+        ASSERT_EQ(orientation >= 4 ? width : height, orientedHeight);
+
+        unsigned int mismatches = 0;
+        for (unsigned int y = 0; y < orientedHeight; y++)
+        {
+          for (unsigned int x = 0; x < orientedWidth; x++)
+          {
+            mismatches += pixels[y * orientedStride + x] !=
+                          GetOrientedPixel(image, width, height, stridePixels, orientation, x, y);
+          }
+        }
+        EXPECT_EQ(0u, mismatches) << width << "x" << height << "+" << padding << ", orientation "
+                                  << orientation;
+      }
+    }
+  }
+
+  auto pixels = std::make_unique<uint32_t[]>(1);
+  unsigned int size = 1;
+  EXPECT_FALSE(CPicture::OrientateImage(pixels, size, size, 8, size));
+}
+
+TEST(TestPicture, ScaleImageReusesContexts)
+{
+  const std::vector<uint32_t> image = CreateImage(640, 480);
+
+  // more geometries than contexts are cached, each scaled the same when scaled again
+  const std::vector<std::pair<unsigned int, unsigned int>> sizes{
+      {320, 240}, {100, 75}, {64, 48}, {200, 150}, {33, 25}, {320, 240}};
+  std::vector<std::vector<uint32_t>> first;
+  for (const auto& [width, height] : sizes)
+  {
+    ASSERT_TRUE(Scale(image, 640, 480, first.emplace_back(), width, height));
+  }
+  for (size_t i = 0; i < sizes.size(); i++)
+  {
+    std::vector<uint32_t> again;
+    ASSERT_TRUE(Scale(image, 640, 480, again, sizes[i].first, sizes[i].second));
+    EXPECT_EQ(first[i], again) << sizes[i].first << "x" << sizes[i].second;
+  }
+  EXPECT_EQ(first.front(), first.back());
+}
+
+TEST(TestPicture, DISABLED_Benchmark)
+{
+  // a photo scaled to a thumbnail, then oriented
+  constexpr unsigned int PHOTO_WIDTH = 4000;
+  constexpr unsigned int PHOTO_HEIGHT = 3000;
+  constexpr unsigned int THUMB_WIDTH = 960;
+  constexpr unsigned int THUMB_HEIGHT = 720;
+  constexpr int ROUNDS = 10;
+
+  auto measure = [](const auto& function)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++)
+      function();
+    return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - start)
+                                .count() /
+                            ROUNDS);
+  };
+
+  const std::vector<uint32_t> photo = CreateImage(PHOTO_WIDTH, PHOTO_HEIGHT);
+  std::vector<uint32_t> thumb;
+  ASSERT_TRUE(Scale(photo, PHOTO_WIDTH, PHOTO_HEIGHT, thumb, THUMB_WIDTH, THUMB_HEIGHT));
+
+  // a context per scale, as created before contexts were cached
+  const int contextUs = measure(
+      [&]
+      {
+        SwsContext* context =
+            sws_getContext(PHOTO_WIDTH, PHOTO_HEIGHT, AV_PIX_FMT_BGRA, THUMB_WIDTH, THUMB_HEIGHT,
+                           AV_PIX_FMT_BGRA, SWS_BICUBIC, nullptr, nullptr, nullptr);
+        ASSERT_NE(nullptr, context);
+        sws_freeContext(context);
+      });
+  const int scaleUs =
+      measure([&] { EXPECT_TRUE(Scale(photo, PHOTO_WIDTH, PHOTO_HEIGHT, thumb, THUMB_WIDTH,
+                                      THUMB_HEIGHT)); });
+
+  // each round orients a copy of the scaled thumbnail, the copy included
+  int orientUs = 0;
+  for (int orientation = 1; orientation <= 7; orientation++)
+  {
+    orientUs += measure(
+        [&]
+        {
+          auto pixels = std::make_unique_for_overwrite<uint32_t[]>(thumb.size());
+          std::ranges::copy(thumb, pixels.get());
+          unsigned int width = THUMB_WIDTH;
+          unsigned int height = THUMB_HEIGHT;
+          unsigned int stridePixels = THUMB_WIDTH;
+          EXPECT_TRUE(
+              CPicture::OrientateImage(pixels, width, height, orientation, stridePixels));
+        });
+  }
+  orientUs /= 7;
+  const double orientMPixelsPerSecond = static_cast<double>(THUMB_WIDTH * THUMB_HEIGHT) / orientUs;
+
+  RecordProperty("ContextUs", contextUs);
+  RecordProperty("ScaleUs", scaleUs);
+  RecordProperty("OrientUs", orientUs);
+  RecordProperty("OrientMPixelsPerSec", std::to_string(orientMPixelsPerSecond));
+}
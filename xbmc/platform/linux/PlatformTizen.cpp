@@ -35,6 +35,8 @@
 #include "application/AppInboundProtocol.h"
 #include "application/Application.h"
 #include "filesystem/SpecialProtocol.h"
+#include "guilib/GUIComponent.h"
+#include "guilib/GUITextureBudget.h"
 #include "powermanagement/TizenPowerManagement.h"
 #include "utils/log.h"
 
@@ -328,10 +330,12 @@ void CPlatformTizen::OnAppLowMemory(app_event_info_h event_info, void* userData)
 {
 #if defined(TARGET_TIZEN)
   CLog::Log(LOGWARNING, "CPlatformTizen: Low memory warning received");
-  dlog_print(DLOG_WARN, "KODI", "Low memory warning - consider freeing resources");
-  
-  // TODO: Implement memory cleanup/cache clearing
-  // This could trigger cache cleanup, texture unloading, etc.
+  dlog_print(DLOG_WARN, "KODI", "Low memory warning - freeing unused textures");
+
+  // textures can only be freed on the app thread, this just requests it
+  CGUIComponent* gui = CServiceBroker::GetGUI();
+  if (gui)
+    gui->GetTextureBudget().OnLowMemory();
 #endif
 }
 
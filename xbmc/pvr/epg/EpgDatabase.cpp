@@ -19,6 +19,8 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <memory>
 #include <mutex>
@@ -32,8 +34,16 @@ using namespace PVR;
 bool CPVREpgDatabase::Open()
 {
   std::unique_lock lock(m_critSection);
-  return CDatabase::Open(
-      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg);
+  const bool bWasOpen{IsOpen()};
+  if (!CDatabase::Open(
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg))
+    return false;
+
+  if (!bWasOpen)
+    EnableSearchIndex(
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bEpgSearchIndex);
+
+  return true;
 }
 
 void CPVREpgDatabase::Close()
@@ -52,6 +62,163 @@ void CPVREpgDatabase::Unlock()
   m_critSection.unlock();
 }
 
+namespace
+{
+// the triggers keeping the full-text index of sqlite databases in sync with the EPG tags
+constexpr std::array<std::string_view, 4> SEARCH_INDEX_TRIGGERS = {
+    "epgtags_fts_bi", "epgtags_fts_ai", "epgtags_fts_ad", "epgtags_fts_au"};
+
+// the full-text indexes of mysql databases, one per column
+constexpr std::array<std::string_view, 3> SEARCH_INDEX_COLUMNS = {"sTitle", "sPlotOutline",
+                                                                  "sPlot"};
+} // unnamed namespace
+
+bool CPVREpgDatabase::EnableSearchIndex(bool bEnable)
+{
+  std::unique_lock lock(m_critSection);
+
+  if (bEnable)
+  {
+    m_bHasSearchIndex = HasSearchIndex() || CreateSearchIndex();
+  }
+  else
+  {
+    DropSearchIndex();
+    m_bHasSearchIndex = false;
+  }
+
+  return m_bHasSearchIndex;
+}
+
+bool CPVREpgDatabase::HasSearchIndex() const
+{
+  if (!m_sqlite)
+  {
+    const int iIndexes{
+        GetSingleValueInt("SELECT COUNT(DISTINCT index_name) FROM information_schema.statistics "
+                          "WHERE table_schema = DATABASE() AND table_name = 'epgtags' AND "
+                          "index_type = 'FULLTEXT'")};
+    if (iIndexes != static_cast<int>(SEARCH_INDEX_COLUMNS.size()))
+      return false;
+
+    // terms shorter than the ngrams are not found
+    const int iTokenSize{GetSingleValueInt("SELECT @@ngram_token_size")};
+    return iTokenSize > 0 && iTokenSize <= 3;
+  }
+
+  // analytics are dropped on database updates, so the triggers may be gone
+  if (GetSingleValueInt("SELECT COUNT(*) FROM sqlite_master "
+                        "WHERE type = 'table' AND name = 'epgtags_fts'") == 0 ||
+      GetSingleValueInt("SELECT COUNT(*) FROM sqlite_master "
+                        "WHERE type = 'trigger' AND tbl_name = 'epgtags'") !=
+          static_cast<int>(SEARCH_INDEX_TRIGGERS.size()))
+    return false;
+
+  try
+  {
+    // fails if sqlite was built without fts5
+    if (m_pDS->query("SELECT rowid FROM epgtags_fts WHERE 0"))
+    {
+      m_pDS->close();
+      return true;
+    }
+  }
+  catch (...)
+  {
+  }
+
+  return false;
+}
+
+bool CPVREpgDatabase::CreateSearchIndex()
+{
+  CLog::Log(LOGINFO, "Creating EPG database search index");
+
+  // start over from a partially created or outdated index
+  DropSearchIndex();
+
+  BeginTransaction();
+  try
+  {
+    if (m_sqlite)
+    {
+      // an external content table of trigrams, answering substring searches of three or more
+      // characters. REPLACE does not fire delete triggers, so replaced rows are removed up front.
+      m_pDS->exec("CREATE VIRTUAL TABLE epgtags_fts USING fts5("
+                  "sTitle, sPlotOutline, sPlot, "
+                  "content='epgtags', content_rowid='idBroadcast', tokenize='trigram')");
+      m_pDS->exec("CREATE TRIGGER epgtags_fts_bi BEFORE INSERT ON epgtags BEGIN "
+                  "INSERT INTO epgtags_fts(epgtags_fts, rowid, sTitle, sPlotOutline, sPlot) "
+                  "SELECT 'delete', idBroadcast, sTitle, sPlotOutline, sPlot FROM epgtags "
+                  "WHERE idBroadcast = new.idBroadcast OR "
+                  "(idEpg = new.idEpg AND iStartTime = new.iStartTime); "
+                  "END");
+      m_pDS->exec("CREATE TRIGGER epgtags_fts_ai AFTER INSERT ON epgtags BEGIN "
+                  "INSERT INTO epgtags_fts(rowid, sTitle, sPlotOutline, sPlot) "
+                  "VALUES (new.idBroadcast, new.sTitle, new.sPlotOutline, new.sPlot); "
+                  "END");
+      m_pDS->exec("CREATE TRIGGER epgtags_fts_ad AFTER DELETE ON epgtags BEGIN "
+                  "INSERT INTO epgtags_fts(epgtags_fts, rowid, sTitle, sPlotOutline, sPlot) "
+                  "VALUES ('delete', old.idBroadcast, old.sTitle, old.sPlotOutline, old.sPlot); "
+                  "END");
+      m_pDS->exec("CREATE TRIGGER epgtags_fts_au AFTER UPDATE OF sTitle, sPlotOutline, sPlot "
+                  "ON epgtags BEGIN "
+                  "INSERT INTO epgtags_fts(epgtags_fts, rowid, sTitle, sPlotOutline, sPlot) "
+                  "VALUES ('delete', old.idBroadcast, old.sTitle, old.sPlotOutline, old.sPlot); "
+                  "INSERT INTO epgtags_fts(rowid, sTitle, sPlotOutline, sPlot) "
+                  "VALUES (new.idBroadcast, new.sTitle, new.sPlotOutline, new.sPlot); "
+                  "END");
+      m_pDS->exec("INSERT INTO epgtags_fts(epgtags_fts) VALUES('rebuild')");
+    }
+    else
+    {
+      // stopwords would drop every ngram containing one of them
+      m_pDS->exec("SET SESSION innodb_ft_enable_stopword = OFF");
+      for (const auto& column : SEARCH_INDEX_COLUMNS)
+      {
+        const std::string strColumn{column};
+        m_pDS->exec("CREATE FULLTEXT INDEX idx_epg_" + strColumn + "_ft ON epgtags(" + strColumn +
+                    ") WITH PARSER ngram");
+      }
+    }
+    CommitTransaction();
+  }
+  catch (...)
+  {
+    RollbackTransaction();
+    CLog::Log(LOGWARNING, "EPG search index not supported by the database, searching without it");
+    DropSearchIndex();
+    return false;
+  }
+
+  return HasSearchIndex();
+}
+
+void CPVREpgDatabase::DropSearchIndex()
+{
+  if (!m_sqlite)
+  {
+    for (const auto& column : SEARCH_INDEX_COLUMNS)
+    {
+      const std::string strIndex{"idx_epg_" + std::string(column) + "_ft"};
+      if (GetSingleValueInt(PrepareSQL("SELECT COUNT(*) FROM information_schema.statistics "
+                                       "WHERE table_schema = DATABASE() AND "
+                                       "table_name = 'epgtags' AND index_name = '%s'",
+                                       strIndex.c_str())) > 0)
+        ExecuteQuery("DROP INDEX " + strIndex + " ON epgtags");
+    }
+    return;
+  }
+
+  // the triggers go first, sqlite without fts5 fails to write the tags while they exist
+  for (const auto& trigger : SEARCH_INDEX_TRIGGERS)
+    ExecuteQuery("DROP TRIGGER IF EXISTS " + std::string(trigger));
+
+  if (GetSingleValueInt("SELECT COUNT(*) FROM sqlite_master "
+                        "WHERE type = 'table' AND name = 'epgtags_fts'") > 0)
+    ExecuteQuery("DROP TABLE epgtags_fts");
+}
+
 void CPVREpgDatabase::CreateTables()
 {
   CLog::Log(LOGINFO, "Creating EPG database tables");
@@ -573,6 +740,10 @@ public:
 
   bool HasSearchTerm() const { return !m_fragments.empty(); }
 
+  const std::vector<std::string>& GetTerms() const { return m_terms; }
+
+  bool HasNotOperator() const { return m_bHasNot; }
+
   std::string ToSQL(std::string_view strFieldName) const
   {
     std::string result = "(";
@@ -611,6 +782,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " NOT ";
         bNextOR = false;
+        m_bHasNot = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "and"))
@@ -641,6 +813,7 @@ private:
 
           m_fragments.emplace_back(strFragment);
           strFragment.clear();
+          m_terms.emplace_back(strTerm);
 
           strFragment += ") LIKE UPPER('%";
           StringUtils::Replace(strTerm, "'", "''"); // escape '
@@ -686,10 +859,61 @@ private:
   }
 
   std::vector<std::string> m_fragments;
+  std::vector<std::string> m_terms;
+  bool m_bHasNot{false};
 };
 
+// the shortest term found by a trigram index
+constexpr size_t MIN_SEARCH_INDEX_TERM_LENGTH = 3;
+
+size_t GetCodepointCount(std::string_view str)
+{
+  return static_cast<size_t>(std::ranges::count_if(str, [](char c) { return (c & 0xC0) != 0x80; }));
+}
+
 } // unnamed namespace
 
+std::string CPVREpgDatabase::GetSearchIndexFilter(const std::vector<std::string>& terms,
+                                                  bool bSearchInDescription) const
+{
+  // the index matches literally, unlike LIKE wildcards and MySQL escapes
+  const std::string_view unsupported{m_sqlite ? "%_\"" : "%_\"\\ "};
+  const auto isUnsupported = [&unsupported](const std::string& term)
+  {
+    return GetCodepointCount(term) < MIN_SEARCH_INDEX_TERM_LENGTH ||
+           term.find_first_of(unsupported) != std::string::npos;
+  };
+  if (terms.empty() || std::ranges::any_of(terms, isUnsupported))
+    return {};
+
+  std::string strPhrases;
+  for (const auto& term : terms)
+  {
+    if (!strPhrases.empty())
+      strPhrases += m_sqlite ? " OR " : " ";
+    strPhrases += "\"" + term + "\"";
+  }
+
+  if (m_sqlite)
+    return PrepareSQL("idBroadcast IN (SELECT rowid FROM epgtags_fts WHERE epgtags_fts MATCH "
+                      "'%s : (%s)')",
+                      bSearchInDescription ? "{sTitle sPlotOutline sPlot}" : "{sTitle sPlotOutline}",
+                      strPhrases.c_str());
+
+  // a full-text index per column, each only usable by a separate query
+  std::string strQuery = PrepareSQL("SELECT idBroadcast FROM epgtags "
+                                    "WHERE MATCH(sTitle) AGAINST('%s' IN BOOLEAN MODE) "
+                                    "UNION SELECT idBroadcast FROM epgtags "
+                                    "WHERE MATCH(sPlotOutline) AGAINST('%s' IN BOOLEAN MODE)",
+                                    strPhrases.c_str(), strPhrases.c_str());
+  if (bSearchInDescription)
+    strQuery += PrepareSQL(" UNION SELECT idBroadcast FROM epgtags "
+                           "WHERE MATCH(sPlot) AGAINST('%s' IN BOOLEAN MODE)",
+                           strPhrases.c_str());
+
+  return "idBroadcast IN (" + strQuery + ")";
+}
+
 std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
     const PVREpgSearchData& searchData) const
 {
@@ -811,6 +1035,12 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
     }
 
     filter.AppendWhere(strWhere);
+
+    // without negation every match contains one of the terms, so the index narrows the candidates
+    // and the condition above still decides on them
+    if (m_bHasSearchIndex && !conv.HasNotOperator())
+      filter.AppendWhere(
+          GetSearchIndexFilter(conv.GetTerms(), searchData.m_bSearchInDescription));
   }
 
   if (BuildSQL(strQuery, filter, strQuery))
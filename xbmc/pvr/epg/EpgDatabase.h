@@ -12,6 +12,7 @@
 #include "threads/CriticalSection.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 class CDateTime;
@@ -62,6 +63,15 @@ public:
    */
   void Unlock();
 
+  /*!
+   * @brief Create or remove the full-text index used to search the titles and plots of the EPG
+   * tags. Speeds up searches for terms of three or more characters, while slowing down writing
+   * the tags.
+   * @param bEnable True to create the index if not present, false to remove it.
+   * @return True if the index is present and used by searches, false otherwise.
+   */
+  bool EnableSearchIndex(bool bEnable);
+
   /*!
    * @brief Get the minimal database version that is required to operate correctly.
    * @return The minimal database version.
@@ -383,6 +393,33 @@ private:
   std::shared_ptr<CPVREpgSearchFilter> CreateEpgSearchFilter(bool bRadio,
                                                              dbiplus::Dataset& ds) const;
 
+  /*!
+   * @brief Check whether the full-text index is present and maintained.
+   * @return True if the index can be used, false otherwise.
+   */
+  bool HasSearchIndex() const;
+
+  /*!
+   * @brief Create the full-text index used to search the titles and plots of the EPG tags.
+   * @return True if the index was created, false if the database does not support it.
+   */
+  bool CreateSearchIndex();
+
+  /*!
+   * @brief Remove the full-text index and stop maintaining it.
+   */
+  void DropSearchIndex();
+
+  /*!
+   * @brief Get the condition narrowing a search to the tags containing any of the search terms.
+   * @param terms The search terms.
+   * @param bSearchInDescription Whether the plot is searched as well.
+   * @return The condition, or an empty string if the full-text index can't answer it.
+   */
+  std::string GetSearchIndexFilter(const std::vector<std::string>& terms,
+                                   bool bSearchInDescription) const;
+
   mutable CCriticalSection m_critSection;
+  bool m_bHasSearchIndex{false};
 };
 } // namespace PVR
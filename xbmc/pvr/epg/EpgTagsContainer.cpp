@@ -8,13 +8,18 @@
 
 #include "EpgTagsContainer.h"
 
+#include "ServiceBroker.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h"
 #include "pvr/epg/EpgDatabase.h"
 #include "pvr/epg/EpgInfoTag.h"
 #include "pvr/epg/EpgTagsCache.h"
+#include "pvr/epg/EpgTagsIndex.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <iterator>
 #include <ranges>
 
 using namespace PVR;
@@ -30,7 +35,9 @@ CPVREpgTagsContainer::CPVREpgTagsContainer(int iEpgID,
   : m_iEpgID(iEpgID),
     m_channelData(channelData),
     m_database(database),
-    m_tagsCache(std::make_unique<CPVREpgTagsCache>(iEpgID, channelData, database, m_changedTags))
+    m_tagsCache(std::make_unique<CPVREpgTagsCache>(iEpgID, channelData, database, m_changedTags)),
+    m_bUseTagsIndex(
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bEpgMemoryIndex)
 {
 }
 
@@ -41,6 +48,8 @@ void CPVREpgTagsContainer::SetEpgID(int iEpgID)
   m_iEpgID = iEpgID;
   for (const auto& [_, tag] : m_changedTags)
     tag->SetEpgID(iEpgID);
+
+  ResetTagsIndex();
 }
 
 void CPVREpgTagsContainer::SetChannelData(const std::shared_ptr<CPVREpgChannelData>& data)
@@ -49,6 +58,9 @@ void CPVREpgTagsContainer::SetChannelData(const std::shared_ptr<CPVREpgChannelDa
   m_tagsCache->SetChannelData(data);
   for (const auto& [_, tag] : m_changedTags)
     tag->SetChannelData(data);
+
+  if (m_tagsIndex)
+    m_tagsIndex->SetChannelData(data);
 }
 
 namespace
@@ -129,6 +141,13 @@ bool FixOverlap(const std::shared_ptr<CPVREpgInfoTag>& previousTag,
   return true;
 }
 
+std::shared_ptr<CPVREpgInfoTag> CopyTag(const CPVREpgInfoTag& tag)
+{
+  auto copy = std::make_shared<CPVREpgInfoTag>(tag.EpgID(), "", "");
+  copy->Update(tag);
+  return copy;
+}
+
 } // unnamed namespace
 
 bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
@@ -205,13 +224,22 @@ void CPVREpgTagsContainer::FixOverlappingEvents(
 {
   bool bResetCache = false;
 
-  std::shared_ptr<CPVREpgInfoTag> previousTag;
   for (auto it = tags.begin(); it != tags.end();)
   {
     const std::shared_ptr<CPVREpgInfoTag> currentTag = *it;
+    std::shared_ptr<CPVREpgInfoTag> previousTag;
+    if (it != tags.begin())
+    {
+      // the tags may be shared with the index of the persisted tags, shorten a copy
+      std::shared_ptr<CPVREpgInfoTag>& previous = *std::prev(it);
+      if (previous->EndAsUTC() > currentTag->StartAsUTC() &&
+          previous->EndAsUTC() < currentTag->EndAsUTC())
+        previous = CopyTag(*previous);
+      previousTag = previous;
+    }
+
     if (FixOverlap(previousTag, currentTag))
     {
-      previousTag = currentTag;
       ++it;
     }
     else
@@ -319,12 +347,81 @@ void CPVREpgTagsContainer::Cleanup(const CDateTime& time)
 
   if (m_database)
     m_database->DeleteEpgTags(m_iEpgID, time);
+
+  if (m_tagsIndex)
+    m_tagsIndex->Cleanup(time);
 }
 
 void CPVREpgTagsContainer::Clear()
 {
   m_changedTags.clear();
   m_tagsCache->Reset();
+
+  // the changed tags are now persisted or dropped along with the persisted ones
+  ResetTagsIndex();
+}
+
+const CPVREpgTagsIndex* CPVREpgTagsContainer::GetTagsIndex() const
+{
+  if (!m_bUseTagsIndex || !m_database)
+    return nullptr;
+
+  if (!m_tagsIndex)
+  {
+    m_tagsIndex =
+        std::make_unique<CPVREpgTagsIndex>(CreateEntries(m_database->GetAllEpgTags(m_iEpgID)));
+    CLog::LogFC(LOGDEBUG, LOGEPG, "Indexed {} events of EPG {}", m_tagsIndex->Size(), m_iEpgID);
+  }
+  return m_tagsIndex.get();
+}
+
+void CPVREpgTagsContainer::ResetTagsIndex()
+{
+  m_tagsIndex.reset();
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::
+    GetPersistedTagsByMinEndMaxStartTime(const CDateTime& minEndTime,
+                                         const CDateTime& maxStartTime) const
+{
+  if (const CPVREpgTagsIndex* index = GetTagsIndex())
+    return index->GetTagsByMinEndMaxStartTime(minEndTime, maxStartTime);
+
+  return m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEndTime, maxStartTime);
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::
+    GetPersistedTagsByMinStartMaxEndTime(const CDateTime& minStartTime,
+                                         const CDateTime& maxEndTime) const
+{
+  if (const CPVREpgTagsIndex* index = GetTagsIndex())
+    return index->GetTagsByMinStartMaxEndTime(minStartTime, maxEndTime);
+
+  return m_database->GetEpgTagsByMinStartMaxEndTime(m_iEpgID, minStartTime, maxEndTime);
+}
+
+CDateTime CPVREpgTagsContainer::GetPersistedLastEndTime() const
+{
+  if (const CPVREpgTagsIndex* index = GetTagsIndex())
+    return index->GetLastEndTime();
+
+  return m_database->GetLastEndTime(m_iEpgID);
+}
+
+CDateTime CPVREpgTagsContainer::GetPersistedMinStartTime(const CDateTime& minStart) const
+{
+  if (const CPVREpgTagsIndex* index = GetTagsIndex())
+    return index->GetMinStartTime(minStart);
+
+  return m_database->GetMinStartTime(m_iEpgID, minStart);
+}
+
+CDateTime CPVREpgTagsContainer::GetPersistedMaxEndTime(const CDateTime& maxEnd) const
+{
+  if (const CPVREpgTagsIndex* index = GetTagsIndex())
+    return index->GetMaxEndTime(maxEnd);
+
+  return m_database->GetMaxEndTime(m_iEpgID, maxEnd);
 }
 
 bool CPVREpgTagsContainer::IsEmpty() const
@@ -402,7 +499,7 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTagBetween(const CDateT
   if (m_database)
   {
     const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags =
-        CreateEntries(m_database->GetEpgTagsByMinStartMaxEndTime(m_iEpgID, start, end));
+        CreateEntries(GetPersistedTagsByMinStartMaxEndTime(start, end));
     if (!tags.empty())
     {
       if (tags.size() > 1)
@@ -468,7 +565,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     bool loadFromDb = true;
     if (!m_changedTags.empty())
     {
-      const CDateTime lastEnd = m_database->GetLastEndTime(m_iEpgID);
+      const CDateTime lastEnd = GetPersistedLastEndTime();
       if (!lastEnd.IsValid() || lastEnd < minEventEnd)
       {
         // nothing in the db yet. take what we have in memory.
@@ -479,7 +576,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
 
     if (loadFromDb)
     {
-      tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
+      tags = GetPersistedTagsByMinEndMaxStartTime(minEventEnd, maxEventStart);
 
       if (!m_changedTags.empty())
       {
@@ -521,11 +618,11 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     if (result.empty())
     {
       // create single gap tag
-      CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+      CDateTime maxEnd = GetPersistedMaxEndTime(minEventEnd);
       if (!maxEnd.IsValid() || maxEnd < timelineStart)
         maxEnd = timelineStart;
 
-      CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+      CDateTime minStart = GetPersistedMinStartTime(maxEventStart);
       if (!minStart.IsValid() || minStart > timelineEnd)
         minStart = timelineEnd;
 
@@ -536,7 +633,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.front()->StartAsUTC() > minEventEnd)
       {
         // prepend gap tag
-        CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+        CDateTime maxEnd = GetPersistedMaxEndTime(minEventEnd);
         if (!maxEnd.IsValid() || maxEnd < timelineStart)
           maxEnd = timelineStart;
 
@@ -546,7 +643,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.back()->EndAsUTC() < maxEventStart)
       {
         // append gap tag
-        CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+        CDateTime minStart = GetPersistedMinStartTime(maxEventStart);
         if (!minStart.IsValid() || minStart > timelineEnd)
           minStart = timelineEnd;
 
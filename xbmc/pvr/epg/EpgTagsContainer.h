@@ -17,6 +17,7 @@
 namespace PVR
 {
 class CPVREpgTagsCache;
+class CPVREpgTagsIndex;
 class CPVREpgChannelData;
 class CPVREpgDatabase;
 class CPVREpgInfoTag;
@@ -215,10 +216,34 @@ private:
   void FixOverlappingEvents(std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const;
   void FixOverlappingEvents(std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& tags) const;
 
+  /*!
+   * @brief Get the in-memory index of the persisted tags, loading it if needed.
+   * @return The index or nullptr if the index is disabled.
+   */
+  const CPVREpgTagsIndex* GetTagsIndex() const;
+
+  /*!
+   * @brief Drop the in-memory index of the persisted tags, to be reloaded when needed.
+   */
+  void ResetTagsIndex();
+
+  /*!
+   * @brief The time range queries of CPVREpgDatabase, answered by the index if enabled.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetPersistedTagsByMinEndMaxStartTime(
+      const CDateTime& minEndTime, const CDateTime& maxStartTime) const;
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetPersistedTagsByMinStartMaxEndTime(
+      const CDateTime& minStartTime, const CDateTime& maxEndTime) const;
+  CDateTime GetPersistedLastEndTime() const;
+  CDateTime GetPersistedMinStartTime(const CDateTime& minStart) const;
+  CDateTime GetPersistedMaxEndTime(const CDateTime& maxEnd) const;
+
   int m_iEpgID = 0;
   std::shared_ptr<CPVREpgChannelData> m_channelData;
   const std::shared_ptr<CPVREpgDatabase> m_database;
   const std::unique_ptr<CPVREpgTagsCache> m_tagsCache;
+  const bool m_bUseTagsIndex;
+  mutable std::unique_ptr<CPVREpgTagsIndex> m_tagsIndex;
 
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_changedTags;
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_deletedTags;
@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EpgTagsIndex.h"
+
+#include "pvr/epg/EpgInfoTag.h"
+
+#include <algorithm>
+
+using namespace PVR;
+
+namespace
+{
+time_t GetAsTime(const CDateTime& time)
+{
+  time_t t;
+  time.GetAsTime(t);
+  return t;
+}
+} // unnamed namespace
+
+CPVREpgTagsIndex::CPVREpgTagsIndex(std::vector<std::shared_ptr<CPVREpgInfoTag>> tags)
+  : m_tags(std::move(tags))
+{
+  std::stable_sort(m_tags.begin(), m_tags.end(), [](const auto& tag1, const auto& tag2)
+                   { return tag1->StartAsUTC() < tag2->StartAsUTC(); });
+  CreateIndex();
+}
+
+void CPVREpgTagsIndex::CreateIndex()
+{
+  m_starts.clear();
+  m_ends.clear();
+  m_maxEnds.clear();
+  m_starts.reserve(m_tags.size());
+  m_ends.reserve(m_tags.size());
+  m_maxEnds.reserve(m_tags.size());
+
+  for (const auto& tag : m_tags)
+  {
+    m_starts.emplace_back(GetAsTime(tag->StartAsUTC()));
+    m_ends.emplace_back(GetAsTime(tag->EndAsUTC()));
+    m_maxEnds.emplace_back(m_maxEnds.empty() ? m_ends.back()
+                                             : std::max(m_maxEnds.back(), m_ends.back()));
+  }
+}
+
+void CPVREpgTagsIndex::SetChannelData(const std::shared_ptr<CPVREpgChannelData>& data)
+{
+  for (const auto& tag : m_tags)
+    tag->SetChannelData(data);
+}
+
+void CPVREpgTagsIndex::Cleanup(const CDateTime& time)
+{
+  const time_t t = GetAsTime(time);
+  if (std::ranges::none_of(m_ends, [t](time_t end) { return end < t; }))
+    return;
+
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  for (size_t row = 0; row < m_tags.size(); row++)
+  {
+    if (m_ends[row] >= t)
+      tags.emplace_back(std::move(m_tags[row]));
+  }
+  m_tags = std::move(tags);
+  CreateIndex();
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsIndex::GetTagsByMinEndMaxStartTime(
+    const CDateTime& minEndTime, const CDateTime& maxStartTime) const
+{
+  const time_t minEnd = GetAsTime(minEndTime);
+  const time_t maxStart = GetAsTime(maxStartTime);
+
+  // no tag before the first one with a running maximum end time of at least minEnd qualifies
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  for (size_t row = std::ranges::lower_bound(m_maxEnds, minEnd) - m_maxEnds.begin();
+       row < m_tags.size() && m_starts[row] <= maxStart; row++)
+  {
+    if (m_ends[row] >= minEnd)
+      tags.emplace_back(m_tags[row]);
+  }
+  return tags;
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsIndex::GetTagsByMinStartMaxEndTime(
+    const CDateTime& minStartTime, const CDateTime& maxEndTime) const
+{
+  const time_t minStart = GetAsTime(minStartTime);
+  const time_t maxEnd = GetAsTime(maxEndTime);
+
+  // tags ending at or before maxEnd also start at or before it
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  for (size_t row = std::ranges::lower_bound(m_starts, minStart) - m_starts.begin();
+       row < m_tags.size() && m_starts[row] <= maxEnd; row++)
+  {
+    if (m_ends[row] <= maxEnd)
+      tags.emplace_back(m_tags[row]);
+  }
+  return tags;
+}
+
+CDateTime CPVREpgTagsIndex::GetLastEndTime() const
+{
+  if (m_maxEnds.empty())
+    return {};
+
+  return CDateTime(m_maxEnds.back());
+}
+
+CDateTime CPVREpgTagsIndex::GetMinStartTime(const CDateTime& minStart) const
+{
+  const auto it = std::ranges::upper_bound(m_starts, GetAsTime(minStart));
+  if (it == m_starts.end())
+    return {};
+
+  return CDateTime(*it);
+}
+
+CDateTime CPVREpgTagsIndex::GetMaxEndTime(const CDateTime& maxEnd) const
+{
+  const time_t t = GetAsTime(maxEnd);
+
+  // tags ending at or before t start at or before it. walk back until no earlier tag ends later.
+  bool found = false;
+  time_t result = 0;
+  for (size_t row = std::ranges::upper_bound(m_starts, t) - m_starts.begin(); row > 0; row--)
+  {
+    if (found && m_maxEnds[row - 1] <= result)
+      break;
+
+    if (m_ends[row - 1] <= t && (!found || m_ends[row - 1] > result))
+    {
+      found = true;
+      result = m_ends[row - 1];
+    }
+  }
+
+  if (!found)
+    return {};
+
+  return CDateTime(result);
+}
@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "XBDateTime.h"
+
+#include <ctime>
+#include <memory>
+#include <vector>
+
+namespace PVR
+{
+class CPVREpgChannelData;
+class CPVREpgInfoTag;
+
+/*!
+ * @brief In-memory index of the persisted tags of an EPG.
+ *
+ * Answers the time range queries of CPVREpgDatabase for a single EPG, with the same bounds as the
+ * SQL queries, so the guide can be scrolled without querying the database. The tags are kept
+ * ordered by start time along with the running maximum of their end times, which allows to find
+ * the first tag ending after a given time by binary search even if tags overlap.
+ */
+class CPVREpgTagsIndex
+{
+public:
+  CPVREpgTagsIndex() = delete;
+
+  /*!
+   * @brief Create an index.
+   * @param tags The persisted tags of the EPG.
+   */
+  explicit CPVREpgTagsIndex(std::vector<std::shared_ptr<CPVREpgInfoTag>> tags);
+
+  /*!
+   * @brief Get the number of tags.
+   * @return The number of tags.
+   */
+  size_t Size() const { return m_tags.size(); }
+
+  /*!
+   * @brief Set the channel data of all tags.
+   * @param data The channel data.
+   */
+  void SetChannelData(const std::shared_ptr<CPVREpgChannelData>& data);
+
+  /*!
+   * @brief Remove all tags which were finished before the given time.
+   * @param time Remove tags with an end time before this time.
+   */
+  void Cleanup(const CDateTime& time);
+
+  /*!
+   * @brief Get all tags ending at or after and starting at or before the given times.
+   * @param minEndTime The minimum end time.
+   * @param maxStartTime The maximum start time.
+   * @return The tags, ordered by start time.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTagsByMinEndMaxStartTime(
+      const CDateTime& minEndTime, const CDateTime& maxStartTime) const;
+
+  /*!
+   * @brief Get all tags starting at or after and ending at or before the given times.
+   * @param minStartTime The minimum start time.
+   * @param maxEndTime The maximum end time.
+   * @return The tags, ordered by start time.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTagsByMinStartMaxEndTime(
+      const CDateTime& minStartTime, const CDateTime& maxEndTime) const;
+
+  /*!
+   * @brief Get the end time of the last ending tag.
+   * @return The time, or an invalid time if there are no tags.
+   */
+  CDateTime GetLastEndTime() const;
+
+  /*!
+   * @brief Get the earliest start time after the given time.
+   * @param minStart The time.
+   * @return The time, or an invalid time if no tag starts after the given time.
+   */
+  CDateTime GetMinStartTime(const CDateTime& minStart) const;
+
+  /*!
+   * @brief Get the latest end time at or before the given time.
+   * @param maxEnd The time.
+   * @return The time, or an invalid time if no tag ends at or before the given time.
+   */
+  CDateTime GetMaxEndTime(const CDateTime& maxEnd) const;
+
+private:
+  void CreateIndex();
+
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> m_tags; ///< ordered by start time
+  std::vector<time_t> m_starts;
+  std::vector<time_t> m_ends;
+  std::vector<time_t> m_maxEnds; ///< latest end time of the tags up to and including a row
+};
+
+} // namespace PVR
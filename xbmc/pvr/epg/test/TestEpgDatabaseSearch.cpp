@@ -0,0 +1,241 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "XBDateTime.h"
+#include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "pvr/epg/EpgDatabase.h"
+#include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgSearchData.h"
+#include "settings/AdvancedSettings.h"
+#include "utils/URIUtils.h"
+
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+constexpr const char* DATABASE_NAME = "TestEpgDatabaseSearch";
+constexpr time_t GUIDE_START = 1735689600; // 2025-01-01 00:00:00 UTC
+constexpr time_t EVENT_DURATION = 30 * 60;
+
+// made up words of two to four syllables, the guide uses the first ones most often
+std::vector<std::string> CreateWords(std::mt19937& random)
+{
+  static const char* SYLLABLES[] = {"ka", "to", "ri", "men", "sa", "lo", "vi", "ne", "ta", "mu",
+                                    "ro", "de", "chi", "fa", "go", "be", "li", "su", "an", "er"};
+  std::vector<std::string> words;
+  for (int i = 0; i < 20000; i++)
+  {
+    std::string word;
+    for (size_t syllables = 2 + random() % 3; syllables > 0; syllables--)
+      word += SYLLABLES[random() % std::size(SYLLABLES)];
+    words.emplace_back(std::move(word));
+  }
+  return words;
+}
+
+std::string CreateText(const std::vector<std::string>& words, int count, std::mt19937& random)
+{
+  std::string text;
+  for (int i = 0; i < count; i++)
+  {
+    if (!text.empty())
+      text += ' ';
+    text += words[random() % (random() % 2 ? 100 : words.size())];
+  }
+  return text;
+}
+
+class TestEpgDatabase : public CPVREpgDatabase
+{
+public:
+  // event i of each channel starts at GUIDE_START + i * EVENT_DURATION
+  void PersistGuide(
+      int channels, int events, const std::vector<std::string>& words, std::mt19937& random)
+  {
+    BeginTransaction();
+    for (int channel = 1; channel <= channels; channel++)
+    {
+      for (int event = 0; event < events; event++)
+      {
+        const std::string title{CreateText(words, 3, random)};
+        const std::string plotOutline{CreateText(words, 10, random)};
+        const std::string plot{CreateText(words, 40, random)};
+
+        EPG_TAG data{};
+        data.iUniqueBroadcastId = static_cast<unsigned int>(event + 1);
+        data.iUniqueChannelId = static_cast<unsigned int>(channel);
+        data.strTitle = title.c_str();
+        data.strPlotOutline = plotOutline.c_str();
+        data.strPlot = plot.c_str();
+        data.startTime = GUIDE_START + event * EVENT_DURATION;
+        data.endTime = data.startTime + EVENT_DURATION;
+        QueuePersistQuery(CPVREpgInfoTag(data, 1, nullptr, channel));
+
+        if (GetInsertQueriesCount() > EPG_COMMIT_QUERY_COUNT_LIMIT)
+          CommitInsertQueries();
+      }
+    }
+    CommitInsertQueries();
+    CommitTransaction();
+  }
+
+  std::vector<int> Search(const std::string& term, bool bSearchInDescription) const
+  {
+    PVREpgSearchData searchData;
+    searchData.Reset();
+    searchData.m_strSearchTerm = term;
+    searchData.m_bSearchInDescription = bSearchInDescription;
+    searchData.m_bIgnoreFinishedBroadcasts = false;
+
+    std::vector<int> ids;
+    for (const auto& tag : GetEpgTags(searchData))
+      ids.emplace_back(tag->DatabaseID());
+    return ids;
+  }
+};
+} // namespace
+
+class TestEpgDatabaseSearch : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_settings.type = "sqlite3";
+    m_settings.host = CSpecialProtocol::TranslatePath("special://temp/");
+    ASSERT_EQ(CDatabase::ConnectionState::STATE_CONNECTED,
+              m_db.Connect(DATABASE_NAME, m_settings, true));
+  }
+
+  void TearDown() override
+  {
+    m_db.Close();
+    XFILE::CFile::Delete(
+        URIUtils::AddFileToFolder(m_settings.host, std::string(DATABASE_NAME) + ".db"));
+  }
+
+  DatabaseSettings m_settings;
+  TestEpgDatabase m_db;
+};
+
+TEST_F(TestEpgDatabaseSearch, MatchesScan)
+{
+  if (!m_db.EnableSearchIndex(true))
+    GTEST_SKIP() << "sqlite without fts5 trigram tokenizer";
+
+  std::mt19937 random(42);
+  const std::vector<std::string> words{CreateWords(random)};
+
+  // the index follows inserts, replaced events, events replaced by id and deleted events
+  m_db.PersistGuide(20, 100, words, random);
+  m_db.PersistGuide(5, 50, words, random);
+  m_db.BeginTransaction();
+  for (const auto& tag : m_db.GetAllEpgTags(6))
+    m_db.QueuePersistQuery(*tag);
+  m_db.CommitInsertQueries();
+  m_db.CommitTransaction();
+  m_db.DeleteEpgTags(7);
+  m_db.DeleteEpgTags(8, CDateTime(GUIDE_START + 20 * EVENT_DURATION));
+  EXPECT_TRUE(m_db.ExecuteQuery(
+      "INSERT INTO epgtags_fts(epgtags_fts, rank) VALUES('integrity-check', 1)"));
+
+  const std::vector<std::string> terms{
+      words[0], words[50], words[5000], "MEN", words[1] + " " + words[2],
+      words[3] + " + " + words[4], "\"" + words[5] + " " + words[6] + "\"", "ka", "xyz",
+      words[7] + " !" + words[8], "men's", "men%", "ka_"};
+  for (bool bSearchInDescription : {false, true})
+  {
+    std::vector<std::vector<int>> indexed;
+    for (const auto& term : terms)
+      indexed.emplace_back(m_db.Search(term, bSearchInDescription));
+
+    EXPECT_FALSE(m_db.EnableSearchIndex(false));
+    for (size_t i = 0; i < terms.size(); i++)
+      EXPECT_EQ(m_db.Search(terms[i], bSearchInDescription), indexed[i]) << terms[i];
+    EXPECT_FALSE(indexed[0].empty());
+
+    // rebuilt from the tags
+    EXPECT_TRUE(m_db.EnableSearchIndex(true));
+  }
+}
+
+TEST_F(TestEpgDatabaseSearch, DISABLED_Benchmark)
+{
+  // two weeks of half hour events on 500 channels
+  constexpr int CHANNELS = 500;
+  constexpr int EVENTS = 1000;
+
+  std::mt19937 random(42);
+  const std::vector<std::string> words{CreateWords(random)};
+
+  auto measure = [](const auto& function)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  };
+
+  m_db.EnableSearchIndex(false);
+  const auto persistMs = measure([&] { m_db.PersistGuide(CHANNELS, EVENTS, words, random); });
+  bool bIndexed = false;
+  const auto indexMs = measure([&] { bIndexed = m_db.EnableSearchIndex(true); });
+  ASSERT_TRUE(bIndexed);
+  const auto persistIndexedMs = measure([&] { m_db.PersistGuide(10, EVENTS, words, random); });
+  RecordProperty("PersistMs", std::to_string(persistMs));
+  RecordProperty("CreateIndexMs", std::to_string(indexMs));
+  RecordProperty("PersistIndexedMs", std::to_string(persistIndexedMs));
+
+  // a frequent word, words of saved searches and one which is not found
+  const std::vector<std::string> terms{words[0], words[500], words[5000],
+                                       words[3000] + " " + words[4000], "xyz"};
+  auto searchAll = [&](std::vector<std::vector<int>>& results, std::vector<long long>& times)
+  {
+    for (bool bSearchInDescription : {false, true})
+    {
+      for (const auto& term : terms)
+      {
+        results.emplace_back();
+        times.emplace_back(
+            measure([&] { results.back() = m_db.Search(term, bSearchInDescription); }));
+      }
+    }
+  };
+
+  std::vector<std::vector<int>> indexed;
+  std::vector<long long> indexedMs;
+  searchAll(indexed, indexedMs);
+
+  m_db.EnableSearchIndex(false);
+  std::vector<std::vector<int>> scanned;
+  std::vector<long long> scannedMs;
+  searchAll(scanned, scannedMs);
+
+  long long indexedTotalMs = 0;
+  long long scannedTotalMs = 0;
+  for (size_t i = 0; i < indexed.size(); i++)
+  {
+    EXPECT_EQ(scanned[i], indexed[i]);
+    indexedTotalMs += indexedMs[i];
+    scannedTotalMs += scannedMs[i];
+  }
+
+  RecordProperty("ScanMs", std::to_string(scannedTotalMs));
+  RecordProperty("IndexMs", std::to_string(indexedTotalMs));
+}
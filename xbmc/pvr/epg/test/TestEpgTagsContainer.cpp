@@ -0,0 +1,113 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "XBDateTime.h"
+#include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "pvr/epg/EpgChannelData.h"
+#include "pvr/epg/EpgDatabase.h"
+#include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgTagsContainer.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/URIUtils.h"
+
+#include <ctime>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+constexpr const char* DATABASE_NAME = "TestEpgTagsContainer";
+constexpr int EPG_ID = 1;
+constexpr time_t GUIDE_START = 1735689600; // 2025-01-01 00:00:00 UTC
+constexpr time_t MINUTE = 60;
+
+std::shared_ptr<CPVREpgInfoTag> CreateTag(unsigned int id, time_t start, time_t end)
+{
+  const std::string title = "Event " + std::to_string(id);
+  EPG_TAG data{};
+  data.iUniqueBroadcastId = id;
+  data.iUniqueChannelId = 1;
+  data.strTitle = title.c_str();
+  data.startTime = GUIDE_START + start;
+  data.endTime = GUIDE_START + end;
+  return std::make_shared<CPVREpgInfoTag>(data, 1, nullptr, EPG_ID);
+}
+
+CDateTime GuideTime(time_t time)
+{
+  return CDateTime(GUIDE_START + time);
+}
+} // namespace
+
+class TestEpgTagsContainer : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_settings.type = "sqlite3";
+    m_settings.host = CSpecialProtocol::TranslatePath("special://temp/");
+    ASSERT_EQ(CDatabase::ConnectionState::STATE_CONNECTED,
+              m_db->Connect(DATABASE_NAME, m_settings, true));
+
+    // the guide is answered from the index of the persisted tags
+    auto& advancedSettings = *CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    m_memoryIndex = advancedSettings.m_bEpgMemoryIndex;
+    advancedSettings.m_bEpgMemoryIndex = true;
+  }
+
+  void TearDown() override
+  {
+    CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bEpgMemoryIndex =
+        m_memoryIndex;
+    m_db->Close();
+    XFILE::CFile::Delete(
+        URIUtils::AddFileToFolder(m_settings.host, std::string(DATABASE_NAME) + ".db"));
+  }
+
+  DatabaseSettings m_settings;
+  std::shared_ptr<CPVREpgDatabase> m_db{std::make_shared<CPVREpgDatabase>()};
+  bool m_memoryIndex{false};
+};
+
+TEST_F(TestEpgTagsContainer, TimelineKeepsPersistedTags)
+{
+  // the persisted events overlap, the timeline shortens the first
+  m_db->QueuePersistQuery(*CreateTag(1, 0, 60 * MINUTE));
+  m_db->QueuePersistQuery(*CreateTag(2, 30 * MINUTE, 90 * MINUTE));
+  m_db->CommitInsertQueries();
+
+  CPVREpgTagsContainer container(EPG_ID, std::make_shared<CPVREpgChannelData>(), m_db);
+  const std::shared_ptr<CPVREpgInfoTag> persisted =
+      container.GetTagBetween(GuideTime(0), GuideTime(60 * MINUTE));
+  ASSERT_NE(nullptr, persisted);
+
+  // with a changed tag in memory the timeline fixes the overlapping events
+  container.UpdateEntry(CreateTag(3, 120 * MINUTE, 150 * MINUTE));
+  const auto timeline = container.GetTimeline(GuideTime(0), GuideTime(180 * MINUTE), GuideTime(0),
+                                              GuideTime(180 * MINUTE));
+  ASSERT_EQ(4u, timeline.size());
+  EXPECT_EQ(1u, timeline[0]->UniqueBroadcastID());
+  EXPECT_EQ(GuideTime(30 * MINUTE), timeline[0]->EndAsUTC());
+  EXPECT_EQ(2u, timeline[1]->UniqueBroadcastID());
+  EXPECT_TRUE(timeline[2]->IsGapTag());
+  EXPECT_EQ(3u, timeline[3]->UniqueBroadcastID());
+
+  // the tag shared with the index is left alone
+  EXPECT_EQ(GuideTime(60 * MINUTE), persisted->EndAsUTC());
+  EXPECT_EQ(persisted, container.GetTagBetween(GuideTime(0), GuideTime(60 * MINUTE)));
+  EXPECT_EQ(GuideTime(60 * MINUTE),
+            container.GetTagBetween(GuideTime(0), GuideTime(60 * MINUTE))->EndAsUTC());
+}
@@ -0,0 +1,193 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "XBDateTime.h"
+#include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgTagsIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+constexpr time_t GUIDE_START = 1735689600; // 2025-01-01 00:00:00 UTC
+
+std::shared_ptr<CPVREpgInfoTag> CreateTag(time_t start, time_t end)
+{
+  return std::make_shared<CPVREpgInfoTag>(nullptr, 1, CDateTime(start), CDateTime(end), false);
+}
+
+std::vector<std::pair<time_t, time_t>> GetTimes(
+    const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags)
+{
+  std::vector<std::pair<time_t, time_t>> times;
+  for (const auto& tag : tags)
+  {
+    time_t start;
+    time_t end;
+    tag->StartAsUTC().GetAsTime(start);
+    tag->EndAsUTC().GetAsTime(end);
+    times.emplace_back(start, end);
+  }
+  return times;
+}
+
+time_t GetAsTime(const CDateTime& time)
+{
+  if (!time.IsValid())
+    return -1;
+
+  time_t t;
+  time.GetAsTime(t);
+  return t;
+}
+} // namespace
+
+TEST(TestEpgTagsIndex, Queries)
+{
+  // unordered, with an overlap and a gap
+  const time_t t = GUIDE_START;
+  const CPVREpgTagsIndex index({CreateTag(t + 60, t + 120), CreateTag(t, t + 90),
+                                CreateTag(t + 120, t + 180), CreateTag(t + 300, t + 360)});
+  EXPECT_EQ(4u, index.Size());
+
+  using Times = std::vector<std::pair<time_t, time_t>>;
+  EXPECT_EQ((Times{{t, t + 90}, {t + 60, t + 120}, {t + 120, t + 180}}),
+            GetTimes(index.GetTagsByMinEndMaxStartTime(CDateTime(t + 90), CDateTime(t + 120))));
+  EXPECT_EQ((Times{{t + 60, t + 120}, {t + 120, t + 180}}),
+            GetTimes(index.GetTagsByMinEndMaxStartTime(CDateTime(t + 91), CDateTime(t + 299))));
+  EXPECT_TRUE(index.GetTagsByMinEndMaxStartTime(CDateTime(t + 181), CDateTime(t + 299)).empty());
+  EXPECT_EQ((Times{{t + 60, t + 120}, {t + 120, t + 180}}),
+            GetTimes(index.GetTagsByMinStartMaxEndTime(CDateTime(t + 60), CDateTime(t + 180))));
+  EXPECT_TRUE(index.GetTagsByMinStartMaxEndTime(CDateTime(t + 61), CDateTime(t + 179)).empty());
+
+  EXPECT_EQ(t + 360, GetAsTime(index.GetLastEndTime()));
+  EXPECT_EQ(t + 60, GetAsTime(index.GetMinStartTime(CDateTime(t))));
+  EXPECT_EQ(t + 300, GetAsTime(index.GetMinStartTime(CDateTime(t + 120))));
+  EXPECT_EQ(-1, GetAsTime(index.GetMinStartTime(CDateTime(t + 300))));
+  EXPECT_EQ(t + 120, GetAsTime(index.GetMaxEndTime(CDateTime(t + 179))));
+  EXPECT_EQ(t + 180, GetAsTime(index.GetMaxEndTime(CDateTime(t + 300))));
+  EXPECT_EQ(-1, GetAsTime(index.GetMaxEndTime(CDateTime(t + 89))));
+
+  const CPVREpgTagsIndex empty(std::vector<std::shared_ptr<CPVREpgInfoTag>>{});
+  EXPECT_FALSE(empty.GetLastEndTime().IsValid());
+  EXPECT_FALSE(empty.GetMaxEndTime(CDateTime(t)).IsValid());
+  EXPECT_TRUE(empty.GetTagsByMinEndMaxStartTime(CDateTime(t), CDateTime(t + 60)).empty());
+}
+
+TEST(TestEpgTagsIndex, MatchesDatabaseQueries)
+{
+  std::mt19937 random(42);
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  for (int i = 0; i < 200; i++)
+  {
+    const time_t start = GUIDE_START + static_cast<time_t>(random() % 20000);
+    tags.emplace_back(CreateTag(start, start + 1 + static_cast<time_t>(random() % 3000)));
+  }
+  const auto all = GetTimes(tags);
+  const CPVREpgTagsIndex index(tags);
+
+  // the conditions of the queries of CPVREpgDatabase
+  for (int i = 0; i < 500; i++)
+  {
+    const time_t a = GUIDE_START - 1000 + static_cast<time_t>(random() % 25000);
+    const time_t b = a + static_cast<time_t>(random() % 5000);
+
+    std::vector<std::pair<time_t, time_t>> byMinEnd;
+    std::vector<std::pair<time_t, time_t>> byMinStart;
+    time_t minStart = -1;
+    time_t maxEnd = -1;
+    for (const auto& [start, end] : all)
+    {
+      if (end >= a && start <= b)
+        byMinEnd.emplace_back(start, end);
+      if (start >= a && end <= b)
+        byMinStart.emplace_back(start, end);
+      if (start > a && (minStart < 0 || start < minStart))
+        minStart = start;
+      if (end <= a && end > maxEnd)
+        maxEnd = end;
+    }
+    std::ranges::stable_sort(byMinEnd, {}, &std::pair<time_t, time_t>::first);
+    std::ranges::stable_sort(byMinStart, {}, &std::pair<time_t, time_t>::first);
+
+    EXPECT_EQ(byMinEnd, GetTimes(index.GetTagsByMinEndMaxStartTime(CDateTime(a), CDateTime(b))));
+    EXPECT_EQ(byMinStart, GetTimes(index.GetTagsByMinStartMaxEndTime(CDateTime(a), CDateTime(b))));
+    EXPECT_EQ(minStart, GetAsTime(index.GetMinStartTime(CDateTime(a))));
+    EXPECT_EQ(maxEnd, GetAsTime(index.GetMaxEndTime(CDateTime(a))));
+  }
+}
+
+TEST(TestEpgTagsIndex, Cleanup)
+{
+  const time_t t = GUIDE_START;
+  CPVREpgTagsIndex index({CreateTag(t, t + 60), CreateTag(t + 60, t + 120),
+                          CreateTag(t + 120, t + 180)});
+
+  index.Cleanup(CDateTime(t + 120));
+  EXPECT_EQ(2u, index.Size());
+  EXPECT_EQ((std::vector<std::pair<time_t, time_t>>{{t + 60, t + 120}, {t + 120, t + 180}}),
+            GetTimes(index.GetTagsByMinEndMaxStartTime(CDateTime(t), CDateTime(t + 180))));
+  EXPECT_FALSE(index.GetMaxEndTime(CDateTime(t + 119)).IsValid());
+}
+
+TEST(TestEpgTagsIndex, DISABLED_Benchmark)
+{
+  // the guide grid scrolled across two weeks, a page of two hours at a time
+  constexpr int CHANNELS = 50;
+  constexpr time_t DAYS = 14;
+  constexpr time_t PAGE = 2 * 60 * 60;
+  constexpr time_t BLOCK = 5 * 60;
+
+  std::vector<CPVREpgTagsIndex> indexes;
+  size_t tagCount = 0;
+  for (int channel = 0; channel < CHANNELS; channel++)
+  {
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+    for (time_t start = GUIDE_START; start < GUIDE_START + DAYS * 24 * 60 * 60;)
+    {
+      const time_t end = start + (15 + 15 * ((start / 60 + channel) % 4)) * 60;
+      tags.emplace_back(CreateTag(start, end));
+      start = end;
+    }
+    tagCount += tags.size();
+    indexes.emplace_back(std::move(tags));
+  }
+
+  size_t queries = 0;
+  size_t found = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (time_t page = GUIDE_START; page < GUIDE_START + DAYS * 24 * 60 * 60; page += PAGE)
+  {
+    for (const auto& index : indexes)
+    {
+      // as queried by CPVREpgTagsContainer::GetTimeline() for a page of the grid
+      const CDateTime minEventEnd(page - BLOCK + 1);
+      const CDateTime maxEventStart(page + PAGE + BLOCK);
+      found += index.GetTagsByMinEndMaxStartTime(minEventEnd, maxEventStart).size();
+      found += index.GetMaxEndTime(minEventEnd).IsValid();
+      found += index.GetMinStartTime(maxEventStart).IsValid();
+      queries++;
+    }
+  }
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+  EXPECT_GT(found, queries);
+
+  const double usPerQuery = static_cast<double>(us) / static_cast<double>(queries);
+  RecordProperty("UsPerTimeline", std::to_string(usPerQuery));
+}
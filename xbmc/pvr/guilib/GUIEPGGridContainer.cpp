@@ -1124,7 +1124,7 @@ bool CGUIEPGGridContainer::SetChannel(std::string_view channel)
 {
   for (int iIndex = 0; iIndex < m_gridModel->ChannelItemsSize(); iIndex++)
   {
-    std::string strPath = m_gridModel->GetChannelItem(iIndex)->GetProperty("path").asString();
+    const std::string& strPath = m_gridModel->GetChannelGroupMember(iIndex)->Path();
     if (strPath == channel)
     {
       GoToChannel(iIndex);
@@ -1138,8 +1138,7 @@ bool CGUIEPGGridContainer::SetChannel(const std::shared_ptr<CPVRChannel>& channe
 {
   for (int iIndex = 0; iIndex < m_gridModel->ChannelItemsSize(); iIndex++)
   {
-    auto channelId{static_cast<int>(
-        m_gridModel->GetChannelItem(iIndex)->GetProperty("channelid").asInteger(-1))};
+    const int channelId{m_gridModel->GetChannelGroupMember(iIndex)->Channel()->ChannelID()};
     if (channelId == channel->ChannelID())
     {
       GoToChannel(iIndex);
@@ -1153,8 +1152,7 @@ bool CGUIEPGGridContainer::SetChannel(const CPVRChannelNumber& channelNumber)
 {
   for (int iIndex = 0; iIndex < m_gridModel->ChannelItemsSize(); iIndex++)
   {
-    const CPVRChannelNumber& number =
-        m_gridModel->GetChannelItem(iIndex)->GetPVRChannelGroupMemberInfoTag()->ChannelNumber();
+    const CPVRChannelNumber& number = m_gridModel->GetChannelGroupMember(iIndex)->ChannelNumber();
     if (number == channelNumber)
     {
       GoToChannel(iIndex);
@@ -1382,15 +1380,9 @@ bool CGUIEPGGridContainer::OnMouseWheel(char wheel)
 
 std::shared_ptr<CPVRChannelGroupMember> CGUIEPGGridContainer::GetSelectedChannelGroupMember() const
 {
-  CFileItemPtr fileItem;
-  {
-    std::unique_lock lock(m_critSection);
-    if (m_channelCursor + m_channelOffset < m_gridModel->ChannelItemsSize())
-      fileItem = m_gridModel->GetChannelItem(m_channelCursor + m_channelOffset);
-  }
-
-  if (fileItem)
-    return fileItem->GetPVRChannelGroupMemberInfoTag();
+  std::unique_lock lock(m_critSection);
+  if (m_channelCursor + m_channelOffset < m_gridModel->ChannelItemsSize())
+    return m_gridModel->GetChannelGroupMember(m_channelCursor + m_channelOffset);
 
   return {};
 }
@@ -13,6 +13,7 @@
 #include "ServiceBroker.h"
 #include "pvr/PVRManager.h"
 #include "pvr/channels/PVRChannel.h"
+#include "pvr/channels/PVRChannelGroupMember.h"
 #include "pvr/epg/Epg.h"
 #include "pvr/epg/EpgChannelData.h"
 #include "pvr/epg/EpgContainer.h"
@@ -21,6 +22,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <memory>
 #include <vector>
@@ -36,22 +38,43 @@ CGUIEPGGridContainerModel::CGUIEPGGridContainerModel(unsigned int minutesPerBloc
 
 void CGUIEPGGridContainerModel::SetInvalid() const
 {
-  for (const auto& [_, gridItem] : m_gridIndex)
-    gridItem.item->SetInvalid();
+  for (const auto& [_, epgTags] : m_epgItems)
+  {
+    for (const auto& gridItem : epgTags.items)
+    {
+      if (gridItem.item)
+        gridItem.item->SetInvalid();
+    }
+  }
   for (const auto& channel : m_channelItems)
-    channel->SetInvalid();
+  {
+    if (channel)
+      channel->SetInvalid();
+  }
   for (const auto& ruler : m_rulerItems)
-    ruler->SetInvalid();
+  {
+    if (ruler)
+      ruler->SetInvalid();
+  }
 }
 
 std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateGapItem(int iChannel) const
 {
-  const std::shared_ptr<const CPVRChannel> channel =
-      m_channelItems[iChannel]->GetPVRChannelInfoTag();
+  const std::shared_ptr<const CPVRChannel> channel = m_channelMembers[iChannel]->Channel();
   const std::shared_ptr<CPVREpgInfoTag> gapTag = channel->CreateEPGGapTag(m_gridStart, m_gridEnd);
   return std::make_shared<CFileItem>(gapTag);
 }
 
+std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateRulerItem(int iIndex) const
+{
+  CDateTime rulerLocal;
+  rulerLocal.SetFromUTCDateTime(m_gridStart +
+                                CDateTimeSpan(0, 0, (iIndex - 1) * m_rulerItemMinutes, 0));
+  auto rulerItem{std::make_shared<CFileItem>(rulerLocal.GetAsLocalizedTime("", false))};
+  rulerItem->SetLabel2(rulerLocal.GetAsLocalizedDate(true));
+  return rulerItem;
+}
+
 std::vector<std::shared_ptr<CPVREpgInfoTag>> CGUIEPGGridContainerModel::GetEPGTimeline(
     int iChannel, const CDateTime& minEventEnd, const CDateTime& maxEventStart) const
 {
@@ -65,8 +88,14 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CGUIEPGGridContainerModel::GetEPGTi
   if (max > m_gridEnd)
     max = m_gridEnd;
 
-  return m_channelItems[iChannel]->GetPVRChannelInfoTag()->GetEPGTimeline(m_gridStart, m_gridEnd,
-                                                                          min, max);
+  return GetChannelEPGTimeline(iChannel, min, max);
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CGUIEPGGridContainerModel::GetChannelEPGTimeline(
+    int iChannel, const CDateTime& minEventEnd, const CDateTime& maxEventStart) const
+{
+  return m_channelMembers[iChannel]->Channel()->GetEPGTimeline(m_gridStart, m_gridEnd, minEventEnd,
+                                                               maxEventStart);
 }
 
 void CGUIEPGGridContainerModel::Initialize(const CFileItemList& items,
@@ -79,17 +108,22 @@ void CGUIEPGGridContainerModel::Initialize(const CFileItemList& items,
                                            int blocksPerRulerItem,
                                            float fBlockSize)
 {
-  if (!m_channelItems.empty())
+  if (!m_channelMembers.empty())
   {
     CLog::LogF(LOGERROR, "Already initialized!");
     return;
   }
 
+  const auto start = std::chrono::steady_clock::now();
+
   m_fBlockSize = fBlockSize;
 
   ////////////////////////////////////////////////////////////////////////
-  // Create channel items
-  std::ranges::copy(items, std::back_inserter(m_channelItems));
+  // Create channel items. only the group members are kept, items get created on-demand.
+  m_channelMembers.reserve(items.Size());
+  for (const auto& item : items)
+    m_channelMembers.emplace_back(item->GetPVRChannelGroupMemberInfoTag());
+  m_channelItems.resize(m_channelMembers.size());
 
   /* check for invalid start and end time */
   if (gridStart >= gridEnd)
@@ -136,27 +170,38 @@ void CGUIEPGGridContainerModel::Initialize(const CFileItemList& items,
   rulerDateItem->SetProperty("DateLabel", true);
   m_rulerItems.emplace_back(std::move(rulerDateItem));
 
-  // 2) ruler time items
-  const CDateTimeSpan unit(0, 0, blocksPerRulerItem * m_minutesPerBlock, 0);
-  CDateTime rulerLocal;
-  for (CDateTime rulerUTC = m_gridStart; rulerUTC < m_gridEnd; rulerUTC += unit)
-  {
-    rulerLocal.SetFromUTCDateTime(rulerUTC);
-    auto rulerItem{std::make_shared<CFileItem>(rulerLocal.GetAsLocalizedTime("", false))};
-    rulerItem->SetLabel2(rulerLocal.GetAsLocalizedDate(true));
-    m_rulerItems.emplace_back(std::move(rulerItem));
-  }
+  // 2) ruler time items, one per unit starting before grid end. created on demand.
+  m_rulerItemMinutes = std::max(blocksPerRulerItem, 1) * static_cast<int>(m_minutesPerBlock);
+  const int rulerItemSeconds = m_rulerItemMinutes * 60;
+  const int gridSeconds = (m_gridEnd - m_gridStart).GetSecondsTotal();
+  m_rulerItems.resize(1 + (gridSeconds + rulerItemSeconds - 1) / rulerItemSeconds);
 
   m_firstActiveChannel = iFirstChannel;
   m_lastActiveChannel = iFirstChannel + iChannelsPerPage - 1;
   m_firstActiveBlock = iFirstBlock;
   m_lastActiveBlock = iFirstBlock + iBlocksPerPage - 1;
+
+  CLog::LogFC(LOGDEBUG, LOGEPG, "Initialized grid of {} channels and {} blocks in {} us",
+              ChannelItemsSize(), m_blocks,
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count());
 }
 
-std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateEpgTags(int iChannel, int iBlock) const
+void CGUIEPGGridContainerModel::AddEpgTag(std::vector<GridItem>& items,
+                                          std::vector<GridItem>::const_iterator pos,
+                                          const std::shared_ptr<CPVREpgInfoTag>& tag) const
 {
-  std::shared_ptr<CFileItem> result;
+  const int startBlock = GetFirstEventBlock(tag);
+  const int endBlock = GetLastEventBlock(tag);
+  if (startBlock > endBlock)
+    return;
 
+  items.emplace(pos, tag, (endBlock - startBlock + 1) * m_fBlockSize, startBlock, endBlock);
+}
+
+void CGUIEPGGridContainerModel::CreateEpgTags(int iChannel, int iBlock) const
+{
   const int firstBlock = iBlock < m_firstActiveBlock ? iBlock : m_firstActiveBlock;
   const int lastBlock = iBlock > m_lastActiveBlock ? iBlock : m_lastActiveBlock;
 
@@ -166,7 +211,7 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateEpgTags(int iChannel
   const int firstResultBlock = GetFirstEventBlock(tags.front());
   const int lastResultBlock = GetLastEventBlock(tags.back());
   if (firstResultBlock > lastResultBlock)
-    return result;
+    return;
 
   auto it = m_epgItems.try_emplace(iChannel).first;
   EpgTags& epgTags = (*it).second;
@@ -174,55 +219,13 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateEpgTags(int iChannel
   epgTags.firstBlock = firstResultBlock;
   epgTags.lastBlock = lastResultBlock;
 
+  epgTags.items.reserve(tags.size());
   for (const auto& tag : tags)
-  {
-    if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
-      continue;
-
-    const auto item{std::make_shared<CFileItem>(tag)};
-    if (!result && IsEventMemberOfBlock(tag, iBlock))
-      result = item;
-
-    epgTags.tags.emplace_back(item);
-  }
-
-  return result;
-}
-
-std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTags(const EpgTagsMap::iterator& itEpg,
-                                                                 int iChannel,
-                                                                 int iBlock) const
-{
-  std::shared_ptr<CFileItem> result;
-
-  EpgTags& epgTags = (*itEpg).second;
-
-  if (iBlock < epgTags.firstBlock)
-  {
-    result = GetEpgTagsBefore(epgTags, iChannel, iBlock);
-  }
-  else if (iBlock > epgTags.lastBlock)
-  {
-    result = GetEpgTagsAfter(epgTags, iChannel, iBlock);
-  }
-  else
-  {
-    const auto it =
-        std::ranges::find_if(epgTags.tags, [this, iBlock](const auto& item)
-                             { return IsEventMemberOfBlock(item->GetEPGInfoTag(), iBlock); });
-    if (it != epgTags.tags.cend())
-      result = (*it);
-  }
-
-  return result;
+    AddEpgTag(epgTags.items, epgTags.items.cend(), tag);
 }
 
-std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTagsBefore(EpgTags& epgTags,
-                                                                       int iChannel,
-                                                                       int iBlock) const
+void CGUIEPGGridContainerModel::GetEpgTagsBefore(EpgTags& epgTags, int iChannel, int iBlock) const
 {
-  std::shared_ptr<CFileItem> result;
-
   int lastBlock = epgTags.firstBlock - 1;
   if (lastBlock < 0)
     lastBlock = 0;
@@ -242,49 +245,34 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTagsBefore(EpgTags&
     const int firstResultBlock = GetFirstEventBlock(tags.front());
     const int lastResultBlock = GetLastEventBlock(tags.back());
     if (firstResultBlock > lastResultBlock)
-      return result;
+      return;
 
     // insert before the existing tags
     epgTags.firstBlock = firstResultBlock;
 
-    auto it = tags.crbegin();
-    if (!epgTags.tags.empty())
+    auto it = tags.cend();
+    if (!epgTags.items.empty())
     {
       // ptr comp does not work for gap tags!
-      // if ((*it) == epgTags.tags.front()->GetEPGInfoTag())
+      // if (tags.back() == epgTags.items.front().tag)
 
-      const std::shared_ptr<const CPVREpgInfoTag> t = epgTags.tags.front()->GetEPGInfoTag();
-      if ((*it)->StartAsUTC() == t->StartAsUTC() && (*it)->EndAsUTC() == t->EndAsUTC())
-      {
-        if (!result && IsEventMemberOfBlock(*it, iBlock))
-          result = epgTags.tags.front();
-
-        ++it; // skip, because we already have that epg tag
-      }
+      const std::shared_ptr<const CPVREpgInfoTag> t = epgTags.items.front().tag;
+      if (tags.back()->StartAsUTC() == t->StartAsUTC() && tags.back()->EndAsUTC() == t->EndAsUTC())
+        --it; // skip, because we already have that epg tag
     }
 
-    for (; it != tags.crend(); ++it)
-    {
-      if (GetFirstEventBlock(*it) > GetLastEventBlock(*it))
-        continue;
-
-      const auto item{std::make_shared<CFileItem>(*it)};
-      if (!result && IsEventMemberOfBlock(*it, iBlock))
-        result = item;
+    std::vector<GridItem> items;
+    items.reserve(tags.size() + epgTags.items.size());
+    for (auto itTag = tags.cbegin(); itTag != it; ++itTag)
+      AddEpgTag(items, items.cend(), *itTag);
 
-      epgTags.tags.insert(epgTags.tags.begin(), item);
-    }
+    items.insert(items.cend(), epgTags.items.cbegin(), epgTags.items.cend());
+    epgTags.items = std::move(items);
   }
-
-  return result;
 }
 
-std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTagsAfter(EpgTags& epgTags,
-                                                                      int iChannel,
-                                                                      int iBlock) const
+void CGUIEPGGridContainerModel::GetEpgTagsAfter(EpgTags& epgTags, int iChannel, int iBlock) const
 {
-  std::shared_ptr<CFileItem> result;
-
   int firstBlock = epgTags.lastBlock + 1;
   if (firstBlock >= GetLastBlock())
     firstBlock = GetLastBlock();
@@ -304,64 +292,48 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTagsAfter(EpgTags& e
     const int firstResultBlock = GetFirstEventBlock(tags.front());
     const int lastResultBlock = GetLastEventBlock(tags.back());
     if (firstResultBlock > lastResultBlock)
-      return result;
+      return;
 
     // append to the existing tags
     epgTags.lastBlock = lastResultBlock;
 
     auto it = tags.cbegin();
-    if (!epgTags.tags.empty())
+    if (!epgTags.items.empty())
     {
       // ptr comp does not work for gap tags!
-      // if ((*it) == epgTags.tags.back()->GetEPGInfoTag())
+      // if ((*it) == epgTags.items.back().tag)
 
-      const std::shared_ptr<const CPVREpgInfoTag> t = epgTags.tags.back()->GetEPGInfoTag();
+      const std::shared_ptr<const CPVREpgInfoTag> t = epgTags.items.back().tag;
       if ((*it)->StartAsUTC() == t->StartAsUTC() && (*it)->EndAsUTC() == t->EndAsUTC())
-      {
-        if (!result && IsEventMemberOfBlock(*it, iBlock))
-          result = epgTags.tags.back();
-
         ++it; // skip, because we already have that epg tag
-      }
     }
 
     for (; it != tags.cend(); ++it)
-    {
-      if (GetFirstEventBlock(*it) > GetLastEventBlock(*it))
-        continue;
-
-      const auto item{std::make_shared<CFileItem>(*it)};
-      if (!result && IsEventMemberOfBlock(*it, iBlock))
-        result = item;
-
-      epgTags.tags.emplace_back(item);
-    }
+      AddEpgTag(epgTags.items, epgTags.items.cend(), *it);
   }
-
-  return result;
 }
 
-std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetItem(int iChannel, int iBlock) const
+GridItem* CGUIEPGGridContainerModel::FindEpgTag(EpgTags& epgTags, int iBlock)
 {
-  std::shared_ptr<CFileItem> result;
+  // events are sorted and do not overlap, the first one ending at or after the block is the one
+  const auto it = std::ranges::lower_bound(epgTags.items, iBlock, {}, &GridItem::endBlock);
+  if (it == epgTags.items.end() || (*it).startBlock > iBlock)
+    return nullptr;
 
-  auto itEpg = m_epgItems.find(iChannel);
-  if (itEpg == m_epgItems.end())
-  {
-    result = CreateEpgTags(iChannel, iBlock);
-  }
-  else
-  {
-    result = GetEpgTags(itEpg, iChannel, iBlock);
-  }
+  return &(*it);
+}
 
-  if (!result)
-  {
-    // Must never happen. if it does, fix the root cause, don't tolerate nullptr!
-    CLog::LogF(LOGERROR, "EPG tag ({}, {}) not found!", iChannel, iBlock);
-  }
+bool CGUIEPGGridContainerModel::TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock)
+{
+  // tags are contiguous, so the remaining ones still cover all blocks between their first and last
+  std::erase_if(epgTags.items, [firstBlock, lastBlock](const GridItem& gridItem)
+                { return gridItem.endBlock < firstBlock || gridItem.startBlock > lastBlock; });
+  if (epgTags.items.empty())
+    return false;
 
-  return result;
+  epgTags.firstBlock = epgTags.items.front().startBlock;
+  epgTags.lastBlock = epgTags.items.back().endBlock;
+  return true;
 }
 
 void CGUIEPGGridContainerModel::FindChannelAndBlockIndex(int channelUid,
@@ -375,14 +347,15 @@ void CGUIEPGGridContainerModel::FindChannelAndBlockIndex(int channelUid,
 
   // find the new channel index
   int iCurrentChannel = 0;
-  for (const auto& channel : m_channelItems)
+  for (const auto& member : m_channelMembers)
   {
-    if (channel->GetPVRChannelInfoTag()->UniqueID() == channelUid)
+    const std::shared_ptr<const CPVRChannel> channel = member->Channel();
+    if (channel->UniqueID() == channelUid)
     {
       newChannelIndex = iCurrentChannel;
 
       // find the new block index
-      const std::shared_ptr<const CPVREpg> epg = channel->GetPVRChannelInfoTag()->GetEPG();
+      const std::shared_ptr<const CPVREpg> epg = channel->GetEPG();
       if (epg)
       {
         const std::shared_ptr<const CPVREpgInfoTag> tag = epg->GetTagByBroadcastId(broadcastUid);
@@ -397,36 +370,50 @@ void CGUIEPGGridContainerModel::FindChannelAndBlockIndex(int channelUid,
 
 GridItem* CGUIEPGGridContainerModel::GetGridItemPtr(int iChannel, int iBlock) const
 {
-  auto it = m_gridIndex.find({iChannel, iBlock});
-  if (it == m_gridIndex.end())
+  const CDateTime startTime = GetStartTimeForBlock(iBlock);
+  if (startTime < m_gridStart || m_gridEnd < startTime)
   {
-    const CDateTime startTime = GetStartTimeForBlock(iBlock);
-    if (startTime < m_gridStart || m_gridEnd < startTime)
-    {
-      CLog::LogF(LOGERROR, "Requested EPG tag ({}, {}) outside grid boundaries!", iChannel, iBlock);
-      return nullptr;
-    }
+    CLog::LogF(LOGERROR, "Requested EPG tag ({}, {}) outside grid boundaries!", iChannel, iBlock);
+    return nullptr;
+  }
 
-    const std::shared_ptr<CFileItem> item = GetItem(iChannel, iBlock);
-    if (!item)
-    {
-      CLog::LogF(LOGERROR, "Got no EPG tag ({}, {})!", iChannel, iBlock);
-      return nullptr;
-    }
+  // fetch the events of the channel and block on-demand
+  auto itEpg = m_epgItems.find(iChannel);
+  if (itEpg == m_epgItems.end())
+  {
+    CreateEpgTags(iChannel, iBlock);
+    itEpg = m_epgItems.find(iChannel);
+  }
+  else if (iBlock < (*itEpg).second.firstBlock)
+  {
+    GetEpgTagsBefore((*itEpg).second, iChannel, iBlock);
+  }
+  else if (iBlock > (*itEpg).second.lastBlock)
+  {
+    GetEpgTagsAfter((*itEpg).second, iChannel, iBlock);
+  }
 
-    const std::shared_ptr<const CPVREpgInfoTag> epgTag = item->GetEPGInfoTag();
+  GridItem* result = itEpg == m_epgItems.end() ? nullptr : FindEpgTag((*itEpg).second, iBlock);
+  if (!result)
+  {
+    // Must never happen. if it does, fix the root cause, don't tolerate nullptr!
+    CLog::LogF(LOGERROR, "EPG tag ({}, {}) not found!", iChannel, iBlock);
+  }
 
-    const int startBlock = GetFirstEventBlock(epgTag);
-    const int endBlock = GetLastEventBlock(epgTag);
+  return result;
+}
 
-    //! @todo it seems that this should be done somewhere else. CFileItem ctor maybe.
-    item->SetProperty("GenreType", epgTag->GenreType());
+const std::shared_ptr<CFileItem>& CGUIEPGGridContainerModel::GetFileItem(GridItem& gridItem) const
+{
+  if (!gridItem.item)
+  {
+    gridItem.item = std::make_shared<CFileItem>(gridItem.tag);
 
-    const float fItemWidth = (endBlock - startBlock + 1) * m_fBlockSize;
-    it = m_gridIndex.try_emplace({iChannel, iBlock}, item, fItemWidth, startBlock, endBlock).first;
+    //! @todo it seems that this should be done somewhere else. CFileItem ctor maybe.
+    gridItem.item->SetProperty("GenreType", gridItem.tag->GenreType());
   }
 
-  return &(*it).second;
+  return gridItem.item;
 }
 
 bool CGUIEPGGridContainerModel::IsSameGridItem(int iChannel, int iBlock1, int iBlock2) const
@@ -434,16 +421,17 @@ bool CGUIEPGGridContainerModel::IsSameGridItem(int iChannel, int iBlock1, int iB
   if (iBlock1 == iBlock2)
     return true;
 
-  const GridItem* item1 = GetGridItemPtr(iChannel, iBlock1);
+  // copy, getting the second item may fetch more events and move the first
+  const GridItem item1 = *GetGridItemPtr(iChannel, iBlock1);
   const GridItem* item2 = GetGridItemPtr(iChannel, iBlock2);
 
   // compare the instances, not instance pointers, pointers are not unique.
-  return *item1 == *item2;
+  return item1 == *item2;
 }
 
 std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetGridItem(int iChannel, int iBlock) const
 {
-  return GetGridItemPtr(iChannel, iBlock)->item;
+  return GetFileItem(*GetGridItemPtr(iChannel, iBlock));
 }
 
 int CGUIEPGGridContainerModel::GetGridItemStartBlock(int iChannel, int iBlock) const
@@ -458,7 +446,7 @@ int CGUIEPGGridContainerModel::GetGridItemEndBlock(int iChannel, int iBlock) con
 
 CDateTime CGUIEPGGridContainerModel::GetGridItemEndTime(int iChannel, int iBlock) const
 {
-  return GetGridItemPtr(iChannel, iBlock)->item->GetEPGInfoTag()->EndAsUTC();
+  return GetGridItemPtr(iChannel, iBlock)->tag->EndAsUTC();
 }
 
 float CGUIEPGGridContainerModel::GetGridItemWidth(int iChannel, int iBlock) const
@@ -473,9 +461,13 @@ float CGUIEPGGridContainerModel::GetGridItemOriginWidth(int iChannel, int iBlock
 
 void CGUIEPGGridContainerModel::DecreaseGridItemWidth(int iChannel, int iBlock, float fSize)
 {
-  auto it = m_gridIndex.find({iChannel, iBlock});
-  if (it != m_gridIndex.end() && (*it).second.width != ((*it).second.originWidth - fSize))
-    (*it).second.width = (*it).second.originWidth - fSize;
+  const auto it = m_epgItems.find(iChannel);
+  if (it == m_epgItems.end())
+    return;
+
+  GridItem* gridItem = FindEpgTag((*it).second, iBlock);
+  if (gridItem && gridItem->width != (gridItem->originWidth - fSize))
+    gridItem->width = gridItem->originWidth - fSize;
 }
 
 unsigned int CGUIEPGGridContainerModel::GetGridStartPadding() const
@@ -491,22 +483,32 @@ unsigned int CGUIEPGGridContainerModel::GetGridStartPadding() const
 
 void CGUIEPGGridContainerModel::FreeChannelMemory(int keepStart, int keepEnd)
 {
+  // channel items get recreated on-demand.
   if (keepStart < keepEnd)
   {
     // remove before keepStart and after keepEnd
     for (int i = 0; i < keepStart && i < ChannelItemsSize(); ++i)
-      m_channelItems[i]->FreeMemory();
+      m_channelItems[i].reset();
     for (int i = keepEnd + 1; i < ChannelItemsSize(); ++i)
-      m_channelItems[i]->FreeMemory();
+      m_channelItems[i].reset();
   }
   else
   {
     // wrapping
     for (int i = keepEnd + 1; i < keepStart && i < ChannelItemsSize(); ++i)
-      m_channelItems[i]->FreeMemory();
+      m_channelItems[i].reset();
   }
 }
 
+std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetChannelItem(int iIndex) const
+{
+  std::shared_ptr<CFileItem>& item = m_channelItems[iIndex];
+  if (!item)
+    item = std::make_shared<CFileItem>(m_channelMembers[iIndex]);
+
+  return item;
+}
+
 bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
                                                     int lastChannel,
                                                     int firstBlock,
@@ -518,63 +520,22 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
   if (!channelsChanged && !blocksChanged)
     return false;
 
-  // clear the grid. it will be recreated on-demand.
-  m_gridIndex.clear();
-
-  bool newChannels = false;
-
-  if (channelsChanged)
-  {
-    // purge epg tags for inactive channels
-    for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
-    {
-      if ((*it).first < firstChannel || (*it).first > lastChannel)
-      {
-        it = m_epgItems.erase(it);
-        continue; // next channel
-      }
-      ++it;
-    }
-
-    newChannels = (firstChannel < m_firstActiveChannel) || (lastChannel > m_lastActiveChannel);
-  }
-
-  if (blocksChanged || newChannels)
+  // purge epg tags and their grid items for inactive channels and blocks. the others stay valid,
+  // tags of newly active channels and blocks get fetched on-demand, see GetGridItemPtr.
+  size_t tagsCount = 0;
+  size_t itemsCount = 0;
+  for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
   {
-    // clear and refetch epg tags for active channels
-    const CDateTime maxEnd = GetStartTimeForBlock(firstBlock);
-    const CDateTime minStart = GetStartTimeForBlock(lastBlock);
-    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
-    for (int i = firstChannel; i <= lastChannel; ++i)
+    if ((*it).first < firstChannel || (*it).first > lastChannel ||
+        (blocksChanged && !TrimEpgTags((*it).second, firstBlock, lastBlock)))
     {
-      auto it = m_epgItems.find(i);
-      if (it == m_epgItems.end())
-        it = m_epgItems.try_emplace(i).first;
-
-      if (blocksChanged || i < m_firstActiveChannel || i > m_lastActiveChannel)
-      {
-        EpgTags& epgTags = (*it).second;
-
-        (*it).second.tags.clear();
-
-        tags = GetEPGTimeline(i, maxEnd, minStart);
-        const int firstResultBlock = GetFirstEventBlock(tags.front());
-        const int lastResultBlock = GetLastEventBlock(tags.back());
-        if (firstResultBlock > lastResultBlock)
-          continue;
-
-        epgTags.firstBlock = firstResultBlock;
-        epgTags.lastBlock = lastResultBlock;
-
-        for (const auto& tag : tags)
-        {
-          if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
-            continue;
-
-          epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
-        }
-      }
+      it = m_epgItems.erase(it);
+      continue; // next channel
     }
+    tagsCount += (*it).second.items.size();
+    itemsCount += std::ranges::count_if((*it).second.items, [](const GridItem& gridItem)
+                                        { return gridItem.item != nullptr; });
+    ++it;
   }
 
   m_firstActiveChannel = firstChannel;
@@ -582,18 +543,22 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
   m_firstActiveBlock = firstBlock;
   m_lastActiveBlock = lastBlock;
 
+  CLog::LogFC(LOGDEBUG, LOGEPG,
+              "Active grid area channels {}-{}, blocks {}-{}: {} grid items, {} epg tags",
+              firstChannel, lastChannel, firstBlock, lastBlock, itemsCount, tagsCount);
   return true;
 }
 
 void CGUIEPGGridContainerModel::FreeRulerMemory(int keepStart, int keepEnd)
 {
+  // the date item is always kept, time items get recreated on-demand.
   if (keepStart < keepEnd)
   {
     // remove before keepStart and after keepEnd
     for (int i = 1; i < keepStart && i < RulerItemsSize(); ++i)
-      m_rulerItems[i]->FreeMemory();
+      m_rulerItems[i].reset();
     for (int i = keepEnd + 1; i < RulerItemsSize(); ++i)
-      m_rulerItems[i]->FreeMemory();
+      m_rulerItems[i].reset();
   }
   else
   {
@@ -603,11 +568,20 @@ void CGUIEPGGridContainerModel::FreeRulerMemory(int keepStart, int keepEnd)
       if (i == 0)
         continue;
 
-      m_rulerItems[i]->FreeMemory();
+      m_rulerItems[i].reset();
     }
   }
 }
 
+std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetRulerItem(int iIndex) const
+{
+  std::shared_ptr<CFileItem>& item = m_rulerItems[iIndex];
+  if (!item)
+    item = CreateRulerItem(iIndex);
+
+  return item;
+}
+
 unsigned int CGUIEPGGridContainerModel::GetPageNowOffset() const
 {
   return GetGridStartPadding() /
@@ -716,8 +690,9 @@ std::unique_ptr<CFileItemList> CGUIEPGGridContainerModel::GetCurrentTimeLineItem
     if (itEpg != m_epgItems.end())
     {
       // tags are sorted, so we can iterate and append
-      for (const auto& tag : (*itEpg).second.tags)
+      for (auto& gridItem : (*itEpg).second.items)
       {
+        const std::shared_ptr<CFileItem>& tag = GetFileItem(gridItem);
         tag->SetProperty("TimelineIndex", i);
         items->Add(tag);
         ++i;
@@ -10,7 +10,6 @@
 
 #include "XBDateTime.h"
 
-#include <functional>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -22,10 +21,16 @@ class CFileItemList;
 
 namespace PVR
 {
+class CPVRChannelGroupMember;
+class CPVREpgInfoTag;
+
 struct GridItem
 {
-  GridItem(const std::shared_ptr<CFileItem>& _item, float _width, int _startBlock, int _endBlock)
-    : item(_item),
+  GridItem(const std::shared_ptr<CPVREpgInfoTag>& _tag,
+           float _width,
+           int _startBlock,
+           int _endBlock)
+    : tag(_tag),
       originWidth(_width),
       width(_width),
       startBlock(_startBlock),
@@ -38,15 +43,14 @@ struct GridItem
     return (startBlock == other.startBlock && endBlock == other.endBlock);
   }
 
-  std::shared_ptr<CFileItem> item;
+  std::shared_ptr<CPVREpgInfoTag> tag;
+  std::shared_ptr<CFileItem> item; // created on demand
   float originWidth = 0.0f;
   float width = 0.0f;
   int startBlock = 0;
   int endBlock = 0;
 };
 
-class CPVREpgInfoTag;
-
 class CGUIEPGGridContainerModel
 {
 public:
@@ -75,15 +79,19 @@ public:
   bool FreeProgrammeMemory(int firstChannel, int lastChannel, int firstBlock, int lastBlock);
   void FreeRulerMemory(int keepStart, int keepEnd);
 
-  std::shared_ptr<CFileItem> GetChannelItem(int iIndex) const { return m_channelItems[iIndex]; }
-  bool HasChannelItems() const { return !m_channelItems.empty(); }
-  int ChannelItemsSize() const { return static_cast<int>(m_channelItems.size()); }
+  std::shared_ptr<CFileItem> GetChannelItem(int iIndex) const;
+  std::shared_ptr<CPVRChannelGroupMember> GetChannelGroupMember(int iIndex) const
+  {
+    return m_channelMembers[iIndex];
+  }
+  bool HasChannelItems() const { return !m_channelMembers.empty(); }
+  int ChannelItemsSize() const { return static_cast<int>(m_channelMembers.size()); }
   int GetLastChannel() const
   {
-    return m_channelItems.empty() ? -1 : static_cast<int>(m_channelItems.size()) - 1;
+    return m_channelMembers.empty() ? -1 : static_cast<int>(m_channelMembers.size()) - 1;
   }
 
-  std::shared_ptr<CFileItem> GetRulerItem(int iIndex) const { return m_rulerItems[iIndex]; }
+  std::shared_ptr<CFileItem> GetRulerItem(int iIndex) const;
   int RulerItemsSize() const { return static_cast<int>(m_rulerItems.size()); }
 
   int GridItemsSize() const { return m_blocks; }
@@ -99,7 +107,7 @@ public:
   bool IsZeroGridDuration() const { return (m_gridEnd - m_gridStart) == CDateTimeSpan(0, 0, 0, 0); }
   const CDateTime& GetGridStart() const { return m_gridStart; }
   const CDateTime& GetGridEnd() const { return m_gridEnd; }
-  unsigned int GetGridStartPadding() const;
+  virtual unsigned int GetGridStartPadding() const;
 
   unsigned int GetPageNowOffset() const;
   int GetNowBlock() const;
@@ -113,12 +121,24 @@ public:
 
   std::unique_ptr<CFileItemList> GetCurrentTimeLineItems(int firstChannel, int numChannels) const;
 
+protected:
+  /*!
+   * @brief Get the EPG events of a channel between the given times, gaps filled with gap tags.
+   * @param iChannel The index of the channel.
+   * @param minEventEnd The minimum end time of the events.
+   * @param maxEventStart The maximum start time of the events.
+   * @return The events.
+   */
+  virtual std::vector<std::shared_ptr<CPVREpgInfoTag>> GetChannelEPGTimeline(
+      int iChannel, const CDateTime& minEventEnd, const CDateTime& maxEventStart) const;
+
 private:
   CGUIEPGGridContainerModel() = delete;
 
   GridItem* GetGridItemPtr(int iChannel, int iBlock) const;
+  const std::shared_ptr<CFileItem>& GetFileItem(GridItem& gridItem) const;
   std::shared_ptr<CFileItem> CreateGapItem(int iChannel) const;
-  std::shared_ptr<CFileItem> GetItem(int iChannel, int iBlock) const;
+  std::shared_ptr<CFileItem> CreateRulerItem(int iIndex) const;
 
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEPGTimeline(int iChannel,
                                                               const CDateTime& minEventEnd,
@@ -126,47 +146,31 @@ private:
 
   struct EpgTags
   {
-    std::vector<std::shared_ptr<CFileItem>> tags;
+    std::vector<GridItem> items; ///< contiguous events, sorted by block
     int firstBlock = -1;
     int lastBlock = -1;
   };
 
   using EpgTagsMap = std::unordered_map<int, EpgTags>;
 
-  std::shared_ptr<CFileItem> CreateEpgTags(int iChannel, int iBlock) const;
-  std::shared_ptr<CFileItem> GetEpgTags(const EpgTagsMap::iterator& itEpg,
-                                        int iChannel,
-                                        int iBlock) const;
-  std::shared_ptr<CFileItem> GetEpgTagsBefore(EpgTags& epgTags, int iChannel, int iBlock) const;
-  std::shared_ptr<CFileItem> GetEpgTagsAfter(EpgTags& epgTags, int iChannel, int iBlock) const;
+  void AddEpgTag(std::vector<GridItem>& items,
+                 std::vector<GridItem>::const_iterator pos,
+                 const std::shared_ptr<CPVREpgInfoTag>& tag) const;
+  void CreateEpgTags(int iChannel, int iBlock) const;
+  void GetEpgTagsBefore(EpgTags& epgTags, int iChannel, int iBlock) const;
+  void GetEpgTagsAfter(EpgTags& epgTags, int iChannel, int iBlock) const;
+  static GridItem* FindEpgTag(EpgTags& epgTags, int iBlock);
+  static bool TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock);
 
-  mutable EpgTagsMap m_epgItems;
+  mutable EpgTagsMap m_epgItems; ///< events of the active area, the grid items
 
   CDateTime m_gridStart;
   CDateTime m_gridEnd;
 
-  std::vector<std::shared_ptr<CFileItem>> m_channelItems;
-  std::vector<std::shared_ptr<CFileItem>> m_rulerItems;
-
-  struct GridCoordinates
-  {
-    GridCoordinates(int _channel, int _block) : channel(_channel), block(_block) {}
-
-    bool operator==(const GridCoordinates& other) const = default;
-
-    int channel = 0;
-    int block = 0;
-  };
-
-  struct GridCoordinatesHash
-  {
-    std::size_t operator()(const GridCoordinates& coordinates) const
-    {
-      return std::hash<int>()(coordinates.channel) ^ std::hash<int>()(coordinates.block);
-    }
-  };
-
-  mutable std::unordered_map<GridCoordinates, GridItem, GridCoordinatesHash> m_gridIndex;
+  std::vector<std::shared_ptr<CPVRChannelGroupMember>> m_channelMembers;
+  mutable std::vector<std::shared_ptr<CFileItem>> m_channelItems; ///< items created on demand
+  mutable std::vector<std::shared_ptr<CFileItem>> m_rulerItems; ///< time items created on demand
+  int m_rulerItemMinutes = 0;
 
   int m_blocks = 0;
   const unsigned int m_minutesPerBlock{0};
@@ -0,0 +1,253 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "XBDateTime.h"
+#include "pvr/channels/PVRChannel.h"
+#include "pvr/channels/PVRChannelGroupMember.h"
+#include "pvr/epg/EpgInfoTag.h"
+#include "pvr/guilib/GUIEPGGridContainerModel.h"
+#include "utils/Variant.h"
+
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+constexpr time_t GUIDE_START = 1735689600; // 2025-01-01 00:00:00 UTC
+constexpr unsigned int MINUTES_PER_BLOCK = 5;
+constexpr int BLOCKS_PER_EVENT = 6; // 30 minutes
+constexpr int BLOCKS_PER_RULER_ITEM = 6;
+constexpr int BLOCKS_PER_PAGE = 24;
+constexpr int CHANNELS_PER_PAGE = 10;
+constexpr float BLOCK_SIZE = 10.0f;
+
+// every channel shows 30 minute events around the clock
+class CTestGridModel : public CGUIEPGGridContainerModel
+{
+public:
+  CTestGridModel() : CGUIEPGGridContainerModel(MINUTES_PER_BLOCK) {}
+
+  unsigned int GetGridStartPadding() const override { return 30; }
+
+  // the channels and time ranges the events were fetched for
+  mutable std::vector<std::pair<int, CDateTime>> m_fetches;
+
+protected:
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetChannelEPGTimeline(
+      int iChannel, const CDateTime& minEventEnd, const CDateTime& maxEventStart) const override
+  {
+    m_fetches.emplace_back(iChannel, minEventEnd);
+
+    constexpr int EVENT_SECONDS = BLOCKS_PER_EVENT * MINUTES_PER_BLOCK * 60;
+    const int minEnd = (minEventEnd - GetGridStart()).GetSecondsTotal();
+    const int maxStart = (maxEventStart - GetGridStart()).GetSecondsTotal();
+    const int gridSeconds = (GetGridEnd() - GetGridStart()).GetSecondsTotal();
+
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+    for (int start = minEnd / EVENT_SECONDS * EVENT_SECONDS;
+         start <= maxStart && start < gridSeconds; start += EVENT_SECONDS)
+    {
+      const CDateTime eventStart = GetGridStart() + CDateTimeSpan(0, 0, 0, start);
+      tags.emplace_back(std::make_shared<CPVREpgInfoTag>(
+          nullptr, iChannel, eventStart, eventStart + CDateTimeSpan(0, 0, 0, EVENT_SECONDS),
+          false));
+    }
+    return tags;
+  }
+};
+
+std::vector<std::shared_ptr<CPVRChannelGroupMember>> CreateMembers(int channels)
+{
+  std::vector<std::shared_ptr<CPVRChannelGroupMember>> members;
+  for (int i = 0; i < channels; ++i)
+  {
+    members.emplace_back(std::make_shared<CPVRChannelGroupMember>());
+    members.back()->SetChannel(std::make_shared<CPVRChannel>(false));
+  }
+  return members;
+}
+
+void Initialize(CTestGridModel& model,
+                const std::vector<std::shared_ptr<CPVRChannelGroupMember>>& members,
+                int days)
+{
+  CFileItemList items;
+  for (const auto& member : members)
+    items.Add(std::make_shared<CFileItem>(member));
+
+  const CDateTime gridStart(GUIDE_START);
+  model.Initialize(items, gridStart, gridStart + CDateTimeSpan(days, 0, 0, 0), 0, CHANNELS_PER_PAGE,
+                   0, BLOCKS_PER_PAGE, BLOCKS_PER_RULER_ITEM, BLOCK_SIZE);
+}
+
+// queries the grid items of the active area like the container does when processing it
+void ProcessArea(const CTestGridModel& model,
+                 int firstChannel,
+                 int lastChannel,
+                 int firstBlock,
+                 int lastBlock)
+{
+  for (int channel = firstChannel; channel <= lastChannel; ++channel)
+  {
+    for (int block = firstBlock; block <= lastBlock; ++block)
+    {
+      const int startBlock = block / BLOCKS_PER_EVENT * BLOCKS_PER_EVENT;
+      ASSERT_EQ(startBlock, model.GetGridItemStartBlock(channel, block));
+      ASSERT_EQ(startBlock + BLOCKS_PER_EVENT - 1, model.GetGridItemEndBlock(channel, block));
+    }
+  }
+}
+} // namespace
+
+TEST(TestGUIEPGGridContainerModel, TrimAndRefetchAcrossScrolls)
+{
+  CTestGridModel model;
+  Initialize(model, CreateMembers(20), 1);
+
+  // the first page fetches the events of its channels once
+  ProcessArea(model, 0, 9, 0, 23);
+  EXPECT_EQ(10u, model.m_fetches.size());
+  EXPECT_EQ(BLOCKS_PER_EVENT * BLOCK_SIZE, model.GetGridItemWidth(0, 3));
+  EXPECT_EQ(model.GetGridStart() + CDateTimeSpan(0, 0, 30, 0), model.GetGridItemEndTime(0, 3));
+  EXPECT_TRUE(model.IsSameGridItem(0, 0, 5));
+  EXPECT_FALSE(model.IsSameGridItem(0, 5, 6));
+
+  // half a page to the right keeps the events still active, only later ones are fetched
+  model.m_fetches.clear();
+  EXPECT_FALSE(model.FreeProgrammeMemory(0, 9, 0, 23));
+  EXPECT_TRUE(model.FreeProgrammeMemory(0, 9, 12, 35));
+  ProcessArea(model, 0, 9, 12, 35);
+  ASSERT_EQ(10u, model.m_fetches.size());
+  for (const auto& [_, minEventEnd] : model.m_fetches)
+    EXPECT_GT(minEventEnd, model.GetStartTimeForBlock(24));
+
+  // and back, the trimmed events before are fetched again
+  model.m_fetches.clear();
+  EXPECT_TRUE(model.FreeProgrammeMemory(0, 9, 0, 23));
+  ProcessArea(model, 0, 9, 0, 23);
+  EXPECT_EQ(10u, model.m_fetches.size());
+  ProcessArea(model, 0, 9, 0, 23);
+  EXPECT_EQ(10u, model.m_fetches.size());
+
+  // half a page down only fetches the events of the channels that became active
+  model.m_fetches.clear();
+  EXPECT_TRUE(model.FreeProgrammeMemory(5, 14, 0, 23));
+  ProcessArea(model, 5, 14, 0, 23);
+  ASSERT_EQ(5u, model.m_fetches.size());
+  for (const auto& [channel, _] : model.m_fetches)
+    EXPECT_GE(channel, 10);
+
+  // widths truncated for the view are restored for the next one
+  model.DecreaseGridItemWidth(5, 0, BLOCK_SIZE);
+  EXPECT_EQ((BLOCKS_PER_EVENT - 1) * BLOCK_SIZE, model.GetGridItemWidth(5, 3));
+  EXPECT_EQ(BLOCKS_PER_EVENT * BLOCK_SIZE, model.GetGridItemOriginWidth(5, 3));
+  model.DecreaseGridItemWidth(5, 2, 0.0f);
+  EXPECT_EQ(BLOCKS_PER_EVENT * BLOCK_SIZE, model.GetGridItemWidth(5, 3));
+}
+
+TEST(TestGUIEPGGridContainerModel, RulerItemsOnDemand)
+{
+  CTestGridModel model;
+  Initialize(model, CreateMembers(1), 1);
+
+  // a date item and a time item for every 30 minutes of the grid
+  const int gridMinutes = (model.GetGridEnd() - model.GetGridStart()).GetSecondsTotal() / 60;
+  ASSERT_EQ(1 + (gridMinutes + 29) / 30, model.RulerItemsSize());
+  EXPECT_TRUE(model.GetRulerItem(0)->GetProperty("DateLabel").asBoolean());
+
+  CDateTime rulerLocal;
+  rulerLocal.SetFromUTCDateTime(model.GetGridStart() + CDateTimeSpan(0, 0, 60, 0));
+  EXPECT_EQ(rulerLocal.GetAsLocalizedTime("", false), model.GetRulerItem(3)->GetLabel());
+  EXPECT_EQ(rulerLocal.GetAsLocalizedDate(true), model.GetRulerItem(3)->GetLabel2());
+
+  // items outside the kept range are released and created again when needed
+  const std::weak_ptr<CFileItem> dateItem = model.GetRulerItem(0);
+  const std::weak_ptr<CFileItem> released = model.GetRulerItem(3);
+  const std::shared_ptr<CFileItem> kept = model.GetRulerItem(15);
+  model.FreeRulerMemory(10, 20);
+  EXPECT_FALSE(dateItem.expired());
+  EXPECT_TRUE(released.expired());
+  EXPECT_EQ(kept, model.GetRulerItem(15));
+  EXPECT_EQ(rulerLocal.GetAsLocalizedTime("", false), model.GetRulerItem(3)->GetLabel());
+}
+
+TEST(TestGUIEPGGridContainerModel, ChannelItemsOnDemand)
+{
+  const auto members = CreateMembers(20);
+  CTestGridModel model;
+  std::weak_ptr<CFileItem> windowItem;
+  {
+    CFileItemList items;
+    for (const auto& member : members)
+      items.Add(std::make_shared<CFileItem>(member));
+    windowItem = items.Get(0);
+
+    model.Initialize(items, CDateTime(GUIDE_START),
+                     CDateTime(GUIDE_START) + CDateTimeSpan(1, 0, 0, 0), 0, CHANNELS_PER_PAGE, 0,
+                     BLOCKS_PER_PAGE, BLOCKS_PER_RULER_ITEM, BLOCK_SIZE);
+  }
+
+  // the model doesn't hold on to the items of the window
+  EXPECT_TRUE(windowItem.expired());
+  ASSERT_EQ(20, model.ChannelItemsSize());
+  EXPECT_EQ(members[3], model.GetChannelGroupMember(3));
+  EXPECT_EQ(members[3], model.GetChannelItem(3)->GetPVRChannelGroupMemberInfoTag());
+
+  // items outside the kept range are released and created again when needed
+  const std::weak_ptr<CFileItem> released = model.GetChannelItem(3);
+  const std::shared_ptr<CFileItem> kept = model.GetChannelItem(7);
+  model.FreeChannelMemory(5, 14);
+  EXPECT_TRUE(released.expired());
+  EXPECT_EQ(kept, model.GetChannelItem(7));
+  EXPECT_EQ(members[3], model.GetChannelItem(3)->GetPVRChannelGroupMemberInfoTag());
+}
+
+TEST(TestGUIEPGGridContainerModel, DISABLED_ThousandChannels)
+{
+  // a week of guide for 1,000 channels, scrolled down a page at a time
+  constexpr int CHANNELS = 1000;
+  const auto members = CreateMembers(CHANNELS);
+
+  const auto start = std::chrono::steady_clock::now();
+  CTestGridModel model;
+  Initialize(model, members, 7);
+  ProcessArea(model, 0, CHANNELS_PER_PAGE - 1, 0, BLOCKS_PER_PAGE - 1);
+  const auto opened = std::chrono::steady_clock::now();
+
+  for (int first = CHANNELS_PER_PAGE; first < CHANNELS; first += CHANNELS_PER_PAGE)
+  {
+    const int last = first + CHANNELS_PER_PAGE - 1;
+    model.FreeChannelMemory(first, last);
+    model.FreeProgrammeMemory(first, last, 0, BLOCKS_PER_PAGE - 1);
+    for (int channel = first; channel <= last; ++channel)
+      model.GetChannelItem(channel);
+    ProcessArea(model, first, last, 0, BLOCKS_PER_PAGE - 1);
+  }
+  const auto scrolled = std::chrono::steady_clock::now();
+
+  // the events of every channel were fetched once
+  EXPECT_EQ(static_cast<size_t>(CHANNELS), model.m_fetches.size());
+
+  RecordProperty("RulerItems", model.RulerItemsSize());
+  RecordProperty("OpenUs", static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                                opened - start)
+                                                .count()));
+  RecordProperty("PageUs", static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                                scrolled - opened)
+                                                .count() /
+                                            (CHANNELS / CHANNELS_PER_PAGE - 1)));
+}
@@ -375,12 +375,16 @@ void CAdvancedSettings::Initialize()
   m_iMusicLibraryDateAdded = 1; // prefer mtime over ctime and current time
   m_bMusicLibraryUseISODates = false;
   m_bMusicLibraryArtistNavigatesToSongs = false;
+  m_bMusicLibraryMemoryIndex = false;
 
   m_bVideoLibraryAllItemsOnBottom = false;
   m_iVideoLibraryRecentlyAddedItems = 25;
   m_bVideoLibraryCleanOnUpdate = false;
   m_bVideoLibraryUseFastHash = true;
+  m_videoLibraryFastHashThreads = 4;
+  m_bVideoLibraryIncrementalFastHash = false;
   m_bVideoScannerIgnoreErrors = false;
+  m_videoScannerLookupThreads = 4;
   m_iVideoLibraryDateAdded = 1; // prefer mtime over ctime and current time
   m_minimumEpisodePlaylistDuration = 5 * 60; // 5 minutes
   m_disableEpisodeRanges = false;
@@ -413,6 +417,11 @@ void CAdvancedSettings::Initialize()
   m_bEpgDisplayUpdatePopup = true; /* Display a progress popup while updating EPG data from clients */
   m_bEpgDisplayIncrementalUpdatePopup = false; /* Display a progress popup while doing incremental EPG updates, but
                                                   only if 'displayupdatepopup' is also enabled. */
+  m_bEpgMemoryIndex = false; /* Answer the guide's time range queries from an in-memory index of each
+                                EPG's events instead of the database */
+  m_bEpgSearchIndex = false; /* Maintain a full-text index of the titles and plots of the EPG events
+                                in the database to speed up guide searches, at the cost of slower
+                                EPG updates */
 
   m_bEdlMergeShortCommBreaks = false;      // Off by default
   m_EdlDisplayCommbreakNotifications = true; // On by default
@@ -430,6 +439,7 @@ void CAdvancedSettings::Initialize()
   m_curlDisableIPV6 = false;      //Certain hardware/OS combinations have trouble
                                   //with ipv6.
   m_curlDisableHTTP2 = false;
+  m_cacheSegments = 0;
 
 #if defined(TARGET_WINDOWS_DESKTOP)
   m_minimizeToTray = false;
@@ -869,6 +879,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "dateadded", m_iMusicLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "useisodates", m_bMusicLibraryUseISODates);
     XMLUtils::GetBoolean(pElement, "artistnavigatestosongs", m_bMusicLibraryArtistNavigatesToSongs);
+    XMLUtils::GetBoolean(pElement, "memoryindex", m_bMusicLibraryMemoryIndex);
     //Music artist name separators
     TiXmlElement* separators = pElement->FirstChildElement("artistseparators");
     if (separators)
@@ -891,6 +902,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "recentlyaddeditems", m_iVideoLibraryRecentlyAddedItems, 1, INT_MAX);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bVideoLibraryCleanOnUpdate);
     XMLUtils::GetBoolean(pElement, "usefasthash", m_bVideoLibraryUseFastHash);
+    XMLUtils::GetInt(pElement, "fasthashthreads", m_videoLibraryFastHashThreads, 1, 32);
+    XMLUtils::GetBoolean(pElement, "incrementalfasthash", m_bVideoLibraryIncrementalFastHash);
     XMLUtils::GetString(pElement, "itemseparator", m_videoItemSeparator);
     XMLUtils::GetBoolean(pElement, "importwatchedstate", m_bVideoLibraryImportWatchedState);
     XMLUtils::GetBoolean(pElement, "importresumepoint", m_bVideoLibraryImportResumePoint);
@@ -905,6 +918,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   if (pElement)
   {
     XMLUtils::GetBoolean(pElement, "ignoreerrors", m_bVideoScannerIgnoreErrors);
+    XMLUtils::GetUInt(pElement, "lookupthreads", m_videoScannerLookupThreads, 1, 16);
   }
 
   // Backward-compatibility of ExternalPlayer config
@@ -930,6 +944,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "curlkeepaliveinterval", m_curlKeepAliveInterval, 0, 300);
     XMLUtils::GetBoolean(pElement, "disableipv6", m_curlDisableIPV6);
     XMLUtils::GetBoolean(pElement, "disablehttp2", m_curlDisableHTTP2);
+    XMLUtils::GetInt(pElement, "cachesegments", m_cacheSegments, 0, 8);
     XMLUtils::GetString(pElement, "catrustfile", m_caTrustFile);
   }
 
@@ -1015,6 +1030,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "updateemptytagsinterval", m_iEpgUpdateEmptyTagsInterval);
     XMLUtils::GetBoolean(pElement, "displayupdatepopup", m_bEpgDisplayUpdatePopup);
     XMLUtils::GetBoolean(pElement, "displayincrementalupdatepopup", m_bEpgDisplayIncrementalUpdatePopup);
+    XMLUtils::GetBoolean(pElement, "memoryindex", m_bEpgMemoryIndex);
+    XMLUtils::GetBoolean(pElement, "searchindex", m_bEpgSearchIndex);
   }
 
   // EDL commercial break handling
@@ -1275,6 +1292,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement, "geometryclear", m_guiGeometryClear);
     XMLUtils::GetBoolean(pElement, "asynctextureupload", m_guiAsyncTextureUpload);
     XMLUtils::GetBoolean(pElement, "transparentvideolayout", m_guiVideoLayoutTransparent);
+    XMLUtils::GetBoolean(pElement, "fontglyphcache", m_guiFontGlyphCache);
+    XMLUtils::GetInt(pElement, "prefetchrows", m_guiPrefetchRows, 0, 50);
+    XMLUtils::GetInt(pElement, "texturememorybudget", m_guiTextureMemoryBudget, 0, 65536);
   }
 
   std::string seekSteps;
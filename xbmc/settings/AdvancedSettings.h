@@ -258,6 +258,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bMusicLibraryArtistSortOnUpdate;
     bool m_bMusicLibraryUseISODates;
     bool m_bMusicLibraryArtistNavigatesToSongs;
+    bool m_bMusicLibraryMemoryIndex{false}; ///< list artists and albums from an in-memory index
     std::string m_strMusicLibraryAlbumFormat;
     bool m_prioritiseAPEv2tags;
     std::string m_musicItemSeparator;
@@ -269,10 +270,13 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iVideoLibraryRecentlyAddedItems;
     bool m_bVideoLibraryCleanOnUpdate;
     bool m_bVideoLibraryUseFastHash;
+    int m_videoLibraryFastHashThreads{4};
+    bool m_bVideoLibraryIncrementalFastHash{false};
     bool m_bVideoLibraryImportWatchedState{true};
     bool m_bVideoLibraryImportResumePoint{true};
 
     bool m_bVideoScannerIgnoreErrors;
+    unsigned int m_videoScannerLookupThreads{4}; ///< concurrent scraper lookups of a scan
     int m_iVideoLibraryDateAdded;
 
     bool m_caseSensitiveLocalArtMatch{true};
@@ -289,6 +293,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iEpgUpdateEmptyTagsInterval; // seconds
     bool m_bEpgDisplayUpdatePopup;
     bool m_bEpgDisplayIncrementalUpdatePopup;
+    bool m_bEpgMemoryIndex{false}; ///< query the guide's time ranges from an in-memory index
+    bool m_bEpgSearchIndex{false}; ///< search the guide with a full-text index of the database
 
     // EDL Commercial Break
     bool m_bEdlMergeShortCommBreaks;
@@ -307,6 +313,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_curlKeepAliveInterval;    // seconds
     bool m_curlDisableIPV6;
     bool m_curlDisableHTTP2;
+    int m_cacheSegments; ///< number of read-ahead ranges kept by the file cache, < 2 disables
 
     std::string m_caTrustFile;
 
@@ -359,6 +366,9 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiGeometryClear{true};
     bool m_guiAsyncTextureUpload{false};
     bool m_guiVideoLayoutTransparent{false};
+    bool m_guiFontGlyphCache{true};
+    int m_guiPrefetchRows{4};
+    int m_guiTextureMemoryBudget{0}; ///< in MiB, 0 for an eighth of the physical memory
 
     unsigned int m_addonPackageFolderSize;
 
@@ -63,6 +63,8 @@ void CSkinSettings::SetString(int setting, const std::string& label) const
   if (!skin)
     return;
   skin->SetString(setting, label);
+
+  CServiceBroker::GetGUI()->GetInfoManager().ResetCache(INFO::DEPENDS_SKIN);
 }
 
 int CSkinSettings::TranslateBool(const std::string& setting) const
@@ -95,6 +97,8 @@ void CSkinSettings::SetBool(int setting, bool set) const
   if (!skin)
     return;
   skin->SetBool(setting, set);
+
+  CServiceBroker::GetGUI()->GetInfoManager().ResetCache(INFO::DEPENDS_SKIN);
 }
 
 void CSkinSettings::Reset(const std::string& setting) const
@@ -103,6 +107,8 @@ void CSkinSettings::Reset(const std::string& setting) const
   if (!skin)
     return;
   skin->Reset(setting);
+
+  CServiceBroker::GetGUI()->GetInfoManager().ResetCache(INFO::DEPENDS_SKIN);
 }
 
 std::set<ADDON::CSkinSettingPtr> CSkinSettings::GetSettings() const
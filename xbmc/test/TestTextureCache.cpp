@@ -0,0 +1,133 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "TextureCache.h"
+#include "TextureCacheJob.h"
+#include "imagefiles/ImageFileURL.h"
+#include "jobs/JobManager.h"
+#include "rendering/RenderSystem.h"
+#include "test/MtTestUtils.h"
+#include "test/TestUtils.h"
+#include "windowing/WinSystem.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ConditionPoll;
+
+namespace
+{
+// the textures of cached images are never uploaded, so none of the rendering is needed
+class CTestRenderSystem : public CRenderSystemBase
+{
+public:
+  bool InitRenderSystem() override { return true; }
+  bool DestroyRenderSystem() override { return true; }
+  bool ResetRenderSystem(int width, int height) override { return true; }
+  bool BeginRender() override { return true; }
+  bool EndRender() override { return true; }
+  void PresentRender(bool rendered, bool videoLayer) override {}
+  bool ClearBuffers(KODI::UTILS::COLOR::Color color) override { return true; }
+  bool IsExtSupported(const char* extension) const override { return false; }
+  void SetViewPort(const CRect& viewPort) override {}
+  void GetViewPort(CRect& viewPort) override {}
+  void SetScissors(const CRect& rect) override {}
+  void ResetScissors() override {}
+  void CaptureStateBlock() override {}
+  void ApplyStateBlock() override {}
+  void SetCameraPosition(const CPoint& camera,
+                         int screenWidth,
+                         int screenHeight,
+                         float stereoFactor) override
+  {
+  }
+};
+
+class CTestWinSystem : public CWinSystemBase
+{
+public:
+  bool CreateNewWindow(const std::string& name, bool fullScreen, RESOLUTION_INFO& res) override
+  {
+    return true;
+  }
+  bool ResizeWindow(int newWidth, int newHeight, int newLeft, int newTop) override { return true; }
+  bool SetFullScreen(bool fullScreen, RESOLUTION_INFO& res, bool blankOtherDisplays) override
+  {
+    return true;
+  }
+  void Register(IDispResource* resource) override {}
+  void Unregister(IDispResource* resource) override {}
+  CRenderSystemBase* GetRenderSystem() override { return &m_renderSystem; }
+
+private:
+  CTestRenderSystem m_renderSystem;
+};
+
+const std::vector<std::string> PICTURES = {"amp.jpg",     "cans.jpg",    "concert.jpg",
+                                           "guitar.jpg",  "speaker.jpg", "turntable.jpg",
+                                           "tweeter.jpg"};
+} // namespace
+
+class TestTextureCache : public testing::Test
+{
+protected:
+  TestTextureCache()
+  {
+    CServiceBroker::RegisterWinSystem(&m_winSystem);
+    CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+    m_textureCache = std::make_shared<CTextureCache>();
+    m_textureCache->Initialize();
+    CServiceBroker::RegisterTextureCache(m_textureCache);
+  }
+
+  ~TestTextureCache() override
+  {
+    m_textureCache->Deinitialize();
+    CServiceBroker::UnregisterTextureCache();
+    CServiceBroker::GetJobManager()->CancelJobs();
+    CServiceBroker::UnregisterJobManager();
+    CServiceBroker::UnregisterWinSystem();
+  }
+
+  CTestWinSystem m_winSystem;
+  std::shared_ptr<CTextureCache> m_textureCache;
+};
+
+TEST_F(TestTextureCache, CacheBatch)
+{
+  const std::string folder =
+      XBMC_REF_FILE_PATH("addons/webinterface.default/images/fanart_default/");
+
+  std::vector<std::string> images;
+  for (const auto& picture : PICTURES)
+  {
+    images.emplace_back(IMAGE_FILES::URLFromFile(folder + picture));
+    ASSERT_FALSE(m_textureCache->HasCachedImage(images.back()));
+  }
+
+  CTextureCacheBatchJob job(folder);
+  ASSERT_TRUE(job.DoWork());
+
+  // all the images are added to the database, even though they're less than a database batch
+  EXPECT_TRUE(poll(
+      [this, &images]
+      {
+        for (const auto& image : images)
+        {
+          if (!m_textureCache->HasCachedImage(image))
+            return false;
+        }
+        return true;
+      }));
+  for (const auto& image : images)
+    EXPECT_TRUE(m_textureCache->HasCachedImage(image)) << image;
+}
@@ -0,0 +1,529 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "JSONFastParser.h"
+
+#include "utils/Variant.h"
+
+#include <bit>
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#define JSON_PARSER_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define JSON_PARSER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+constexpr std::string_view UTF8_BOM = "\xEF\xBB\xBF";
+
+bool IsSpecial(unsigned char c)
+{
+  return c == '"' || c == '\\' || c < 0x20 || c >= 0x80;
+}
+
+/*!
+ \brief Find the first character of a string that can't be copied as is: the closing quote, an
+ escape, a control character or the start of a multibyte UTF-8 sequence.
+ */
+const char* FindSpecial(const char* pos, const char* end)
+{
+#if defined(JSON_PARSER_SSE2)
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i space = _mm_set1_epi8(0x20);
+  for (; end - pos >= 16; pos += 16)
+  {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+    // the signed compare also catches all bytes >= 0x80
+    const __m128i special =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                     _mm_cmplt_epi8(chunk, space));
+    const int mask = _mm_movemask_epi8(special);
+    if (mask != 0)
+      return pos + std::countr_zero(static_cast<unsigned int>(mask));
+  }
+#elif defined(JSON_PARSER_NEON)
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t space = vdupq_n_u8(0x20);
+  const uint8x16_t high = vdupq_n_u8(0x80);
+  for (; end - pos >= 16; pos += 16)
+  {
+    const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(pos));
+    const uint8x16_t special =
+        vorrq_u8(vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)),
+                 vorrq_u8(vcltq_u8(chunk, space), vcgeq_u8(chunk, high)));
+    const uint64x2_t lanes = vreinterpretq_u64_u8(special);
+    // the scalar loop below finds the exact position
+    if ((vgetq_lane_u64(lanes, 0) | vgetq_lane_u64(lanes, 1)) != 0)
+      break;
+  }
+#endif
+
+  for (; pos < end; ++pos)
+  {
+    if (IsSpecial(static_cast<unsigned char>(*pos)))
+      return pos;
+  }
+  return end;
+}
+
+/*!
+ \brief Get the length of the well-formed UTF-8 sequence at pos, 0 if it isn't well-formed
+ */
+size_t GetUTF8Length(const char* pos, const char* end)
+{
+  const auto byte = [pos](size_t i) { return static_cast<unsigned char>(pos[i]); };
+  const auto inRange = [](unsigned char c, unsigned char min, unsigned char max)
+  { return c >= min && c <= max; };
+
+  const unsigned char lead = byte(0);
+  const size_t available = static_cast<size_t>(end - pos);
+  if (inRange(lead, 0xC2, 0xDF))
+    return available >= 2 && inRange(byte(1), 0x80, 0xBF) ? 2 : 0;
+
+  if (inRange(lead, 0xE0, 0xEF))
+  {
+    if (available < 3)
+      return 0;
+    const unsigned char min = lead == 0xE0 ? 0xA0 : 0x80;
+    const unsigned char max = lead == 0xED ? 0x9F : 0xBF;
+    return inRange(byte(1), min, max) && inRange(byte(2), 0x80, 0xBF) ? 3 : 0;
+  }
+
+  if (inRange(lead, 0xF0, 0xF4))
+  {
+    if (available < 4)
+      return 0;
+    const unsigned char min = lead == 0xF0 ? 0x90 : 0x80;
+    const unsigned char max = lead == 0xF4 ? 0x8F : 0xBF;
+    return inRange(byte(1), min, max) && inRange(byte(2), 0x80, 0xBF) &&
+                   inRange(byte(3), 0x80, 0xBF)
+               ? 4
+               : 0;
+  }
+
+  return 0;
+}
+
+void AppendUTF8(std::string& str, uint32_t codepoint)
+{
+  if (codepoint < 0x80)
+    str.push_back(static_cast<char>(codepoint));
+  else if (codepoint < 0x800)
+  {
+    str.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+    str.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+  else if (codepoint < 0x10000)
+  {
+    str.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+    str.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+  else
+  {
+    str.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+    str.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+class CParser
+{
+public:
+  explicit CParser(std::string_view json) : m_pos(json.data()), m_end(json.data() + json.size())
+  {
+    if (json.starts_with(UTF8_BOM))
+      m_pos += UTF8_BOM.size();
+  }
+
+  bool Parse(CVariant& root)
+  {
+    std::string key;
+
+    while (true)
+    {
+      SkipWhitespace();
+      if (m_pos == m_end)
+        return false;
+
+      if (*m_pos == '{' || *m_pos == '[')
+      {
+        const bool isObject = *m_pos == '{';
+        ++m_pos;
+        CVariant* container = Store(
+            root, key,
+            CVariant(isObject ? CVariant::VariantTypeObject : CVariant::VariantTypeArray));
+        m_containers.push_back({container, isObject});
+
+        SkipWhitespace();
+        if (m_pos != m_end && *m_pos == (isObject ? '}' : ']'))
+        {
+          ++m_pos;
+          m_containers.pop_back();
+        }
+        else if (isObject)
+        {
+          if (!ParseKey(key))
+            return false;
+          continue;
+        }
+        else
+          continue;
+      }
+      else
+      {
+        CVariant value;
+        if (!ParseScalar(value))
+          return false;
+        Store(root, key, std::move(value));
+      }
+
+      // close the containers completed by the value, then move on to the next value
+      while (true)
+      {
+        SkipWhitespace();
+        if (m_containers.empty())
+          return m_pos == m_end;
+        if (m_pos == m_end)
+          return false;
+
+        const bool isObject = m_containers.back().isObject;
+        if (*m_pos == ',')
+        {
+          ++m_pos;
+          if (isObject && !ParseKey(key))
+            return false;
+          break;
+        }
+        if (*m_pos != (isObject ? '}' : ']'))
+          return false;
+
+        ++m_pos;
+        m_containers.pop_back();
+      }
+    }
+  }
+
+private:
+  struct Container
+  {
+    CVariant* value;
+    bool isObject;
+  };
+
+  /*!
+   \brief Store a value in the innermost open container, or as the root
+   \return the stored value
+   */
+  CVariant* Store(CVariant& root, const std::string& key, CVariant&& value)
+  {
+    if (m_containers.empty())
+    {
+      root = std::move(value);
+      return &root;
+    }
+
+    CVariant& container = *m_containers.back().value;
+    if (m_containers.back().isObject)
+    {
+      CVariant& member = container[key];
+      member = std::move(value);
+      return &member;
+    }
+
+    container.push_back(std::move(value));
+    return &container[container.size() - 1];
+  }
+
+  void SkipWhitespace()
+  {
+    while (m_pos != m_end && (*m_pos == ' ' || *m_pos == '\n' || *m_pos == '\r' || *m_pos == '\t'))
+      ++m_pos;
+  }
+
+  bool ParseKey(std::string& key)
+  {
+    SkipWhitespace();
+    if (m_pos == m_end || *m_pos != '"' || !ParseString(key))
+      return false;
+
+    SkipWhitespace();
+    if (m_pos == m_end || *m_pos != ':')
+      return false;
+
+    ++m_pos;
+    return true;
+  }
+
+  bool ParseScalar(CVariant& value)
+  {
+    switch (*m_pos)
+    {
+      case '"':
+      {
+        std::string str;
+        if (!ParseString(str))
+          return false;
+        value = CVariant(std::move(str));
+        return true;
+      }
+      case 't':
+        value = true;
+        return ParseLiteral("true");
+      case 'f':
+        value = false;
+        return ParseLiteral("false");
+      case 'n':
+        value = CVariant::ConstNullVariant;
+        return ParseLiteral("null");
+      default:
+        return ParseNumber(value);
+    }
+  }
+
+  bool ParseLiteral(std::string_view literal)
+  {
+    if (std::string_view(m_pos, m_end).substr(0, literal.size()) != literal)
+      return false;
+
+    m_pos += literal.size();
+    return true;
+  }
+
+  bool ParseString(std::string& str)
+  {
+    str.clear();
+    ++m_pos;
+
+    while (true)
+    {
+      const char* special = FindSpecial(m_pos, m_end);
+      str.append(m_pos, special);
+      m_pos = special;
+      if (m_pos == m_end)
+        return false;
+
+      const auto c = static_cast<unsigned char>(*m_pos);
+      if (c == '"')
+      {
+        ++m_pos;
+        return true;
+      }
+      if (c == '\\')
+      {
+        if (!ParseEscape(str))
+          return false;
+        continue;
+      }
+      if (c < 0x20)
+        return false;
+
+      const size_t length = GetUTF8Length(m_pos, m_end);
+      if (length == 0)
+        return false;
+      str.append(m_pos, length);
+      m_pos += length;
+    }
+  }
+
+  bool ParseEscape(std::string& str)
+  {
+    ++m_pos;
+    if (m_pos == m_end)
+      return false;
+
+    switch (*m_pos++)
+    {
+      case '"':
+        str.push_back('"');
+        return true;
+      case '\\':
+        str.push_back('\\');
+        return true;
+      case '/':
+        str.push_back('/');
+        return true;
+      case 'b':
+        str.push_back('\b');
+        return true;
+      case 'f':
+        str.push_back('\f');
+        return true;
+      case 'n':
+        str.push_back('\n');
+        return true;
+      case 'r':
+        str.push_back('\r');
+        return true;
+      case 't':
+        str.push_back('\t');
+        return true;
+      case 'u':
+        break;
+      default:
+        return false;
+    }
+
+    uint32_t codepoint;
+    if (!ParseHex(codepoint))
+      return false;
+
+    if (codepoint >= 0xD800 && codepoint <= 0xDBFF)
+    {
+      // a high surrogate has to be followed by an escaped low surrogate
+      uint32_t low;
+      if (m_end - m_pos < 2 || m_pos[0] != '\\' || m_pos[1] != 'u')
+        return false;
+      m_pos += 2;
+      if (!ParseHex(low) || low < 0xDC00 || low > 0xDFFF)
+        return false;
+      codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+    }
+    else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF)
+      return false;
+
+    AppendUTF8(str, codepoint);
+    return true;
+  }
+
+  bool ParseHex(uint32_t& value)
+  {
+    if (m_end - m_pos < 4)
+      return false;
+
+    value = 0;
+    for (int i = 0; i < 4; ++i, ++m_pos)
+    {
+      const char c = *m_pos;
+      value <<= 4;
+      if (c >= '0' && c <= '9')
+        value |= static_cast<uint32_t>(c - '0');
+      else if (c >= 'a' && c <= 'f')
+        value |= static_cast<uint32_t>(c - 'a' + 10);
+      else if (c >= 'A' && c <= 'F')
+        value |= static_cast<uint32_t>(c - 'A' + 10);
+      else
+        return false;
+    }
+    return true;
+  }
+
+  bool ParseNumber(CVariant& value)
+  {
+    const char* start = m_pos;
+    const bool negative = *m_pos == '-';
+    if (negative)
+      ++m_pos;
+
+    // integer part, without leading zeros
+    if (m_pos == m_end || !IsDigit(*m_pos))
+      return false;
+    uint64_t magnitude = 0;
+    bool overflow = false;
+    if (*m_pos == '0')
+      ++m_pos;
+    else
+    {
+      for (; m_pos != m_end && IsDigit(*m_pos); ++m_pos)
+      {
+        const auto digit = static_cast<uint64_t>(*m_pos - '0');
+        if (magnitude > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+          overflow = true;
+        magnitude = magnitude * 10 + digit;
+      }
+    }
+
+    bool isFloat = false;
+    if (m_pos != m_end && *m_pos == '.')
+    {
+      isFloat = true;
+      ++m_pos;
+      if (!SkipDigits())
+        return false;
+    }
+    if (m_pos != m_end && (*m_pos == 'e' || *m_pos == 'E'))
+    {
+      isFloat = true;
+      ++m_pos;
+      if (m_pos != m_end && (*m_pos == '+' || *m_pos == '-'))
+        ++m_pos;
+      if (!SkipDigits())
+        return false;
+    }
+
+    if (!isFloat && !overflow)
+    {
+      if (!negative)
+      {
+        value = CVariant(magnitude);
+        return true;
+      }
+      if (magnitude <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1)
+      {
+        value = CVariant(static_cast<int64_t>(0 - magnitude));
+        return true;
+      }
+    }
+
+    // like nlohmann/json, convert with the decimal point of the current locale
+    std::string number(start, m_pos);
+    const char decimalPoint = *std::localeconv()->decimal_point;
+    for (char& c : number)
+    {
+      if (c == '.')
+        c = decimalPoint;
+    }
+    const double result = std::strtod(number.c_str(), nullptr);
+    if (!std::isfinite(result))
+      return false;
+
+    value = CVariant(result);
+    return true;
+  }
+
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  bool SkipDigits()
+  {
+    if (m_pos == m_end || !IsDigit(*m_pos))
+      return false;
+    while (m_pos != m_end && IsDigit(*m_pos))
+      ++m_pos;
+    return true;
+  }
+
+  const char* m_pos;
+  const char* m_end;
+  std::vector<Container> m_containers;
+};
+} // namespace
+
+bool CJSONFastParser::Parse(std::string_view json, CVariant& data)
+{
+  CVariant root;
+  CParser parser(json);
+  if (!parser.Parse(root))
+    return false;
+
+  data = std::move(root);
+  return true;
+}
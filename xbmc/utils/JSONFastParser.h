@@ -0,0 +1,34 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string_view>
+
+class CVariant;
+
+/*!
+ \brief Parses JSON straight into a CVariant, scanning strings with SSE2 or NEON where available.
+
+ Builds the same CVariant as the nlohmann/json backend of CJSONVariantParser: non-negative
+ integers are unsigned, null is CVariant::ConstNullVariant and strings must be valid UTF-8.
+ Nesting is tracked on the heap, so deeply nested input can't exhaust the stack.
+ */
+class CJSONFastParser
+{
+public:
+  CJSONFastParser() = delete;
+
+  /*!
+   \brief Parse a JSON text
+   \param json the text to parse
+   \param data [out] the parsed value, left unchanged if the text isn't valid JSON
+   \return true if the text was parsed
+   */
+  static bool Parse(std::string_view json, CVariant& data);
+};
@@ -8,6 +8,8 @@
 
 #include "JSONVariantParser.h"
 
+#include "utils/JSONFastParser.h"
+
 #include <nlohmann/json.hpp>
 
 class CJSONVariantParserHandler : public nlohmann::json::json_sax_t
@@ -33,7 +35,7 @@ public:
 
 private:
   template <typename... TArgs>
-  bool Primitive(TArgs... args)
+  bool Primitive(TArgs&&... args)
   {
     PushObject(CVariant(std::forward<TArgs>(args)...));
     PopObject();
@@ -92,7 +94,7 @@ bool CJSONVariantParserHandler::number_float(number_float_t d, const string_t& s
 
 bool CJSONVariantParserHandler::string(std::string& str)
 {
-  return Primitive(str);
+  return Primitive(std::move(str));
 }
 
 bool CJSONVariantParserHandler::binary(binary_t& b)
@@ -109,13 +111,17 @@ bool CJSONVariantParserHandler::start_object(std::size_t elements)
 
 bool CJSONVariantParserHandler::key(std::string& str)
 {
-  m_key = str;
+  m_key = std::move(str);
 
   return true;
 }
 
 bool CJSONVariantParserHandler::end_object()
 {
+  // nlohmann/json reports some closing brackets after the end of the root value
+  if (m_parse.empty())
+    return false;
+
   PopObject();
 
   return true;
@@ -130,6 +136,10 @@ bool CJSONVariantParserHandler::start_array(std::size_t elements)
 
 bool CJSONVariantParserHandler::end_array()
 {
+  // nlohmann/json reports some closing brackets after the end of the root value
+  if (m_parse.empty())
+    return false;
+
   PopObject();
 
   return true;
@@ -148,8 +158,9 @@ void CJSONVariantParserHandler::PushObject(CVariant variant)
 
   if (m_status == PARSE_STATUS::Object)
   {
-    (*m_parse.back())[m_key] = std::move(variant);
-    m_parse.push_back(&((*m_parse.back())[m_key]));
+    CVariant& member = (*m_parse.back())[m_key];
+    member = std::move(variant);
+    m_parse.push_back(&member);
   }
   else if (m_status == PARSE_STATUS::Array)
   {
@@ -189,7 +200,7 @@ void CJSONVariantParserHandler::PopObject()
   }
   else
   {
-    m_parsedObject = *variant;
+    m_parsedObject = std::move(*variant);
     m_status = PARSE_STATUS::Variable;
   }
 }
@@ -199,11 +210,24 @@ bool CJSONVariantParser::Parse(const char* json, CVariant& data)
   if (json == nullptr)
     return false;
 
+#if defined(HAS_FAST_JSON_PARSER)
+  return CJSONFastParser::Parse(json, data);
+#else
   CJSONVariantParserHandler handler(data);
   return nlohmann::json::sax_parse(json, &handler);
+#endif
 }
 
 bool CJSONVariantParser::Parse(const std::string& json, CVariant& data)
 {
   return Parse(json.c_str(), data);
 }
+
+bool CJSONVariantParser::Parse(std::string_view json, CVariant& data, Backend backend)
+{
+  if (backend == Backend::FAST)
+    return CJSONFastParser::Parse(json, data);
+
+  CJSONVariantParserHandler handler(data);
+  return nlohmann::json::sax_parse(json.begin(), json.end(), &handler);
+}
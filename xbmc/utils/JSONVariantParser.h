@@ -11,12 +11,24 @@
 #include "utils/Variant.h"
 
 #include <string>
+#include <string_view>
 
 class CJSONVariantParser
 {
 public:
+  enum class Backend
+  {
+    NLOHMANN, ///< SAX parser of nlohmann/json
+    FAST ///< CJSONFastParser
+  };
+
   CJSONVariantParser() = delete;
 
+  /*!
+   \brief Parse with the backend selected at build time, see ENABLE_FAST_JSON_PARSER
+   */
   static bool Parse(const char* json, CVariant& data);
   static bool Parse(const std::string& json, CVariant& data);
+
+  static bool Parse(std::string_view json, CVariant& data, Backend backend);
 };
@@ -10,76 +10,193 @@
 
 #include "utils/Variant.h"
 
+#include <charconv>
+#include <limits>
+#include <type_traits>
+
 #include <nlohmann/json.hpp>
 
-void InternalWrite(nlohmann::json& writer, const CVariant& value)
+namespace
 {
-  switch (value.type())
+constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+/*!
+ \brief Writes the JSON of a CVariant straight into a buffer, without building an intermediate
+ document. The output is identical to nlohmann::json::dump().
+ */
+class CJSONStreamWriter
+{
+public:
+  CJSONStreamWriter(std::string& buffer,
+                    const CJSONVariantWriter::Sink* sink,
+                    bool compact)
+    : m_buffer(buffer), m_sink(sink), m_compact(compact)
+  {
+  }
+
+  template<typename Variant>
+  bool Write(Variant& value, unsigned int depth)
   {
-  case CVariant::VariantTypeInteger:
-    writer = value.asInteger();
-    break;
-  case CVariant::VariantTypeUnsignedInteger:
-    writer = value.asUnsignedInteger();
-    break;
-  case CVariant::VariantTypeDouble:
-    writer = value.asDouble();
-    break;
-  case CVariant::VariantTypeBoolean:
-    writer = value.asBoolean();
-    break;
-  case CVariant::VariantTypeString:
-    writer = std::string(value.c_str(), value.size());
-    break;
-  case CVariant::VariantTypeArray:
-    writer = nlohmann::json::array();
-
-    for (CVariant::const_iterator_array itr = value.begin_array(); itr != value.end_array(); ++itr)
+    // release the elements and members once written if the value isn't const
+    constexpr bool release = !std::is_const_v<Variant>;
+
+    switch (value.type())
     {
-      nlohmann::json& o = writer.emplace_back();
-      InternalWrite(o, *itr);
+      case CVariant::VariantTypeInteger:
+        WriteNumber(value.asInteger());
+        break;
+      case CVariant::VariantTypeUnsignedInteger:
+        WriteNumber(value.asUnsignedInteger());
+        break;
+      case CVariant::VariantTypeDouble:
+        m_buffer.append(nlohmann::json(value.asDouble()).dump());
+        break;
+      case CVariant::VariantTypeBoolean:
+        m_buffer.append(value.asBoolean() ? "true" : "false");
+        break;
+      case CVariant::VariantTypeString:
+        WriteString(std::string_view(value.c_str(), value.size()));
+        break;
+      case CVariant::VariantTypeArray:
+      {
+        if (value.empty())
+        {
+          m_buffer.append("[]");
+          break;
+        }
+
+        m_buffer.push_back('[');
+        for (auto itr = value.begin_array(); itr != value.end_array(); ++itr)
+        {
+          if (itr != value.begin_array())
+            m_buffer.push_back(',');
+          WriteIndent(depth + 1);
+          if (!Write(*itr, depth + 1))
+            return false;
+          if constexpr (release)
+            *itr = CVariant();
+        }
+        WriteIndent(depth);
+        m_buffer.push_back(']');
+        break;
+      }
+      case CVariant::VariantTypeObject:
+      {
+        if (value.empty())
+        {
+          m_buffer.append("{}");
+          break;
+        }
+
+        m_buffer.push_back('{');
+        for (auto itr = value.begin_map(); itr != value.end_map(); ++itr)
+        {
+          if (itr != value.begin_map())
+            m_buffer.push_back(',');
+          WriteIndent(depth + 1);
+          WriteString(itr->first);
+          m_buffer.append(m_compact ? ":" : ": ");
+          if (!Write(itr->second, depth + 1))
+            return false;
+          if constexpr (release)
+            itr->second = CVariant();
+        }
+        WriteIndent(depth);
+        m_buffer.push_back('}');
+        break;
+      }
+
+      case CVariant::VariantTypeConstNull:
+      case CVariant::VariantTypeNull:
+      default:
+        m_buffer.append("null");
+        break;
     }
 
-    break;
-  case CVariant::VariantTypeObject:
-    writer = nlohmann::json::object();
+    return m_buffer.size() < CHUNK_SIZE || Flush();
+  }
+
+  bool Flush()
+  {
+    if (m_sink == nullptr || m_buffer.empty())
+      return true;
+
+    const bool result = (*m_sink)(m_buffer);
+    m_buffer.clear();
+    return result;
+  }
 
-    for (CVariant::const_iterator_map itr = value.begin_map(); itr != value.end_map(); ++itr)
+private:
+  template<typename T>
+  void WriteNumber(T value)
+  {
+    char number[std::numeric_limits<T>::digits10 + 3];
+    const auto result = std::to_chars(std::begin(number), std::end(number), value);
+    m_buffer.append(number, result.ptr);
+  }
+
+  void WriteString(std::string_view value)
+  {
+    // anything needing escaping or validation is left to nlohmann::json
+    for (const char ch : value)
     {
-      nlohmann::json& o = writer[itr->first];
-      InternalWrite(o, itr->second);
+      const auto c = static_cast<unsigned char>(ch);
+      if (c < 0x20 || c > 0x7e || c == '"' || c == '\\')
+      {
+        m_buffer.append(nlohmann::json(std::string(value)).dump());
+        return;
+      }
     }
 
-    break;
+    m_buffer.push_back('"');
+    m_buffer.append(value);
+    m_buffer.push_back('"');
+  }
+
+  void WriteIndent(unsigned int depth)
+  {
+    if (m_compact)
+      return;
 
-  case CVariant::VariantTypeConstNull:
-  case CVariant::VariantTypeNull:
-  default:
-    writer = nullptr;
-    break;
+    m_buffer.push_back('\n');
+    m_buffer.append(depth, '\t');
   }
-}
+
+  std::string& m_buffer;
+  const CJSONVariantWriter::Sink* m_sink;
+  bool m_compact;
+};
+} // namespace
 
 bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool compact)
 {
+  output.clear();
   try
   {
-    nlohmann::json json;
-    InternalWrite(json, value);
-
-    if (compact)
-    {
-      output = json.dump();
-    }
-    else
-    {
-      output = json.dump(1, '\t');
-    }
+    CJSONStreamWriter writer(output, nullptr, compact);
+    return writer.Write(value, 0);
   }
   catch (nlohmann::json::exception&)
   {
     return false;
   }
+}
+
+bool CJSONVariantWriter::Write(CVariant&& value, const Sink& sink, bool compact)
+{
+  std::string buffer;
+  buffer.reserve(CHUNK_SIZE);
+
+  bool result = false;
+  try
+  {
+    CJSONStreamWriter writer(buffer, &sink, compact);
+    result = writer.Write(value, 0) && writer.Flush();
+  }
+  catch (nlohmann::json::exception&)
+  {
+  }
 
-  return true;
+  value = CVariant();
+  return result;
 }
@@ -8,14 +8,31 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <string_view>
 
 class CVariant;
 
 class CJSONVariantWriter
 {
 public:
+  /*!
+   \brief Receives the output of Write() chunk by chunk, returns false to stop writing
+   */
+  using Sink = std::function<bool(std::string_view chunk)>;
+
   CJSONVariantWriter() = delete;
 
   static bool Write(const CVariant &value, std::string& output, bool compact);
+
+  /*!
+   \brief Write a value in chunks of limited size, releasing every element and member of the
+   value as soon as it has been written.
+   \param value the value to write, null afterwards
+   \param sink receives the chunks of the output
+   \param compact whether to write without any whitespace
+   \return false if the value could not be written or the sink stopped writing
+   */
+  static bool Write(CVariant&& value, const Sink& sink, bool compact);
 };
@@ -147,6 +147,52 @@ CVariant CVariant::ConstNullVariant = CVariant::VariantTypeConstNull;
 CVariant::VariantArray CVariant::EMPTY_ARRAY;
 CVariant::VariantMap CVariant::EMPTY_MAP;
 
+CVariant::VariantObject::VariantObject() = default;
+
+CVariant::VariantObject::VariantObject(VariantMap&& map)
+{
+  if (!map.empty())
+    m_map = std::make_unique<VariantMap>(std::move(map));
+}
+
+CVariant::VariantObject::VariantObject(const VariantObject& other)
+{
+  if (other.m_map && !other.m_map->empty())
+    m_map = std::make_unique<VariantMap>(*other.m_map);
+}
+
+CVariant::VariantObject::VariantObject(VariantObject&& other) noexcept = default;
+
+CVariant::VariantObject::~VariantObject() = default;
+
+CVariant::VariantObject& CVariant::VariantObject::operator=(const VariantObject& other)
+{
+  VariantObject copy(other);
+  m_map = std::move(copy.m_map);
+  return *this;
+}
+
+CVariant::VariantObject& CVariant::VariantObject::operator=(VariantObject&& other) noexcept =
+    default;
+
+bool CVariant::VariantObject::operator==(const VariantObject& other) const
+{
+  return Get() == other.Get();
+}
+
+CVariant::VariantMap& CVariant::VariantObject::Get()
+{
+  if (!m_map)
+    m_map = std::make_unique<VariantMap>();
+  return *m_map;
+}
+
+const CVariant::VariantMap& CVariant::VariantObject::Get() const
+{
+  static const VariantMap empty;
+  return m_map ? *m_map : empty;
+}
+
 CVariant::CVariant(VariantType type)
 {
   switch (type)
@@ -179,7 +225,7 @@ CVariant::CVariant(VariantType type)
       m_data = VariantArray{};
       break;
     case VariantTypeObject:
-      m_data = VariantMap{};
+      m_data = VariantObject{};
       break;
   }
 }
@@ -270,27 +316,30 @@ CVariant::CVariant(const std::map<std::string, std::string> &strMap)
 {
   VariantMap tmpMap;
   for (const auto& elem : strMap)
-    tmpMap.emplace(elem.first, CVariant(elem.second));
+    tmpMap.emplace_hint(tmpMap.end(), elem.first, CVariant(elem.second));
 
-  m_data = std::move(tmpMap);
+  m_data = VariantObject(std::move(tmpMap));
 }
 
 CVariant::CVariant(std::map<std::string, std::string>&& strMap)
 {
   VariantMap tmpMap;
-  for (auto& elem : strMap)
-    tmpMap.emplace(elem.first, CVariant(std::move(elem.second)));
+  while (!strMap.empty())
+  {
+    auto elem = strMap.extract(strMap.begin());
+    tmpMap.emplace_hint(tmpMap.end(), std::move(elem.key()), CVariant(std::move(elem.mapped())));
+  }
 
-  m_data = std::move(tmpMap);
+  m_data = VariantObject(std::move(tmpMap));
 }
 
 CVariant::CVariant(const std::map<std::string, CVariant>& variantMap)
-  : m_data(std::in_place_type<VariantMap>, variantMap)
+  : m_data(std::in_place_type<VariantObject>, VariantMap(variantMap))
 {
 }
 
 CVariant::CVariant(std::map<std::string, CVariant>&& variantMap)
-  : m_data(std::in_place_type<VariantMap>, std::move(variantMap))
+  : m_data(std::in_place_type<VariantObject>, std::move(variantMap))
 {
 }
 
@@ -354,7 +403,7 @@ bool CVariant::isArray() const
 
 bool CVariant::isObject() const
 {
-  return std::holds_alternative<VariantMap>(m_data);
+  return std::holds_alternative<VariantObject>(m_data);
 }
 
 bool CVariant::isNull() const
@@ -468,17 +517,18 @@ CVariant& CVariant::operator[](const std::string& key) &
 {
   if (type() == VariantTypeNull)
   {
-    m_data = VariantMap{};
+    m_data = VariantObject{};
   }
 
-  return std::visit(overloaded{[&](VariantMap& m) -> CVariant& { return m[key]; },
+  return std::visit(overloaded{[&](VariantObject& o) -> CVariant& { return o.Get()[key]; },
                                [](auto&) -> CVariant& { return ConstNullVariant; }},
                     m_data);
 }
 
 const CVariant& CVariant::operator[](const std::string& key) const&
 {
-  return std::visit(overloaded{[&](const VariantMap& m) -> const CVariant& {
+  return std::visit(overloaded{[&](const VariantObject& o) -> const CVariant& {
+                                 const VariantMap& m = o.Get();
                                  auto it = m.find(key);
                                  return it != m.cend() ? it->second : ConstNullVariant;
                                },
@@ -488,7 +538,8 @@ const CVariant& CVariant::operator[](const std::string& key) const&
 
 CVariant CVariant::operator[](const std::string& key) &&
 {
-  return std::visit(overloaded{[&](VariantMap& m) -> CVariant {
+  return std::visit(overloaded{[&](VariantObject& o) -> CVariant {
+                                 VariantMap& m = o.Get();
                                  auto it = m.find(key);
                                  return it != m.cend() ? std::move(it->second) : ConstNullVariant;
                                },
@@ -529,8 +580,9 @@ CVariant &CVariant::operator=(const CVariant &rhs)
   if (type() == VariantTypeConstNull || this == &rhs)
     return *this;
 
-  cleanup();
-  m_data = rhs.m_data;
+  // rhs may be part of this value
+  auto data = rhs.m_data;
+  m_data = std::move(data);
   return *this;
 }
 
@@ -539,7 +591,9 @@ CVariant& CVariant::operator=(CVariant&& rhs) noexcept
   if (type() == VariantTypeConstNull || this == &rhs)
     return *this;
 
-  m_data = std::move(rhs.m_data);
+  // rhs may be part of this value
+  auto data = std::move(rhs.m_data);
+  m_data = std::move(data);
   return *this;
 }
 
@@ -636,13 +690,14 @@ CVariant::const_iterator_array CVariant::end_array() const
 CVariant::iterator_map CVariant::begin_map()
 {
   return std::visit(
-      overloaded{[](VariantMap& a) { return a.begin(); }, [](auto&) { return EMPTY_MAP.begin(); }},
+      overloaded{[](VariantObject& o) { return o.Get().begin(); },
+                 [](auto&) { return EMPTY_MAP.begin(); }},
       m_data);
 }
 
 CVariant::const_iterator_map CVariant::begin_map() const
 {
-  return std::visit(overloaded{[](const VariantMap& a) { return a.cbegin(); },
+  return std::visit(overloaded{[](const VariantObject& o) { return o.Get().cbegin(); },
                                [](const auto&) { return EMPTY_MAP.cbegin(); }},
                     m_data);
 }
@@ -650,20 +705,21 @@ CVariant::const_iterator_map CVariant::begin_map() const
 CVariant::iterator_map CVariant::end_map()
 {
   return std::visit(
-      overloaded{[](VariantMap& a) { return a.end(); }, [](auto&) { return EMPTY_MAP.end(); }},
+      overloaded{[](VariantObject& o) { return o.Get().end(); },
+                 [](auto&) { return EMPTY_MAP.end(); }},
       m_data);
 }
 
 CVariant::const_iterator_map CVariant::end_map() const
 {
-  return std::visit(overloaded{[](const VariantMap& m) { return m.cend(); },
+  return std::visit(overloaded{[](const VariantObject& o) { return o.Get().cend(); },
                                [](const auto&) { return EMPTY_MAP.cend(); }},
                     m_data);
 }
 
 unsigned int CVariant::size() const
 {
-  return std::visit(overloaded{[](const VariantMap& m) { return m.size(); },
+  return std::visit(overloaded{[](const VariantObject& o) { return o.Get().size(); },
                                [](const VariantArray& a) { return a.size(); },
                                [](const std::string& s) { return s.size(); },
                                [](const std::wstring& w) { return w.size(); },
@@ -673,7 +729,7 @@ unsigned int CVariant::size() const
 
 bool CVariant::empty() const
 {
-  return std::visit(overloaded{[](const VariantMap& m) { return m.empty(); },
+  return std::visit(overloaded{[](const VariantObject& o) { return o.Get().empty(); },
                                [](const VariantArray& a) { return a.empty(); },
                                [](const std::string& s) { return s.empty(); },
                                [](const std::wstring& w) { return w.empty(); },
@@ -684,7 +740,8 @@ bool CVariant::empty() const
 
 void CVariant::clear()
 {
-  std::visit(overloaded{[](VariantMap& m) { m.clear(); }, [](VariantArray& a) { a.clear(); },
+  std::visit(overloaded{[](VariantObject& o) { o = VariantObject{}; },
+                        [](VariantArray& a) { a.clear(); },
                         [](std::string& s) { s.clear(); }, [](std::wstring& w) { w.clear(); },
                         [](auto&) {}},
              m_data);
@@ -692,7 +749,8 @@ void CVariant::clear()
 
 void CVariant::erase(const std::string &key)
 {
-  std::visit(overloaded{[&](Null&) { m_data = VariantMap{}; }, [&](VariantMap& m) { m.erase(key); },
+  std::visit(overloaded{[&](Null&) { m_data = VariantObject{}; },
+                        [&](VariantObject& o) { o.Get().erase(key); },
                         [](const auto&) {}},
              m_data);
 }
@@ -706,7 +764,7 @@ void CVariant::erase(unsigned int position)
 
 bool CVariant::isMember(const std::string &key) const
 {
-  return std::visit(overloaded{[&](const VariantMap& m) { return m.contains(key); },
+  return std::visit(overloaded{[&](const VariantObject& o) { return o.Get().contains(key); },
                                [](const auto&) { return false; }},
                     m_data);
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <stdint.h>
 #include <string>
 #include <string_view>
@@ -165,6 +166,30 @@ private:
     bool operator==(const ConstNull&) const { return true; }
   };
 
+  /*!
+   \brief Keeps the members of an object on the heap, so that they don't add to the size of every
+   CVariant. Nothing is allocated until the first member is added, a moved from object is empty.
+   */
+  class VariantObject
+  {
+  public:
+    VariantObject();
+    explicit VariantObject(VariantMap&& map);
+    VariantObject(const VariantObject& other);
+    VariantObject(VariantObject&& other) noexcept;
+    ~VariantObject();
+
+    VariantObject& operator=(const VariantObject& other);
+    VariantObject& operator=(VariantObject&& other) noexcept;
+    bool operator==(const VariantObject& other) const;
+
+    VariantMap& Get();
+    const VariantMap& Get() const;
+
+  private:
+    std::unique_ptr<VariantMap> m_map;
+  };
+
   // Keep in sync with VariantType
   std::variant<Null,
                ConstNull,
@@ -175,7 +200,7 @@ private:
                std::string,
                std::wstring,
                VariantArray,
-               VariantMap>
+               VariantObject>
       m_data;
 
   static VariantArray EMPTY_ARRAY;
@@ -0,0 +1,203 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "test/TestUtils.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using Backend = CJSONVariantParser::Backend;
+
+// same types throughout, the values are compared as written JSON
+bool HaveSameTypes(const CVariant& a, const CVariant& b)
+{
+  if (a.type() != b.type() || a.size() != b.size())
+    return false;
+  if (a.isArray())
+  {
+    for (unsigned int i = 0; i < a.size(); i++)
+    {
+      if (!HaveSameTypes(a[i], b[i]))
+        return false;
+    }
+  }
+  else if (a.isObject())
+  {
+    for (auto it = a.begin_map(); it != a.end_map(); ++it)
+    {
+      if (!b.isMember(it->first) || !HaveSameTypes(it->second, b[it->first]))
+        return false;
+    }
+  }
+  return true;
+}
+
+void ExpectSameResult(std::string_view json)
+{
+  CVariant expected("unchanged");
+  CVariant actual("unchanged");
+  const bool parsed = CJSONVariantParser::Parse(json, expected, Backend::NLOHMANN);
+  EXPECT_EQ(parsed, CJSONVariantParser::Parse(json, actual, Backend::FAST)) << json;
+  if (!parsed)
+  {
+    EXPECT_EQ("unchanged", actual.asString()) << json;
+    return;
+  }
+
+  EXPECT_TRUE(HaveSameTypes(expected, actual)) << json;
+  std::string expectedJson;
+  std::string actualJson;
+  ASSERT_TRUE(CJSONVariantWriter::Write(expected, expectedJson, true));
+  ASSERT_TRUE(CJSONVariantWriter::Write(actual, actualJson, true));
+  EXPECT_EQ(expectedJson, actualJson) << json;
+}
+
+std::string ReadFile(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+} // namespace
+
+TEST(TestJSONFastParser, ParsesValues)
+{
+  ExpectSameResult("null");
+  ExpectSameResult("true");
+  ExpectSameResult(" false ");
+  ExpectSameResult("\"\"");
+  ExpectSameResult("[]");
+  ExpectSameResult("{}");
+  ExpectSameResult("\xEF\xBB\xBF{\"a\":1}");
+  ExpectSameResult(R"({"a":[1,-1,1.5,"b",null,true,{}],"c":{"d":[[]]},"":0})");
+  ExpectSameResult(R"({"key":1,"key":2})");
+
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse("[null,1,-1]", variant, Backend::FAST));
+  EXPECT_TRUE(variant[0].isNull());
+  EXPECT_TRUE(variant[1].isUnsignedInteger());
+  EXPECT_TRUE(variant[2].isInteger());
+}
+
+TEST(TestJSONFastParser, ParsesNumbers)
+{
+  for (const char* number :
+       {"0", "-0", "1", "-1", "18446744073709551615", "18446744073709551616", "-9223372036854775808",
+        "-9223372036854775809", "0.5", "-0.5", "1e3", "1E+3", "1e-3", "123.456e7", "1e308", "1e400",
+        "-1e400", "00", "01", "-", "1.", ".1", "1e", "+1", "0x1", "1.5.5", "NaN", "Infinity"})
+  {
+    ExpectSameResult(number);
+    ExpectSameResult(std::string("[") + number + "]");
+  }
+}
+
+TEST(TestJSONFastParser, ParsesStrings)
+{
+  // long enough to be scanned in vectors, with the special characters in every position
+  const std::string text(70, 'x');
+  for (size_t i = 0; i < text.size(); i += 7)
+  {
+    for (const char* special : {"\\\"", "\\\\", "\\/", "\\b\\f\\n\\r\\t", "\\u00e9", "\\u20AC",
+                                "\\ud83c\\udfb5", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x8E\xB5"})
+      ExpectSameResult("\"" + text.substr(0, i) + special + text.substr(i) + "\"");
+  }
+
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse(R"("aé🎵\n")", variant, Backend::FAST));
+  EXPECT_EQ("a\xC3\xA9\xF0\x9F\x8E\xB5\n", variant.asString());
+}
+
+TEST(TestJSONFastParser, RejectsInvalidStrings)
+{
+  const std::string text(40, 'x');
+  for (const char* invalid : {"\x01", "\n", "\\x", "\\u12", "\\u12G4", "\\ud83c", "\\ud83cx",
+                              "\\ud83c\\u0041", "\\udfb5", "\x80", "\xC0\xAF", "\xC3", "\xE0\x80\x80",
+                              "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF"})
+  {
+    ExpectSameResult(std::string("\"") + invalid + "\"");
+    ExpectSameResult("\"" + text + invalid + text + "\"");
+  }
+}
+
+TEST(TestJSONFastParser, RejectsInvalidJson)
+{
+  for (const char* invalid :
+       {"", " ", "{", "}", "[", "]", "[1,]", "[,1]", "{\"a\"}", "{\"a\":}", "{\"a\":1,}", "{1:1}",
+        "[1 2]", "{\"a\":1 \"b\":2}", "[]]", " []],1]", "{}}", "nul", "truex", "[true false]",
+        "\"a", "1 2", "[1]x", "\xEF\xBB"})
+    ExpectSameResult(invalid);
+}
+
+TEST(TestJSONFastParser, ParsesDeepNesting)
+{
+  constexpr int DEPTH = 100000;
+  const std::string json = std::string(DEPTH, '[') + std::string(DEPTH, ']');
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse(json, variant, Backend::FAST));
+  EXPECT_TRUE(variant.isArray());
+  EXPECT_FALSE(CJSONVariantParser::Parse(json.substr(1), variant, Backend::FAST));
+}
+
+TEST(TestJSONFastParser, DISABLED_Benchmark)
+{
+  // the JSON-RPC schema and the JSON test data of the utils
+  std::vector<std::string> documents;
+  for (const char* schema : {"methods.json", "notifications.json", "types.json"})
+    documents.emplace_back(ReadFile(
+        XBMC_REF_FILE_PATH(std::string("xbmc/interfaces/json-rpc/schema/") + schema)));
+  // the URL parsing test cases, numbered from 1.json
+  for (int number = 1;; number++)
+  {
+    const std::string path = XBMC_REF_FILE_PATH("xbmc/utils/test/testdata/" +
+                                                std::to_string(number) + ".json");
+    if (!std::ifstream(path))
+      break;
+    documents.emplace_back(ReadFile(path));
+  }
+  size_t bytes = 0;
+  for (const auto& document : documents)
+  {
+    ASSERT_FALSE(document.empty());
+    bytes += document.size();
+    ExpectSameResult(document);
+  }
+
+  constexpr int ROUNDS = 20;
+  auto measure = [&](Backend backend)
+  {
+    CVariant parsed;
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+      for (const auto& document : documents)
+        EXPECT_TRUE(CJSONVariantParser::Parse(document, parsed, backend));
+    }
+    return static_cast<int>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                              start)
+            .count() /
+        ROUNDS);
+  };
+
+  const int nlohmannUs = measure(Backend::NLOHMANN);
+  const int fastUs = measure(Backend::FAST);
+
+  RecordProperty("NlohmannUs", nlohmannUs);
+  RecordProperty("FastUs", fastUs);
+}
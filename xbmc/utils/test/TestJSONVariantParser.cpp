@@ -7,8 +7,12 @@
  */
 
 #include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 
+#include <chrono>
+#include <string>
+
 #include <gtest/gtest.h>
 
 TEST(TestJSONVariantParser, CannotParseNullptr)
@@ -187,3 +191,63 @@ TEST(TestJSONVariantParser, CanParseArray)
   ASSERT_TRUE(variant[0]["foo"].isString());
   ASSERT_STREQ("bar", variant[0]["foo"].asString().c_str());
 }
+
+TEST(TestJSONVariantParser, DISABLED_Benchmark)
+{
+  // an AudioLibrary.GetSongs response
+  constexpr int SONGS = 2000;
+  constexpr int ROUNDS = 10;
+
+  CVariant songs(CVariant::VariantTypeArray);
+  for (int i = 0; i < SONGS; i++)
+  {
+    CVariant song;
+    song["songid"] = i;
+    song["label"] = "Song " + std::to_string(i);
+    song["title"] = song["label"];
+    song["artist"].push_back("Artist " + std::to_string(i % 50));
+    song["artistid"].push_back(i % 50);
+    song["album"] = "Album " + std::to_string(i % 200);
+    song["albumid"] = i % 200;
+    song["genre"].push_back("Rock");
+    song["duration"] = 180 + i % 120;
+    song["rating"] = 0.5 * (i % 20);
+    song["file"] = "/storage/music/Artist/Album/" + std::to_string(i) + " - Song.flac";
+    songs.push_back(std::move(song));
+  }
+  CVariant response;
+  response["id"] = 1;
+  response["jsonrpc"] = "2.0";
+  response["result"]["songs"] = std::move(songs);
+  response["result"]["limits"]["start"] = 0;
+  response["result"]["limits"]["end"] = SONGS;
+  response["result"]["limits"]["total"] = SONGS;
+
+  std::string json;
+  ASSERT_TRUE(CJSONVariantWriter::Write(response, json, true));
+
+  auto measure = [](auto&& run)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round)
+      run();
+    return static_cast<int>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                              start)
+            .count() /
+        ROUNDS);
+  };
+
+  CVariant parsed;
+  const int parseUs = measure([&]() { ASSERT_TRUE(CJSONVariantParser::Parse(json, parsed)); });
+  std::string written;
+  const int writeUs =
+      measure([&]() { ASSERT_TRUE(CJSONVariantWriter::Write(parsed, written, true)); });
+  const int copyUs = measure([&]() { CVariant copy = parsed; });
+
+  EXPECT_EQ(json, written);
+
+  RecordProperty("ParseUs", parseUs);
+  RecordProperty("WriteUs", writeUs);
+  RecordProperty("CopyUs", copyUs);
+}
@@ -9,8 +9,67 @@
 #include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 
+#include <chrono>
+#include <fstream>
+#include <string>
+
 #include <gtest/gtest.h>
 
+namespace
+{
+// a result the size of AudioLibrary.GetSongs for a large library
+CVariant CreateSongs(int count)
+{
+  CVariant songs(CVariant::VariantTypeArray);
+  for (int i = 0; i < count; i++)
+  {
+    CVariant song(CVariant::VariantTypeObject);
+    song["songid"] = i;
+    song["label"] = "Song " + std::to_string(i);
+    song["title"] = "Song " + std::to_string(i);
+    song["artist"].push_back("Artist " + std::to_string(i % 500));
+    song["album"] = "Album " + std::to_string(i % 4000);
+    song["genre"].push_back("Rock");
+    song["duration"] = 180 + i % 240;
+    song["rating"] = 7.5;
+    song["year"] = 1960 + i % 60;
+    song["file"] = "/music/Artist " + std::to_string(i % 500) + "/Album " +
+                   std::to_string(i % 4000) + "/" + std::to_string(i) + ".flac";
+    song["thumbnail"] = "image://music@%2fmusic%2f" + std::to_string(i) + ".flac/";
+    songs.push_back(std::move(song));
+  }
+
+  CVariant response(CVariant::VariantTypeObject);
+  response["id"] = 1;
+  response["jsonrpc"] = "2.0";
+  response["result"]["songs"] = std::move(songs);
+  response["result"]["limits"]["start"] = 0;
+  response["result"]["limits"]["end"] = count;
+  response["result"]["limits"]["total"] = count;
+  return response;
+}
+
+// resets the peak resident set size of the process, only supported on Linux
+bool ResetPeakMemory()
+{
+  std::ofstream clearRefs("/proc/self/clear_refs");
+  return static_cast<bool>(clearRefs << "5");
+}
+
+// peak resident set size in KiB since ResetPeakMemory()
+int GetPeakMemory()
+{
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line))
+  {
+    if (line.starts_with("VmHWM:"))
+      return std::stoi(line.substr(6));
+  }
+  return 0;
+}
+} // namespace
+
 TEST(TestJSONVariantWriter, CanWriteNull)
 {
   CVariant variant;
@@ -149,3 +208,92 @@ TEST(TestJSONVariantWriter, CanWriteArray)
   ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
   ASSERT_STREQ("[\n\t{\n\t\t\"foo\": \"bar\"\n\t}\n]", str.c_str());
 }
+
+TEST(TestJSONVariantWriter, CanWriteChunks)
+{
+  CVariant variant(CVariant::VariantTypeArray);
+  for (int i = 0; i < 10000; i++)
+  {
+    CVariant obj(CVariant::VariantTypeObject);
+    obj["id"] = i;
+    obj["label"] = "item " + std::to_string(i);
+    variant.push_back(obj);
+  }
+
+  std::string expected;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, expected, true));
+
+  std::string str;
+  int chunks = 0;
+  CVariant copy = variant;
+  ASSERT_TRUE(CJSONVariantWriter::Write(
+      std::move(copy),
+      [&str, &chunks](std::string_view chunk)
+      {
+        str.append(chunk);
+        chunks++;
+        return true;
+      },
+      true));
+  EXPECT_EQ(expected, str);
+  EXPECT_LT(1, chunks);
+  EXPECT_TRUE(copy.isNull());
+
+  // stops writing when the sink fails
+  chunks = 0;
+  ASSERT_FALSE(CJSONVariantWriter::Write(
+      std::move(variant),
+      [&chunks](std::string_view chunk)
+      {
+        chunks++;
+        return false;
+      },
+      true));
+  EXPECT_EQ(1, chunks);
+}
+
+TEST(TestJSONVariantWriter, DISABLED_Benchmark)
+{
+  using namespace std::chrono;
+
+  CVariant response = CreateSongs(50000);
+  const bool measureMemory = ResetPeakMemory();
+  const int baseMemory = GetPeakMemory();
+
+  // the whole response as a string, the way HTTP and WebSocket clients get it
+  auto start = steady_clock::now();
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(response, str, true));
+  RecordProperty("StringMs",
+                 static_cast<int>(duration_cast<milliseconds>(steady_clock::now() - start).count()));
+  if (measureMemory)
+    RecordProperty("StringPeakKiB", GetPeakMemory() - baseMemory);
+  RecordProperty("ResponseKiB", static_cast<int>(str.size() / 1024));
+  const size_t size = str.size();
+  std::string().swap(str);
+
+  // chunk by chunk, the way raw TCP clients get it. The copy of the response being released while
+  // writing is part of the peak.
+  CVariant copy = response;
+  ResetPeakMemory();
+  const int copyMemory = GetPeakMemory();
+  start = steady_clock::now();
+  microseconds firstChunk{0};
+  size_t written = 0;
+  ASSERT_TRUE(CJSONVariantWriter::Write(
+      std::move(copy),
+      [&start, &firstChunk, &written](std::string_view chunk)
+      {
+        if (written == 0)
+          firstChunk = duration_cast<microseconds>(steady_clock::now() - start);
+        written += chunk.size();
+        return true;
+      },
+      true));
+  RecordProperty("ChunkedMs",
+                 static_cast<int>(duration_cast<milliseconds>(steady_clock::now() - start).count()));
+  RecordProperty("ChunkedFirstChunkUs", static_cast<int>(firstChunk.count()));
+  if (measureMemory)
+    RecordProperty("ChunkedPeakKiB", GetPeakMemory() - copyMemory);
+  EXPECT_EQ(size, written);
+}
@@ -13,7 +13,10 @@
 #include "utils/XTimeUtils.h"
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -211,3 +214,190 @@ TEST_F(TestJobManager, IsProcessing)
 
   job->FinishAndStopBlocking();
 }
+
+TEST_F(TestJobManager, ChangeJobPriority)
+{
+  Flags flags;
+  CServiceBroker::GetJobManager()->PauseJobs();
+  unsigned int id = CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(&flags), nullptr,
+                                                            CJob::PRIORITY_LOW_PAUSABLE);
+
+  // the job stays queued while paused, until it is moved to a priority that isn't
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(flags.finished);
+  EXPECT_TRUE(CServiceBroker::GetJobManager()->ChangeJobPriority(id, CJob::PRIORITY_NORMAL));
+  ASSERT_TRUE(poll([&flags]() -> bool { return flags.finished; }));
+
+  // the job is gone once it has completed
+  EXPECT_FALSE(CServiceBroker::GetJobManager()->ChangeJobPriority(id, CJob::PRIORITY_HIGH));
+  CServiceBroker::GetJobManager()->UnPauseJobs();
+}
+
+class TestJobManagerWorkStealing : public testing::Test
+{
+protected:
+  TestJobManagerWorkStealing()
+  {
+    CServiceBroker::RegisterJobManager(
+        std::make_shared<CJobManager>(CJobManager::Scheduler::WORK_STEALING));
+  }
+
+  ~TestJobManagerWorkStealing() override
+  {
+    CServiceBroker::GetJobManager()->CancelJobs();
+    CServiceBroker::GetJobManager()->Restart();
+    CServiceBroker::UnregisterJobManager();
+  }
+};
+
+TEST_F(TestJobManagerWorkStealing, AddJob)
+{
+  Flags* flags = new Flags();
+  ReallyDumbJob* job = new ReallyDumbJob(flags);
+  CServiceBroker::GetJobManager()->AddJob(job, nullptr);
+  ASSERT_TRUE(poll([flags]() -> bool { return flags->finished; }));
+  delete flags;
+}
+
+TEST_F(TestJobManagerWorkStealing, CancelJob)
+{
+  Flags* flags = new Flags();
+  DummyJob* job = new DummyJob(flags);
+  unsigned int id = CServiceBroker::GetJobManager()->AddJob(job, nullptr);
+
+  ASSERT_TRUE(poll([flags]() -> bool { return flags->started; }));
+  CServiceBroker::GetJobManager()->CancelJob(id);
+  flags->lingerAtWork = false;
+
+  ASSERT_TRUE(poll([flags]() -> bool { return flags->finished; }));
+  EXPECT_TRUE(flags->wasCanceled);
+  delete flags;
+}
+
+TEST_F(TestJobManagerWorkStealing, PauseLowPriorityJob)
+{
+  JobControlPackage package;
+  BroadcastingJob* job(WaitForJobToStartProcessing(CJob::PRIORITY_LOW_PAUSABLE, package));
+
+  EXPECT_TRUE(CServiceBroker::GetJobManager()->IsProcessing(CJob::PRIORITY_LOW_PAUSABLE));
+  EXPECT_EQ(1, CServiceBroker::GetJobManager()->IsProcessing("BroadcastingJob"));
+  CServiceBroker::GetJobManager()->PauseJobs();
+  EXPECT_FALSE(CServiceBroker::GetJobManager()->IsProcessing(CJob::PRIORITY_LOW_PAUSABLE));
+  EXPECT_EQ(0, CServiceBroker::GetJobManager()->IsProcessing("BroadcastingJob"));
+  CServiceBroker::GetJobManager()->UnPauseJobs();
+  EXPECT_TRUE(CServiceBroker::GetJobManager()->IsProcessing(CJob::PRIORITY_LOW_PAUSABLE));
+
+  job->FinishAndStopBlocking();
+}
+
+namespace
+{
+class KeyedJob : public CJob
+{
+public:
+  explicit KeyedJob(int key) : m_key(key) {}
+
+  bool DoWork() override { return true; }
+
+  bool Equals(const CJob* job) const override
+  {
+    const auto* keyed = dynamic_cast<const KeyedJob*>(job);
+    return keyed && keyed->m_key == m_key;
+  }
+
+private:
+  int m_key;
+};
+} // namespace
+
+TEST_F(TestJobManagerWorkStealing, AddJobFindsEqualJobInOtherQueue)
+{
+  constexpr int rounds = 200;
+  constexpr unsigned int producers = 8;
+
+  // jobs added from outside the workers are distributed over all queues
+  CJobManager manager(CJobManager::Scheduler::WORK_STEALING, 4);
+  manager.PauseJobs();
+  for (int round = 0; round < rounds; ++round)
+  {
+    std::vector<unsigned int> ids(producers);
+    std::vector<std::thread> threads;
+    for (unsigned int p = 0; p < producers; ++p)
+    {
+      threads.emplace_back(
+          [&manager, &ids, p, round]()
+          { ids[p] = manager.AddJob(new KeyedJob(round), nullptr, CJob::PRIORITY_LOW_PAUSABLE); });
+    }
+    for (auto& thread : threads)
+      thread.join();
+
+    for (unsigned int p = 1; p < producers; ++p)
+      ASSERT_EQ(ids[0], ids[p]) << "round " << round;
+  }
+  manager.CancelJobs();
+}
+
+namespace
+{
+class CountingJob : public CJob
+{
+public:
+  explicit CountingJob(std::atomic<unsigned int>& counter) : m_counter(counter) {}
+
+  bool DoWork() override
+  {
+    ++m_counter;
+    return true;
+  }
+
+private:
+  std::atomic<unsigned int>& m_counter;
+};
+
+double MeasureJobsPerSecond(CJobManager::Scheduler scheduler, unsigned int workers)
+{
+  constexpr unsigned int jobs = 20000;
+  constexpr unsigned int producers = 4;
+
+  CJobManager manager(scheduler, workers);
+  std::atomic<unsigned int> counter{0};
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (unsigned int p = 0; p < producers; ++p)
+  {
+    threads.emplace_back(
+        [&manager, &counter]()
+        {
+          for (unsigned int i = 0; i < jobs / producers; ++i)
+            manager.AddJob(new CountingJob(counter), nullptr, CJob::PRIORITY_HIGH);
+        });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_TRUE(poll([&counter]() -> bool { return counter == jobs; }));
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  manager.CancelJobs();
+  return jobs / elapsed.count();
+}
+} // namespace
+
+class TestJobManagerThroughput : public testing::TestWithParam<unsigned int>
+{
+};
+
+TEST_P(TestJobManagerThroughput, DISABLED_JobsPerSecond)
+{
+  const unsigned int workers = GetParam();
+  const double shared = MeasureJobsPerSecond(CJobManager::Scheduler::SHARED_QUEUE, workers);
+  const double stealing = MeasureJobsPerSecond(CJobManager::Scheduler::WORK_STEALING, workers);
+
+  RecordProperty("SharedQueueJobsPerSecond", static_cast<int>(shared));
+  RecordProperty("WorkStealingJobsPerSecond", static_cast<int>(stealing));
+}
+
+INSTANTIATE_TEST_SUITE_P(Workers,
+                         TestJobManagerThroughput,
+                         testing::Values(1u, 2u, 4u, 8u, 16u));
@@ -415,3 +415,35 @@ TEST(TestVariant, ConstNullVariant_cant_be_changed)
   EXPECT_EQ(CVariant::VariantTypeConstNull, CVariant::ConstNullVariant.type());
   EXPECT_EQ(CVariant::VariantTypeConstNull, c3.type());
 }
+
+TEST(TestVariant, Compact)
+{
+  // the members of objects are kept on the heap, strings are the largest value kept inline
+  EXPECT_LE(sizeof(CVariant), sizeof(std::string) + sizeof(uint64_t));
+
+  CVariant object(CVariant::VariantTypeObject);
+  EXPECT_TRUE(object.isObject());
+  EXPECT_TRUE(object.empty());
+  EXPECT_EQ(CVariant(CVariant::VariantTypeObject), object);
+
+  object["foo"] = 1;
+  CVariant copy = object;
+  copy["foo"] = 2;
+  EXPECT_EQ(1, object["foo"].asInteger());
+
+  CVariant moved = std::move(object);
+  EXPECT_EQ(1, moved["foo"].asInteger());
+  EXPECT_TRUE(object.isObject());
+  EXPECT_TRUE(object.empty());
+}
+
+TEST(TestVariant, AssignMember)
+{
+  CVariant variant;
+  variant["foo"]["bar"] = "baz";
+  variant = variant["foo"];
+  EXPECT_STREQ("baz", variant["bar"].c_str());
+
+  variant = std::move(variant["bar"]);
+  EXPECT_STREQ("baz", variant.c_str());
+}
@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RecursiveFastHash.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+
+using namespace XFILE;
+
+namespace KODI::VIDEO
+{
+
+CRecursiveFastHash::CRecursiveFastHash(unsigned int maxThreads, const DirectoryStates* knownStates)
+  : m_maxThreads(std::max(maxThreads, 1u)),
+    m_knownStates(knownStates)
+{
+}
+
+int64_t CRecursiveFastHash::Walk(const std::string& directory)
+{
+  m_states.clear();
+  m_changed = false;
+  m_listed = 0;
+
+  int64_t time = 0;
+  std::vector<std::string> level{directory};
+  while (!level.empty())
+  {
+    std::vector<VisitResult> results(level.size());
+    std::atomic<size_t> next{0};
+    const auto visitLevel = [this, &level, &results, &next]()
+    {
+      for (size_t i = next++; i < level.size(); i = next++)
+        results[i] = Visit(level[i]);
+    };
+
+    const size_t threads = std::min<size_t>(m_maxThreads, level.size());
+    std::vector<std::future<void>> tasks;
+    for (size_t i = 1; i < threads; ++i)
+      tasks.emplace_back(std::async(std::launch::async, visitLevel));
+    visitLevel();
+    for (auto& task : tasks)
+      task.get();
+
+    std::vector<std::string> nextLevel;
+    for (size_t i = 0; i < level.size(); ++i)
+    {
+      VisitResult& result = results[i];
+      if (!result.mtime)
+        return 0;
+
+      time += result.mtime;
+      if (result.listed)
+      {
+        m_changed = true;
+        ++m_listed;
+      }
+
+      DirectoryState& state = m_states[level[i]];
+      state.mtime = result.mtime;
+      state.trusted = result.trusted;
+      state.subDirs = result.knownSubDirs ? *result.knownSubDirs : std::move(result.subDirs);
+      nextLevel.insert(nextLevel.end(), state.subDirs.begin(), state.subDirs.end());
+    }
+    level = std::move(nextLevel);
+  }
+
+  // known states of directories that are no longer part of the tree are dropped
+  if (m_knownStates && m_knownStates->size() != m_states.size())
+    m_changed = true;
+
+  return time;
+}
+
+CRecursiveFastHash::VisitResult CRecursiveFastHash::Visit(const std::string& directory) const
+{
+  VisitResult result;
+
+  struct __stat64 buffer;
+  if (CFile::Stat(directory, &buffer) != 0)
+    return result;
+
+  result.mtime = buffer.st_mtime ? buffer.st_mtime : buffer.st_ctime;
+  if (!result.mtime)
+    return result;
+
+  if (m_knownStates)
+  {
+    const auto it = m_knownStates->find(directory);
+    if (it != m_knownStates->end() && it->second.mtime == result.mtime)
+    {
+      if (it->second.trusted)
+      {
+        result.knownSubDirs = &it->second.subDirs;
+        result.trusted = true;
+        return result;
+      }
+
+      // unchanged since a previous walk listed it, so this listing misses nothing of that time
+      result.trusted = true;
+    }
+  }
+
+  CFileItemList items;
+  CDirectory::GetDirectory(directory, items, "", DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO);
+  for (const auto& item : items)
+  {
+    if (item->IsFolder() && !item->IsPath(".."))
+      result.subDirs.emplace_back(item->GetPath());
+  }
+  result.listed = true;
+  return result;
+}
+
+} // namespace KODI::VIDEO
@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace KODI::VIDEO
+{
+
+/*!
+ \brief Last known state of a directory, used to skip listing it while its modification time
+ does not change.
+ */
+struct DirectoryState
+{
+  int64_t mtime{0}; //!< modification (or creation) time of the directory when it was listed
+  bool trusted{false}; //!< whether the listing is known to hold every entry of that time
+  std::vector<std::string> subDirs; //!< paths of the sub directories
+};
+
+using DirectoryStates = std::map<std::string, DirectoryState, std::less<>>;
+
+/*!
+ \brief Computes the "fast" hash time of a directory tree.
+
+ Every directory in the tree is stat()ed, and the sum of their modification times (or creation
+ times, if no modification time is available) is the hash time. Directories of one tree level are
+ processed in parallel on a bounded number of threads.
+
+ If directory states from a previous walk are given, a directory whose modification time did not
+ change is not listed again, its sub directories are taken from the known state instead. This is
+ safe as adding, removing or renaming an entry updates the modification time of its parent.
+
+ An entry added right after a directory was listed, within the granularity of its modification
+ time, doesn't necessarily change that time. A listing is therefore only trusted once a later walk
+ finds the same modification time and lists the directory again: as the time didn't change since
+ the first listing, the second one holds every entry of that time. This compares the times of the
+ file system with each other only, so it doesn't depend on the clock of a remote server being in
+ sync with the local one.
+ */
+class CRecursiveFastHash
+{
+public:
+  /*!
+   \param maxThreads maximum number of directories processed at the same time
+   \param knownStates directory states of a previous walk, nullptr to list every directory
+   */
+  CRecursiveFastHash(unsigned int maxThreads, const DirectoryStates* knownStates);
+
+  /*!
+   \brief Walk the given directory tree.
+   \param directory the root of the tree
+   \return the sum of the modification times, 0 if any directory has none or could not be stat()ed
+   */
+  int64_t Walk(const std::string& directory);
+
+  /*!
+   \brief The states of all directories visited by the last walk.
+   */
+  const DirectoryStates& GetStates() const { return m_states; }
+
+  /*!
+   \brief Whether the tree differs from the known states, i.e. any directory had to be listed or
+   a known directory was not visited anymore.
+   */
+  bool IsChanged() const { return m_changed; }
+
+  /*!
+   \brief Number of directories that had to be listed during the last walk.
+   */
+  size_t GetListedCount() const { return m_listed; }
+
+private:
+  struct VisitResult
+  {
+    int64_t mtime{0};
+    const std::vector<std::string>* knownSubDirs{nullptr};
+    std::vector<std::string> subDirs;
+    bool listed{false};
+    bool trusted{false};
+  };
+
+  VisitResult Visit(const std::string& directory) const;
+
+  const unsigned int m_maxThreads;
+  const DirectoryStates* m_knownStates;
+  DirectoryStates m_states;
+  bool m_changed{false};
+  size_t m_listed{0};
+};
+
+} // namespace KODI::VIDEO
@@ -224,6 +224,10 @@ void CVideoDatabase::CreateTables()
   CLog::Log(LOGINFO, "create videoversion table");
   m_pDS->exec("CREATE TABLE videoversion (idFile INTEGER PRIMARY KEY, idMedia INTEGER, media_type "
               "TEXT, itemType INTEGER, idType INTEGER)");
+
+  CLog::Log(LOGINFO, "create pathstat table");
+  m_pDS->exec("CREATE TABLE pathstat (strRootPath TEXT, strPath TEXT, mtime INTEGER, "
+              "strSubDirs TEXT)");
 }
 
 void CVideoDatabase::CreateLinkIndex(const char *table)
@@ -260,6 +264,7 @@ void CVideoDatabase::CreateAnalytics()
   m_pDS->exec("CREATE UNIQUE INDEX ix_stacktimes ON stacktimes ( idFile )\n");
   m_pDS->exec("CREATE INDEX ix_path ON path ( strPath(255) )");
   m_pDS->exec("CREATE INDEX ix_path2 ON path ( idParentPath )");
+  m_pDS->exec("CREATE INDEX ix_pathstat ON pathstat ( strRootPath(255) )");
   m_pDS->exec("CREATE INDEX ix_files ON files ( idPath, strFilename(255) )");
 
   m_pDS->exec("CREATE UNIQUE INDEX ix_movie_file_1 ON movie (idFile, idMovie)");
@@ -1167,6 +1172,71 @@ bool CVideoDatabase::SetPathHash(const std::string &path, const std::string &has
   return false;
 }
 
+bool CVideoDatabase::GetDirectoryStates(const std::string& rootPath,
+                                        KODI::VIDEO::DirectoryStates& states)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    m_pDS->query(PrepareSQL("SELECT strPath, mtime, strSubDirs FROM pathstat WHERE strRootPath='%s'",
+                            rootPath.c_str()));
+    while (!m_pDS->eof())
+    {
+      // listings that are not trusted yet are stored with a negated time
+      KODI::VIDEO::DirectoryState& state = states[m_pDS->fv(0).get_asString()];
+      const int64_t mtime = m_pDS->fv(1).get_asInt64();
+      state.mtime = mtime < 0 ? -mtime : mtime;
+      state.trusted = mtime > 0;
+      const std::string subDirs = m_pDS->fv(2).get_asString();
+      if (!subDirs.empty())
+        state.subDirs = StringUtils::Split(subDirs, "\n");
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", CURL::GetRedacted(rootPath));
+  }
+  return false;
+}
+
+bool CVideoDatabase::SetDirectoryStates(const std::string& rootPath,
+                                        const KODI::VIDEO::DirectoryStates& states)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    BeginTransaction();
+    m_pDS->exec(PrepareSQL("DELETE FROM pathstat WHERE strRootPath='%s'", rootPath.c_str()));
+    for (const auto& [path, state] : states)
+    {
+      m_pDS->exec(PrepareSQL("INSERT INTO pathstat (strRootPath, strPath, mtime, strSubDirs) "
+                             "VALUES ('%s', '%s', %lld, '%s')",
+                             rootPath.c_str(), path.c_str(),
+                             static_cast<long long>(state.trusted ? state.mtime : -state.mtime),
+                             StringUtils::Join(state.subDirs, "\n").c_str()));
+    }
+    CommitTransaction();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", CURL::GetRedacted(rootPath));
+    RollbackTransaction();
+  }
+  return false;
+}
+
 bool CVideoDatabase::LinkMovieToTvshow(int idMovie, int idShow, bool bRemove)
 {
    try
@@ -2007,8 +2077,10 @@ void CVideoDatabase::AddLinkToActor(int mediaId, const char *mediaType, int acto
 
   if (GetSingleValue(sql).empty())
   { // doesn't exists, add it
-    sql = PrepareSQL("INSERT INTO actor_link (actor_id, media_id, media_type, role, cast_order) VALUES(%i,%i,'%s','%s',%i)", actorId, mediaId, mediaType, role.c_str(), order);
-    ExecuteQuery(sql);
+    ExecuteStatement("INSERT INTO actor_link (actor_id, media_id, media_type, role, cast_order) "
+                     "VALUES(?,?,?,?,?)",
+                     {CVariant{actorId}, CVariant{mediaId}, CVariant{mediaType}, CVariant{role},
+                      CVariant{order}});
   }
 }
 
@@ -2019,8 +2091,9 @@ void CVideoDatabase::AddToLinkTable(int mediaId, const std::string& mediaType, c
 
   if (GetSingleValue(sql).empty())
   { // doesn't exists, add it
-    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(%i,%i,'%s')", table.c_str(), key, valueId, mediaId, mediaType.c_str());
-    ExecuteQuery(sql);
+    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(?,?,?)", table.c_str(),
+                     key);
+    ExecuteStatement(sql, {CVariant{valueId}, CVariant{mediaId}, CVariant{mediaType}});
   }
 }
 
@@ -2750,12 +2823,9 @@ int CVideoDatabase::SetDetailsForMovie(CVideoInfoTag& details,
                                        int idMovie /* = -1 */)
 {
   const auto filePath = details.GetPath();
-  const bool inTransaction{m_pDB->in_transaction()};
-
   try
   {
-    if (!inTransaction)
-      BeginTransaction();
+    BeginTransaction();
 
     if (idMovie < 0)
       idMovie = GetMovieId(filePath);
@@ -2766,8 +2836,7 @@ int CVideoDatabase::SetDetailsForMovie(CVideoInfoTag& details,
       idMovie = AddNewMovie(details);
       if (idMovie < 0)
       {
-        if (!inTransaction)
-          RollbackTransaction();
+        RollbackTransaction();
         return idMovie;
       }
     }
@@ -2805,8 +2874,7 @@ int CVideoDatabase::SetDetailsForMovie(CVideoInfoTag& details,
           if (StringUtils::StartsWith(type, "set.") &&
               !SetArtForItem(idSet, MediaTypeVideoCollection, type.substr(4), url))
           {
-            if (!inTransaction)
-              RollbackTransaction();
+            RollbackTransaction();
             return -1;
           }
         }
@@ -2816,15 +2884,13 @@ int CVideoDatabase::SetDetailsForMovie(CVideoInfoTag& details,
     if (details.HasStreamDetails() &&
         !SetStreamDetailsForFileId(details.m_streamDetails, GetAndFillFileId(details)))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return -1;
     }
 
     if (!SetArtForItem(idMovie, MediaTypeMovie, artwork))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return -1;
     }
 
@@ -2853,8 +2919,7 @@ int CVideoDatabase::SetDetailsForMovie(CVideoInfoTag& details,
     sql += PrepareSQL(" where idMovie=%i", idMovie);
     m_pDS->exec(sql);
 
-    if (!inTransaction)
-      CommitTransaction();
+    CommitTransaction();
 
     return idMovie;
   }
@@ -2862,8 +2927,7 @@ int CVideoDatabase::SetDetailsForMovie(CVideoInfoTag& details,
   {
     CLog::LogF(LOGERROR, "({}) failed", filePath);
   }
-  if (!inTransaction)
-    RollbackTransaction();
+  RollbackTransaction();
   return -1;
 }
 
@@ -2973,28 +3037,23 @@ int CVideoDatabase::SetDetailsForMovieSet(const CVideoInfoTag& details,
   if (details.m_strTitle.empty())
     return -1;
 
-  const bool inTransaction{m_pDB->in_transaction()};
-
   try
   {
-    if (!inTransaction)
-      BeginTransaction();
+    BeginTransaction();
 
     if (idSet < 0)
     {
       idSet = AddSet(details.m_strTitle, details.m_strPlot);
       if (idSet < 0)
       {
-        if (!inTransaction)
-          RollbackTransaction();
+        RollbackTransaction();
         return -1;
       }
     }
 
     if (!SetArtForItem(idSet, MediaTypeVideoCollection, artwork))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return -1;
     }
 
@@ -3002,8 +3061,7 @@ int CVideoDatabase::SetDetailsForMovieSet(const CVideoInfoTag& details,
     std::string sql = PrepareSQL("UPDATE sets SET strSet='%s', strOverview='%s' WHERE idSet=%i", details.m_strTitle.c_str(), details.m_strPlot.c_str(), idSet);
     m_pDS->exec(sql);
 
-    if (!inTransaction)
-      CommitTransaction();
+    CommitTransaction();
 
     return idSet;
   }
@@ -3011,8 +3069,7 @@ int CVideoDatabase::SetDetailsForMovieSet(const CVideoInfoTag& details,
   {
     CLog::LogF(LOGERROR, "({}) failed", idSet);
   }
-  if (!inTransaction)
-    RollbackTransaction();
+  RollbackTransaction();
   return -1;
 }
 
@@ -3056,6 +3113,8 @@ int CVideoDatabase::SetDetailsForTvShow(const std::vector<std::string>& paths,
    5. Add details for the show.
    */
 
+  BeginTransaction();
+
   if (idTvShow < 0)
   {
     for (const auto& path : paths)
@@ -3071,15 +3130,23 @@ int CVideoDatabase::SetDetailsForTvShow(const std::vector<std::string>& paths,
   {
     idTvShow = AddTvShow();
     if (idTvShow < 0)
+    {
+      RollbackTransaction();
       return -1;
+    }
   }
 
   // add any paths to the tvshow
   for (const auto& path : paths)
     AddPathToTvShow(idTvShow, path, details.m_dateAdded);
 
-  UpdateDetailsForTvShow(idTvShow, details, artwork, seasonArt);
+  if (!UpdateDetailsForTvShow(idTvShow, details, artwork, seasonArt))
+  {
+    RollbackTransaction();
+    return -1;
+  }
 
+  CommitTransaction();
   return idTvShow;
 }
 
@@ -3088,10 +3155,7 @@ bool CVideoDatabase::UpdateDetailsForTvShow(int idTvShow,
                                             const KODI::ART::Artwork& artwork,
                                             const KODI::ART::SeasonsArtwork& seasonArt)
 {
-  const bool inTransaction{m_pDB->in_transaction()};
-
-  if (!inTransaction)
-    BeginTransaction();
+  BeginTransaction();
 
   DeleteDetailsForTvShow(idTvShow);
 
@@ -3110,8 +3174,7 @@ bool CVideoDatabase::UpdateDetailsForTvShow(int idTvShow,
   // add "all seasons" - the rest are added in SetDetailsForEpisode
   if (AddSeason(idTvShow, -1) == -1)
   {
-    if (!inTransaction)
-      RollbackTransaction();
+    RollbackTransaction();
     return false;
   }
 
@@ -3123,8 +3186,7 @@ bool CVideoDatabase::UpdateDetailsForTvShow(int idTvShow,
         AddSeason(idTvShow, seasonNumber, seasonDetails.m_name, seasonDetails.m_plot);
     if (seasonId == -1)
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return false;
     }
 
@@ -3139,16 +3201,14 @@ bool CVideoDatabase::UpdateDetailsForTvShow(int idTvShow,
 
     if (SetDetailsForSeason(season, KODI::ART::Artwork(), idTvShow, seasonId) == -1)
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return false;
     }
   }
 
   if (!SetArtForItem(idTvShow, MediaTypeTvShow, artwork))
   {
-    if (!inTransaction)
-      RollbackTransaction();
+    RollbackTransaction();
     return false;
   }
 
@@ -3157,8 +3217,7 @@ bool CVideoDatabase::UpdateDetailsForTvShow(int idTvShow,
     int idSeason = AddSeason(idTvShow, seasonNumber);
     if (idSeason > -1 && !SetArtForItem(idSeason, MediaTypeSeason, art))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return false;
     }
   }
@@ -3189,12 +3248,10 @@ bool CVideoDatabase::UpdateDetailsForTvShow(int idTvShow,
   sql += PrepareSQL(" WHERE idShow=%i", idTvShow);
   if (ExecuteQuery(sql))
   {
-    if (!inTransaction)
-      CommitTransaction();
+    CommitTransaction();
     return true;
   }
-  if (!inTransaction)
-    RollbackTransaction();
+  RollbackTransaction();
   return false;
 }
 
@@ -3206,28 +3263,23 @@ int CVideoDatabase::SetDetailsForSeason(const CVideoInfoTag& details,
   if (idShow < 0 || details.m_iSeason < -1)
     return -1;
 
-  const bool inTransaction{m_pDB->in_transaction()};
-
   try
   {
-    if (!inTransaction)
-      BeginTransaction();
+    BeginTransaction();
 
     if (idSeason < 0)
     {
       idSeason = AddSeason(idShow, details.m_iSeason);
       if (idSeason < 0)
       {
-        if (!inTransaction)
-          RollbackTransaction();
+        RollbackTransaction();
         return -1;
       }
     }
 
     if (!SetArtForItem(idSeason, MediaTypeSeason, artwork))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return -1;
     }
 
@@ -3248,8 +3300,7 @@ int CVideoDatabase::SetDetailsForSeason(const CVideoInfoTag& details,
     sql += PrepareSQL(" WHERE idSeason = %i", idSeason);
     m_pDS->exec(sql);
 
-    if (!inTransaction)
-      CommitTransaction();
+    CommitTransaction();
 
     return idSeason;
   }
@@ -3257,8 +3308,7 @@ int CVideoDatabase::SetDetailsForSeason(const CVideoInfoTag& details,
   {
     CLog::LogF(LOGERROR, "({}) failed", idSeason);
   }
-  if (!inTransaction)
-    RollbackTransaction();
+  RollbackTransaction();
   return -1;
 }
 
@@ -3431,12 +3481,9 @@ int CVideoDatabase::SetDetailsForEpisode(CVideoInfoTag& details,
                                          int idEpisode /* = -1 */)
 {
   const auto filePath = details.GetPath();
-  const bool inTransaction{m_pDB->in_transaction()};
-
   try
   {
-    if (!inTransaction)
-      BeginTransaction();
+    BeginTransaction();
 
     if (idEpisode < 0)
       idEpisode = GetEpisodeId(filePath);
@@ -3451,8 +3498,7 @@ int CVideoDatabase::SetDetailsForEpisode(CVideoInfoTag& details,
       idEpisode = AddNewEpisode(idShow, details);
       if (idEpisode < 0)
       {
-        if (!inTransaction)
-          RollbackTransaction();
+        RollbackTransaction();
         return -1;
       }
     }
@@ -3474,8 +3520,7 @@ int CVideoDatabase::SetDetailsForEpisode(CVideoInfoTag& details,
     if (details.HasStreamDetails() &&
         !SetStreamDetailsForFileId(details.m_streamDetails, GetAndFillFileId(details)))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return -1;
     }
 
@@ -3484,8 +3529,7 @@ int CVideoDatabase::SetDetailsForEpisode(CVideoInfoTag& details,
 
     if (!SetArtForItem(idEpisode, MediaTypeEpisode, artwork))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return -1;
     }
 
@@ -3499,8 +3543,7 @@ int CVideoDatabase::SetDetailsForEpisode(CVideoInfoTag& details,
     sql += PrepareSQL(" where idEpisode=%i", idEpisode);
     m_pDS->exec(sql);
 
-    if (!inTransaction)
-      CommitTransaction();
+    CommitTransaction();
 
     return idEpisode;
   }
@@ -3508,8 +3551,7 @@ int CVideoDatabase::SetDetailsForEpisode(CVideoInfoTag& details,
   {
     CLog::LogF(LOGERROR, "({}) failed", filePath);
   }
-  if (!inTransaction)
-    RollbackTransaction();
+  RollbackTransaction();
   return -1;
 }
 
@@ -3541,12 +3583,9 @@ int CVideoDatabase::SetDetailsForMusicVideo(CVideoInfoTag& details,
                                             int idMVideo /* = -1 */)
 {
   const auto filePath = details.GetPath();
-  const bool inTransaction{m_pDB->in_transaction()};
-
   try
   {
-    if (!inTransaction)
-      BeginTransaction();
+    BeginTransaction();
 
     if (idMVideo < 0)
       idMVideo = GetMusicVideoId(filePath);
@@ -3561,8 +3600,7 @@ int CVideoDatabase::SetDetailsForMusicVideo(CVideoInfoTag& details,
       idMVideo = AddNewMusicVideo(details);
       if (idMVideo < 0)
       {
-        if (!inTransaction)
-          RollbackTransaction();
+        RollbackTransaction();
         return -1;
       }
     }
@@ -3584,15 +3622,13 @@ int CVideoDatabase::SetDetailsForMusicVideo(CVideoInfoTag& details,
     if (details.HasStreamDetails() &&
         !SetStreamDetailsForFileId(details.m_streamDetails, GetAndFillFileId(details)))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return -1;
     }
 
     if (!SetArtForItem(idMVideo, MediaTypeMusicVideo, artwork))
     {
-      if (!inTransaction)
-        RollbackTransaction();
+      RollbackTransaction();
       return -1;
     }
 
@@ -3610,8 +3646,7 @@ int CVideoDatabase::SetDetailsForMusicVideo(CVideoInfoTag& details,
     sql += PrepareSQL(" where idMVideo=%i", idMVideo);
     m_pDS->exec(sql);
 
-    if (!inTransaction)
-      CommitTransaction();
+    CommitTransaction();
 
     return idMVideo;
   }
@@ -3619,8 +3654,7 @@ int CVideoDatabase::SetDetailsForMusicVideo(CVideoInfoTag& details,
   {
     CLog::LogF(LOGERROR, "({}) failed", filePath);
   }
-  if (!inTransaction)
-    RollbackTransaction();
+  RollbackTransaction();
   return -1;
 }
 
@@ -3645,32 +3679,38 @@ bool CVideoDatabase::SetStreamDetailsForFileId(const CStreamDetails& details, in
 
     for (int i=1; i<=details.GetVideoStreamCount(); i++)
     {
-      m_pDS->exec(PrepareSQL(
-          "INSERT INTO streamdetails "
-          "(idFile, iStreamType, strVideoCodec, fVideoAspect, iVideoWidth, iVideoHeight, "
-          "iVideoDuration, strStereoMode, strVideoLanguage, strHdrType) "
-          "VALUES (%i,%i,'%s',%f,%i,%i,%i,'%s','%s','%s')",
-          idFile, static_cast<int>(CStreamDetail::VIDEO), details.GetVideoCodec(i).c_str(),
-          static_cast<double>(details.GetVideoAspect(i)), details.GetVideoWidth(i),
-          details.GetVideoHeight(i), details.GetVideoDuration(i), details.GetStereoMode(i).c_str(),
-          details.GetVideoLanguage(i).c_str(), details.GetVideoHdrType(i).c_str()));
+      if (!ExecuteStatement(
+              "INSERT INTO streamdetails "
+              "(idFile, iStreamType, strVideoCodec, fVideoAspect, iVideoWidth, iVideoHeight, "
+              "iVideoDuration, strStereoMode, strVideoLanguage, strHdrType) "
+              "VALUES (?,?,?,?,?,?,?,?,?,?)",
+              {CVariant{idFile}, CVariant{static_cast<int>(CStreamDetail::VIDEO)},
+               CVariant{details.GetVideoCodec(i)},
+               CVariant{static_cast<double>(details.GetVideoAspect(i))},
+               CVariant{details.GetVideoWidth(i)}, CVariant{details.GetVideoHeight(i)},
+               CVariant{details.GetVideoDuration(i)}, CVariant{details.GetStereoMode(i)},
+               CVariant{details.GetVideoLanguage(i)}, CVariant{details.GetVideoHdrType(i)}}))
+        return false;
     }
     for (int i=1; i<=details.GetAudioStreamCount(); i++)
     {
-      m_pDS->exec(PrepareSQL(
-          "INSERT INTO streamdetails "
-          "(idFile, iStreamType, strAudioCodec, iAudioChannels, strAudioLanguage) "
-          "VALUES (%i,%i,'%s',%i,'%s')",
-          idFile, static_cast<int>(CStreamDetail::AUDIO), details.GetAudioCodec(i).c_str(),
-          details.GetAudioChannels(i), details.GetAudioLanguage(i).c_str()));
+      if (!ExecuteStatement(
+              "INSERT INTO streamdetails "
+              "(idFile, iStreamType, strAudioCodec, iAudioChannels, strAudioLanguage) "
+              "VALUES (?,?,?,?,?)",
+              {CVariant{idFile}, CVariant{static_cast<int>(CStreamDetail::AUDIO)},
+               CVariant{details.GetAudioCodec(i)}, CVariant{details.GetAudioChannels(i)},
+               CVariant{details.GetAudioLanguage(i)}}))
+        return false;
     }
     for (int i=1; i<=details.GetSubtitleStreamCount(); i++)
     {
-      m_pDS->exec(PrepareSQL("INSERT INTO streamdetails "
-                             "(idFile, iStreamType, strSubtitleLanguage) "
-                             "VALUES (%i,%i,'%s')",
-                             idFile, static_cast<int>(CStreamDetail::SUBTITLE),
-                             details.GetSubtitleLanguage(i).c_str()));
+      if (!ExecuteStatement("INSERT INTO streamdetails "
+                            "(idFile, iStreamType, strSubtitleLanguage) "
+                            "VALUES (?,?,?)",
+                            {CVariant{idFile}, CVariant{static_cast<int>(CStreamDetail::SUBTITLE)},
+                             CVariant{details.GetSubtitleLanguage(i)}}))
+        return false;
     }
 
     // update the runtime information, if empty
@@ -4240,12 +4280,9 @@ bool CVideoDatabase::DeleteMovie(int idMovie,
   if (nullptr == m_pDS)
     return false;
 
-  const bool inTransaction{m_pDB->in_transaction()};
-
   try
   {
-    if (!inTransaction)
-      BeginTransaction();
+    BeginTransaction();
 
     const int idFile{GetDbId(PrepareSQL("SELECT idFile FROM movie WHERE idMovie=%i", idMovie))};
     if (ca != DeleteMovieCascadeAction::ALL_ASSETS_NOT_STREAMDETAILS)
@@ -4279,8 +4316,7 @@ bool CVideoDatabase::DeleteMovie(int idMovie,
       {
         if (!DeleteVideoAsset(pDS->fv(0).get_asInt()))
         {
-          if (!inTransaction)
-            RollbackTransaction();
+          RollbackTransaction();
           pDS->close();
           return false;
         }
@@ -4292,16 +4328,14 @@ bool CVideoDatabase::DeleteMovie(int idMovie,
     //! @todo move this below CommitTransaction() once UPnP doesn't rely on this anymore
     AnnounceRemove(MediaTypeMovie, idMovie);
 
-    if (!inTransaction)
-      CommitTransaction();
+    CommitTransaction();
 
     return true;
   }
   catch (...)
   {
     CLog::LogF(LOGERROR, "failed");
-    if (!inTransaction)
-      RollbackTransaction();
+    RollbackTransaction();
   }
   return false;
 }
@@ -5669,15 +5703,16 @@ bool CVideoDatabase::SetArtForItem(int mediaId,
       m_pDS->close();
       if (oldUrl != url)
       {
-        sql = PrepareSQL("UPDATE art SET url='%s' where art_id=%d", url.c_str(), artId);
-        m_pDS->exec(sql);
+        return ExecuteStatement("UPDATE art SET url=? where art_id=?",
+                                {CVariant{url}, CVariant{artId}});
       }
     }
     else
     { // insert
       m_pDS->close();
-      sql = PrepareSQL("INSERT INTO art(media_id, media_type, type, url) VALUES (%d, '%s', '%s', '%s')", mediaId, mediaType.c_str(), artType.c_str(), url.c_str());
-      m_pDS->exec(sql);
+      return ExecuteStatement("INSERT INTO art(media_id, media_type, type, url) VALUES (?,?,?,?)",
+                              {CVariant{mediaId}, CVariant{mediaType}, CVariant{artType},
+                               CVariant{url}});
     }
     return true;
   }
@@ -10422,6 +10457,11 @@ void CVideoDatabase::CleanDatabase(CGUIDialogProgressBarHandle* handle,
           VIDEODB_ID_MUSICVIDEO_PARENTPATHID);
       m_pDS->exec(sql);
 
+      CLog::LogFC(LOGDEBUG, LOGDATABASE, "Cleaning pathstat table");
+      sql = "DELETE FROM pathstat "
+            "WHERE NOT EXISTS (SELECT 1 FROM path WHERE path.strPath = pathstat.strRootPath)";
+      m_pDS->exec(sql);
+
       CLog::LogFC(LOGDEBUG, LOGDATABASE, "Cleaning genre table");
       sql =
           "DELETE FROM genre "
@@ -11794,8 +11834,18 @@ void CVideoDatabase::InvalidatePathHash(const std::string& strPath)
 bool CVideoDatabase::CommitTransaction()
 {
   if (CDatabase::CommitTransaction())
-  { // number of items in the db has likely changed, so recalculate
-    GUIINFO::CLibraryGUIInfo& guiInfo = CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider();
+  {
+    // a nested commit only releases a savepoint, wait for the outermost one
+    if (InTransaction())
+      return true;
+
+    // number of items in the db has likely changed, so recalculate
+    CGUIComponent* gui = CServiceBroker::GetGUI();
+    if (!gui)
+      return true;
+
+    GUIINFO::CLibraryGUIInfo& guiInfo =
+        gui->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider();
     guiInfo.SetLibraryBool(LIBRARY_HAS_MOVIES, HasContent(VideoDbContentType::MOVIES));
     guiInfo.SetLibraryBool(LIBRARY_HAS_TVSHOWS, HasContent(VideoDbContentType::TVSHOWS));
     guiInfo.SetLibraryBool(LIBRARY_HAS_MUSICVIDEOS, HasContent(VideoDbContentType::MUSICVIDEOS));
@@ -12867,12 +12917,9 @@ bool CVideoDatabase::DeleteVideoAsset(int idFile)
   if (IsDefaultVideoVersion(idFile))
     return false;
 
-  const bool inTransaction{m_pDB->in_transaction()};
-
   try
   {
-    if (!inTransaction)
-      BeginTransaction();
+    BeginTransaction();
 
     const std::string path = GetSingleValue(PrepareSQL(
         "SELECT strPath FROM path JOIN files ON files.idPath=path.idPath WHERE files.idFile=%i",
@@ -12882,16 +12929,14 @@ bool CVideoDatabase::DeleteVideoAsset(int idFile)
 
     m_pDS->exec(PrepareSQL("DELETE FROM videoversion WHERE idFile=%i", idFile));
 
-    if (!inTransaction)
-      CommitTransaction();
+    CommitTransaction();
 
     return true;
   }
   catch (...)
   {
     CLog::LogF(LOGERROR, "failed for {}", idFile);
-    if (!inTransaction)
-      RollbackTransaction();
+    RollbackTransaction();
     return false;
   }
 }
@@ -12921,8 +12966,6 @@ bool CVideoDatabase::AddVideoAsset(VideoDbContentType itemType,
   if (!m_pDB || !m_pDS)
     return false;
 
-  assert(m_pDB->in_transaction() == false);
-
   if (itemType != VideoDbContentType::MOVIES)
     return false;
 
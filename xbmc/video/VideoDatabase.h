@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Bookmark.h"
+#include "RecursiveFastHash.h"
 #include "VideoInfoTag.h"
 #include "addons/Scraper.h"
 #include "dbwrappers/Database.h"
@@ -577,6 +578,21 @@ public:
   // scanning hashes and paths scanned
   bool SetPathHash(const std::string &path, const std::string &hash);
   bool GetPathHash(const std::string &path, std::string &hash);
+
+  /*! \brief Get the directory states stored by the last recursive fast hash of a path
+   \param rootPath the path the recursive fast hash was computed for
+   \param states [out] the states of the directories below (and including) rootPath
+   \return true on success, false on database error
+   */
+  bool GetDirectoryStates(const std::string& rootPath, KODI::VIDEO::DirectoryStates& states);
+
+  /*! \brief Replace the directory states stored for a path
+   \param rootPath the path the recursive fast hash was computed for
+   \param states the states of the directories below (and including) rootPath
+   \return true on success, false on database error
+   */
+  bool SetDirectoryStates(const std::string& rootPath,
+                          const KODI::VIDEO::DirectoryStates& states);
   bool GetPaths(std::set<std::string, std::less<>>& paths);
   bool GetPathsForTvShow(int idShow, std::set<int>& paths);
 
@@ -1053,9 +1053,15 @@ void CVideoDatabase::UpdateTables(int iVersion)
     }
     m_pDS->close();
   }
+
+  if (iVersion < 142)
+  {
+    m_pDS->exec("CREATE TABLE pathstat (strRootPath TEXT, strPath TEXT, mtime INTEGER, "
+                "strSubDirs TEXT)");
+  }
 }
 
 int CVideoDatabase::GetSchemaVersion() const
 {
-  return 141;
+  return 142;
 }
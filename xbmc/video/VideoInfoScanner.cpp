@@ -48,19 +48,24 @@
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
+#include "video/RecursiveFastHash.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
 #include "video/VideoManagerTypes.h"
+#include "video/VideoScanPipeline.h"
 #include "video/VideoThumbLoader.h"
 #include "video/VideoUtils.h"
 #include "video/dialogs/GUIDialogVideoManagerExtras.h"
 #include "video/dialogs/GUIDialogVideoManagerVersions.h"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <ranges>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
@@ -88,6 +93,16 @@ constexpr int MAX_EPISODE_RANGE = 50;
 // Character following season/episode range must be one of these for range to be valid.
 constexpr std::string_view allowed{"-_.esx "};
 
+/**
+ * \brief Limits of the write batch used while retrieving info for a directory.
+ *
+ * The items of a directory are written in one transaction, but the batch is committed once
+ * it holds this many items or has been open this long, so other writers to the video
+ * database are not held off for the duration of a large directory's scrape.
+ */
+constexpr int MAX_BATCH_ITEMS = 100;
+constexpr auto MAX_BATCH_DURATION = std::chrono::seconds(2);
+
 /*! \brief Perform checks, then add episodes in a given range to the episode list
  \param first first episode in the range to add.
  \param last last episode in the range.
@@ -402,6 +417,21 @@ CVideoInfoScanner::~CVideoInfoScanner()
       m_database.Interrupt();
 
     m_bStop = true;
+
+    std::unique_lock lock(m_pipelineSection);
+    if (const auto pipeline = m_pipeline.lock())
+      pipeline->Cancel();
+  }
+
+  std::shared_ptr<CVideoScanPipeline> CVideoInfoScanner::CreatePipeline(unsigned int lookupThreads)
+  {
+    auto pipeline = std::make_shared<CVideoScanPipeline>(lookupThreads);
+
+    std::unique_lock lock(m_pipelineSection);
+    m_pipeline = pipeline;
+    if (m_bStop)
+      pipeline->Cancel();
+    return pipeline;
   }
 
   bool CVideoInfoScanner::DoScan(const std::string& strDirectory)
@@ -702,9 +732,25 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
     m_database.Open();
 
+    // batch the writes of all items, SetDetailsFor* nest into it with savepoints, so an item
+    // failing halfway only rolls back its own rows. The batch is committed before querying the
+    // scraper, see CommitBatch. Not done when interactive, as the
+    // user may be prompted for a choice while the batch is open, nor for tv shows, where a single
+    // item covers the lookup of all of its episodes. Those are batched by OnProcessSeriesFolder.
+    const bool batch = !pDlgProgress && items.Size() > 1 && content != ContentType::TVSHOWS;
+    auto batchStart = std::chrono::steady_clock::now();
+    int batchItems = 0;
+
     bool FoundSomeInfo = false;
     std::vector<int> seenPaths;
     seenPaths.reserve(items.Size());
+
+    // the scraper queries of the next items run while an item is added. Not done when
+    // interactive, as the user may be asked to pick a result, nor for a given url.
+    const unsigned int lookupThreads =
+        !pDlgProgress && !pURL ? m_advancedSettings->m_videoScannerLookupThreads : 1;
+    const std::shared_ptr<CVideoScanPipeline> pipeline = CreatePipeline(lookupThreads);
+
     for (int i = 0; i < items.Size(); ++i)
     {
       CFileItemPtr pItem = items[i];
@@ -726,69 +772,125 @@ CVideoInfoScanner::~CVideoInfoScanner()
                                          : m_advancedSettings->m_moviesExcludeFromScanRegExps))
         continue;
 
-      if (info2->Content() == ContentType::MOVIES || info2->Content() == ContentType::MUSICVIDEOS)
+      auto prefetched = std::make_shared<PrefetchedLookup>();
+      CVideoScanPipeline::Lookup lookup;
+      if (lookupThreads > 1 && NeedsLookup(*pItem, info2))
       {
-        if (m_handle)
-          m_handle->SetPercentage(i*100.f/items.Size());
+        lookup = [this, item = CFileItem(*pItem), info2, bDirNames, useLocal, prefetched]() mutable
+        { Prefetch(std::move(item), info2, bDirNames, useLocal, *prefetched); };
       }
-
-      InfoRet ret = InfoRet::CANCELLED;
-      if (info2->Content() == ContentType::TVSHOWS)
-        ret = RetrieveInfoForTvShow(pItem.get(), bDirNames, info2, useLocal, pURL, fetchEpisodes, pDlgProgress);
-      else if (info2->Content() == ContentType::MOVIES)
-        ret = RetrieveInfoForMovie(pItem.get(), bDirNames, info2, useLocal, pURL, pDlgProgress);
-      else if (info2->Content() == ContentType::MUSICVIDEOS)
-        ret = RetrieveInfoForMusicVideo(pItem.get(), bDirNames, info2, useLocal, pURL, pDlgProgress);
       else
+        lookup = [] {};
+
+      // lookups for the same show run one after another
+      const std::string key = content == ContentType::TVSHOWS
+                                  ? (pItem->IsFolder() ? pItem->GetPath()
+                                                       : URIUtils::GetDirectory(pItem->GetPath()))
+                                  : std::string{};
+
+      const auto write = [&, i, pItem, info2, prefetched]() mutable
       {
-        CLog::Log(LOGERROR, "VideoInfoScanner: Unknown content type {} ({})", info2->Content(),
-                  CURL::GetRedacted(pItem->GetPath()));
-        FoundSomeInfo = false;
-        break;
-      }
-      if (ret == InfoRet::CANCELLED || ret == InfoRet::INFO_ERROR)
-      {
-        CLog::Log(LOGWARNING,
-                  "VideoInfoScanner: Error {} occurred while retrieving"
-                  "information for {}.",
-                  static_cast<int>(ret), CURL::GetRedacted(pItem->GetPath()));
-        FoundSomeInfo = false;
-        break;
-      }
-      if (ret == InfoRet::ADDED || ret == InfoRet::HAVE_ALREADY)
-        FoundSomeInfo = true;
-      else if (ret == InfoRet::NOT_FOUND)
-      {
-        CLog::Log(LOGWARNING,
-                  "No information found for item '{}', it won't be added to the library.",
-                  CURL::GetRedacted(pItem->GetPath()));
+        if (m_batchOpen && (batchItems >= MAX_BATCH_ITEMS ||
+                            std::chrono::steady_clock::now() - batchStart >= MAX_BATCH_DURATION))
+          CommitBatch();
+        if (batch && !m_batchOpen)
+        {
+          m_database.BeginTransaction();
+          m_batchOpen = true;
+          batchStart = std::chrono::steady_clock::now();
+          batchItems = 0;
+        }
 
-        MediaType mediaType = MediaTypeMovie;
+        if (info2->Content() == ContentType::MOVIES || info2->Content() == ContentType::MUSICVIDEOS)
+        {
+          if (m_handle)
+            m_handle->SetPercentage(i * 100.f / items.Size());
+        }
+
+        m_prefetched = prefetched.get();
+        InfoRet ret = InfoRet::CANCELLED;
         if (info2->Content() == ContentType::TVSHOWS)
-          mediaType = MediaTypeTvShow;
+          ret = RetrieveInfoForTvShow(pItem.get(), bDirNames, info2, useLocal, pURL, fetchEpisodes,
+                                      pDlgProgress);
+        else if (info2->Content() == ContentType::MOVIES)
+          ret = RetrieveInfoForMovie(pItem.get(), bDirNames, info2, useLocal, pURL, pDlgProgress);
         else if (info2->Content() == ContentType::MUSICVIDEOS)
-          mediaType = MediaTypeMusicVideo;
+          ret = RetrieveInfoForMusicVideo(pItem.get(), bDirNames, info2, useLocal, pURL,
+                                          pDlgProgress);
+        else
+        {
+          m_prefetched = nullptr;
+          CLog::Log(LOGERROR, "VideoInfoScanner: Unknown content type {} ({})", info2->Content(),
+                    CURL::GetRedacted(pItem->GetPath()));
+          FoundSomeInfo = false;
+          return false;
+        }
+        m_prefetched = nullptr;
 
-        auto eventLog = CServiceBroker::GetEventLog();
-        if (eventLog)
+        if (ret == InfoRet::CANCELLED || ret == InfoRet::INFO_ERROR)
         {
-          const std::string itemlogpath = (info2->Content() == ContentType::TVSHOWS)
-                                              ? CURL::GetRedacted(pItem->GetPath())
-                                              : URIUtils::GetFileName(pItem->GetPath());
-
-          eventLog->Add(EventPtr(new CMediaLibraryEvent(
-              mediaType, pItem->GetPath(), 24145,
-              StringUtils::Format(g_localizeStrings.Get(24147), mediaType, itemlogpath),
-              EventLevel::Warning)));
+          CLog::Log(LOGWARNING,
+                    "VideoInfoScanner: Error {} occurred while retrieving"
+                    "information for {}.",
+                    static_cast<int>(ret), CURL::GetRedacted(pItem->GetPath()));
+          FoundSomeInfo = false;
+          return false;
         }
-      }
+        if (ret == InfoRet::ADDED || ret == InfoRet::HAVE_ALREADY)
+          FoundSomeInfo = true;
+        else if (ret == InfoRet::NOT_FOUND)
+        {
+          CLog::Log(LOGWARNING,
+                    "No information found for item '{}', it won't be added to the library.",
+                    CURL::GetRedacted(pItem->GetPath()));
+
+          MediaType mediaType = MediaTypeMovie;
+          if (info2->Content() == ContentType::TVSHOWS)
+            mediaType = MediaTypeTvShow;
+          else if (info2->Content() == ContentType::MUSICVIDEOS)
+            mediaType = MediaTypeMusicVideo;
 
-      pURL = NULL;
+          auto eventLog = CServiceBroker::GetEventLog();
+          if (eventLog)
+          {
+            const std::string itemlogpath = (info2->Content() == ContentType::TVSHOWS)
+                                                ? CURL::GetRedacted(pItem->GetPath())
+                                                : URIUtils::GetFileName(pItem->GetPath());
+
+            eventLog->Add(EventPtr(new CMediaLibraryEvent(
+                mediaType, pItem->GetPath(), 24145,
+                StringUtils::Format(g_localizeStrings.Get(24147), mediaType, itemlogpath),
+                EventLevel::Warning)));
+          }
+        }
 
-      // Keep track of directories we've seen
-      if (m_bClean && pItem->IsFolder())
-        seenPaths.push_back(m_database.GetPathId(pItem->GetPath()));
+        pURL = NULL;
+        ++batchItems;
+
+        // Keep track of directories we've seen
+        if (m_bClean && pItem->IsFolder())
+          seenPaths.push_back(m_database.GetPathId(pItem->GetPath()));
+        return true;
+      };
+
+      if (!pipeline->Add(key, std::move(lookup), write))
+        break;
     }
+    pipeline->Finish();
+
+    if (lookupThreads > 1)
+    {
+      const CVideoScanPipeline::Stats stats = pipeline->GetStats();
+      CLog::Log(LOGDEBUG,
+                "VideoInfoScanner: {} items written, {} lookups taking {} ms on {} threads, "
+                "waited {} ms for lookups",
+                stats.writes, stats.lookups,
+                std::chrono::duration_cast<std::chrono::milliseconds>(stats.lookupTime).count(),
+                lookupThreads,
+                std::chrono::duration_cast<std::chrono::milliseconds>(stats.writeWait).count());
+    }
+
+    CommitBatch();
 
     if (content == ContentType::TVSHOWS && !seenPaths.empty())
     {
@@ -2120,6 +2222,88 @@ CVideoInfoScanner::~CVideoInfoScanner()
     return {InfoType::NONE, nullptr};
   }
 
+  bool CVideoInfoScanner::NeedsLookup(const CFileItem& item, const ScraperPtr& scraper)
+  {
+    // xml scrapers keep the state of a query in the scraper, so can't be queried concurrently
+    if (!scraper->IsPython())
+      return false;
+
+    switch (scraper->Content())
+    {
+      case ContentType::MOVIES:
+      case ContentType::MUSICVIDEOS:
+        if (item.IsFolder() || !IsVideo(item) || item.IsNFO() ||
+            (PLAYLIST::IsPlayList(item) && !URIUtils::HasExtension(item.GetPath(), ".strm")))
+          return false;
+        return scraper->Content() == ContentType::MOVIES
+                   ? !m_database.HasMovieInfo(item.GetDynPath())
+                   : !m_database.HasMusicVideoInfo(item.GetPath());
+      case ContentType::TVSHOWS:
+        // only new shows, the episodes of a show are looked up while adding it
+        if (!item.IsFolder() ||
+            (item.HasVideoInfoTag() && item.GetVideoInfoTag()->m_type == MediaTypeSeason))
+          return false;
+        return m_database.GetTvShowId(item.GetPath()) < 0;
+      default:
+        return false;
+    }
+  }
+
+  void CVideoInfoScanner::Prefetch(CFileItem item,
+                                   const ScraperPtr& scraper,
+                                   bool bDirNames,
+                                   bool useLocal,
+                                   PrefetchedLookup& lookup)
+  {
+    // the lookups of a stopped scan are dropped, so there's no point in querying the scraper
+    if (m_bStop)
+      return;
+
+    // same as RetrieveInfoFor*(), where movies read the tag into a copy of the item
+    const CVideoInfoTag originalTag = *item.GetVideoInfoTag();
+    InfoType result = InfoType::NONE;
+    std::unique_ptr<IVideoInfoTagLoader> loader;
+    if (useLocal)
+      std::tie(result, loader) = ReadInfoTag(item, scraper, bDirNames, true);
+    if (result == InfoType::FULL)
+      return;
+
+    lookup.scraperId = scraper->ID();
+    lookup.title = item.GetMovieName(bDirNames);
+    if (result == InfoType::TITLE)
+    {
+      const CVideoInfoTag& tag =
+          scraper->Content() == ContentType::MOVIES ? originalTag : *item.GetVideoInfoTag();
+      lookup.title = tag.GetTitle();
+      lookup.year = tag.GetYear();
+    }
+
+    CVideoInfoDownloader imdb(scraper);
+    std::string identifierType;
+    std::string identifier;
+    if (CUtil::GetFilenameIdentifier(lookup.title, identifierType, identifier))
+    {
+      lookup.uniqueIDs = {{identifierType, identifier}};
+      lookup.foundByIds = imdb.GetDetails(lookup.uniqueIDs, {}, lookup.detailsByIds);
+      if (lookup.foundByIds || m_bStop)
+        return;
+    }
+
+    if ((result == InfoType::URL || result == InfoType::COMBINED) &&
+        loader->ScraperUrl().HasUrls())
+      lookup.url = loader->ScraperUrl();
+    else
+    {
+      MOVIELIST movielist;
+      if (imdb.FindMovie(lookup.title, lookup.year, movielist) <= 0 || movielist.empty() ||
+          m_bStop)
+        return;
+      lookup.foundBySearch = true;
+      lookup.url = movielist[0];
+    }
+    lookup.foundByUrl = imdb.GetDetails({}, lookup.url, lookup.detailsByUrl);
+  }
+
   std::string CVideoInfoScanner::GetMovieSetInfoFolder(const std::string& setTitle)
   {
     if (setTitle.empty())
@@ -2326,6 +2510,49 @@ CVideoInfoScanner::~CVideoInfoScanner()
     for (const auto& file : files)
       episodeMap[file.strPath]++;
 
+    // episodes are added in batches of one transaction each. Scraped episodes are held back until
+    // the batch is written, so it isn't open while querying the scraper. Not done when interactive.
+    struct PendingEpisode
+    {
+      CFileItem item;
+      bool isFolder;
+      bool useLocal;
+    };
+    std::vector<PendingEpisode> pending;
+    std::set<std::tuple<std::string, int, int>> pendingKeys;
+    const auto addPending = [&]()
+    {
+      if (pending.empty())
+        return true;
+
+      bool added = true;
+      m_database.BeginTransaction();
+      for (auto& episode : pending)
+      {
+        if (AddVideo(&episode.item, scraper, episode.isFolder, episode.useLocal, &showInfo, false,
+                     ContentType::TVSHOWS) < 0)
+        {
+          added = false;
+          break;
+        }
+      }
+      m_database.CommitTransaction();
+      pending.clear();
+      pendingKeys.clear();
+      return added;
+    };
+    const auto addEpisode = [&](CFileItem& item, bool isFolder, bool useLocalInfo,
+                                const EPISODELIST::const_iterator& file)
+    {
+      if (pDlgProgress)
+        return AddVideo(&item, scraper, isFolder, useLocalInfo, &showInfo, false,
+                        ContentType::TVSHOWS) >= 0;
+
+      pending.push_back({std::move(item), isFolder, useLocalInfo});
+      pendingKeys.emplace(file->strPath, file->iEpisode, file->iSeason);
+      return pending.size() < static_cast<size_t>(MAX_BATCH_ITEMS) || addPending();
+    };
+
     int iMax = files.size();
     int iCurr = 1;
     for (EPISODELIST::iterator file = files.begin(); file != files.end(); ++file)
@@ -2344,9 +2571,13 @@ CVideoInfoScanner::~CVideoInfoScanner()
         m_handle->SetPercentage(100.f*iCurr++/iMax);
 
       if ((pDlgProgress && pDlgProgress->IsCanceled()) || m_bStop)
+      {
+        addPending();
         return InfoRet::CANCELLED;
+      }
 
-      if (m_database.GetEpisodeId(file->strPath, file->iEpisode, file->iSeason) > -1)
+      if (pendingKeys.contains({file->strPath, file->iEpisode, file->iSeason}) ||
+          m_database.GetEpisodeId(file->strPath, file->iEpisode, file->iSeason) > -1)
       {
         if (m_handle)
           m_handle->SetText(g_localizeStrings.Get(20415));
@@ -2382,7 +2613,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
           if (episodeMap[file->strPath] > 1)
             item.SetProperty(MULTIPLE_EPISODES, true);
         }
-        if (AddVideo(&item, info, file->isFolder, true, &showInfo, false, ContentType::TVSHOWS) < 0)
+        if (!addEpisode(item, file->isFolder, true, file))
           return InfoRet::INFO_ERROR;
         continue;
       }
@@ -2403,7 +2634,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
           CVideoInfoDownloader imdb(scraper);
           if (!imdb.GetEpisodeList(url, episodes))
+          {
+            addPending();
             return InfoRet::NOT_FOUND;
+          }
 
           hasEpisodeGuide = true;
         }
@@ -2524,7 +2758,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
         scraperItem.SetPath(file->strPath);
         if (!imdb.GetEpisodeDetails(guide->cScraperUrl, *scraperItem.GetVideoInfoTag(),
                                     pDlgProgress))
+        {
+          addPending();
           return InfoRet::NOT_FOUND; //! @todo should we just skip to the next episode?
+        }
 
         if (result == InfoType::COMBINED || result == InfoType::OVERRIDE)
           scraperItem.GetVideoInfoTag()->Merge(*item.GetVideoInfoTag());
@@ -2535,8 +2772,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
         if (scraperItem.GetVideoInfoTag()->m_iEpisode == -1)
           scraperItem.GetVideoInfoTag()->m_iEpisode = guide->iEpisode;
 
-        if (AddVideo(&scraperItem, info, file->isFolder, useLocal, &showInfo, false,
-                     ContentType::TVSHOWS) < 0)
+        if (!addEpisode(scraperItem, file->isFolder, useLocal, file))
           return InfoRet::INFO_ERROR;
       }
       else
@@ -2548,7 +2784,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
             file->cDate.GetAsLocalizedDate(), file->strTitle);
       }
     }
-    return InfoRet::ADDED;
+    return addPending() ? InfoRet::ADDED : InfoRet::INFO_ERROR;
   }
 
   bool CVideoInfoScanner::GetDetails(CFileItem* pItem,
@@ -2563,8 +2799,26 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if (m_handle && !url.GetTitle().empty())
       m_handle->SetText(url.GetTitle());
 
-    CVideoInfoDownloader imdb(scraper);
-    bool ret = imdb.GetDetails(uniqueIDs, url, movieDetails, pDialog);
+    bool ret = false;
+    if (m_prefetched && m_prefetched->scraperId == scraper->ID() && !uniqueIDs.empty() &&
+        m_prefetched->foundByIds && m_prefetched->uniqueIDs == uniqueIDs)
+    {
+      movieDetails = m_prefetched->detailsByIds;
+      ret = true;
+    }
+    else if (m_prefetched && m_prefetched->scraperId == scraper->ID() && uniqueIDs.empty() &&
+             m_prefetched->foundByUrl && m_prefetched->url.GetId() == url.GetId() &&
+             m_prefetched->url.GetFirstThumbUrl() == url.GetFirstThumbUrl())
+    {
+      movieDetails = m_prefetched->detailsByUrl;
+      ret = true;
+    }
+    else
+    {
+      CommitBatch();
+      CVideoInfoDownloader imdb(scraper);
+      ret = imdb.GetDetails(uniqueIDs, url, movieDetails, pDialog);
+    }
 
     if (ret)
     {
@@ -2681,36 +2935,31 @@ CVideoInfoScanner::~CVideoInfoScanner()
   }
 
   std::string CVideoInfoScanner::GetRecursiveFastHash(const std::string &directory,
-      const std::vector<std::string> &excludes) const
+      const std::vector<std::string> &excludes)
   {
-    CFileItemList items;
-    items.Add(std::make_shared<CFileItem>(directory, true));
-    CUtil::GetRecursiveDirsListing(directory, items, DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO);
+    const bool incremental = m_advancedSettings->m_bVideoLibraryIncrementalFastHash;
+    DirectoryStates knownStates;
+    if (incremental)
+      m_database.GetDirectoryStates(directory, knownStates);
 
-    CDigest digest{CDigest::Type::MD5};
+    CRecursiveFastHash fastHash(m_advancedSettings->m_videoLibraryFastHashThreads,
+                                incremental ? &knownStates : nullptr);
+    const int64_t time = fastHash.Walk(directory);
 
-    if (!excludes.empty())
-      digest.Update(StringUtils::Join(excludes, "|"));
+    if (incremental && time && fastHash.IsChanged())
+      m_database.SetDirectoryStates(directory, fastHash.GetStates());
 
-    int64_t time = 0;
-    for (int i=0; i < items.Size(); ++i)
+    if (time)
     {
-      int64_t stat_time = 0;
-      struct __stat64 buffer;
-      if (XFILE::CFile::Stat(items[i]->GetPath(), &buffer) == 0)
-      {
-        //! @todo some filesystems may return the mtime/ctime inline, in which case this is
-        //! unnecessarily expensive. Consider supporting Stat() in our directory cache?
-        stat_time = buffer.st_mtime ? buffer.st_mtime : buffer.st_ctime;
-        time += stat_time;
-      }
+      CLog::Log(LOGDEBUG, "VideoInfoScanner: Fast hashed {} directories in '{}', {} listed",
+                fastHash.GetStates().size(), CURL::GetRedacted(directory),
+                fastHash.GetListedCount());
 
-      if (!stat_time)
-        return "";
-    }
+      CDigest digest{CDigest::Type::MD5};
+
+      if (!excludes.empty())
+        digest.Update(StringUtils::Join(excludes, "|"));
 
-    if (time)
-    {
       digest.Update((unsigned char *)&time, sizeof(time));
       return digest.Finalize();
     }
@@ -2867,6 +3116,15 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
   int CVideoInfoScanner::FindVideo(const std::string &title, int year, const ScraperPtr &scraper, CScraperUrl &url, CGUIDialogProgress *progress)
   {
+    // failed searches are repeated below, which may ask the user whether to carry on
+    if (m_prefetched && m_prefetched->foundBySearch && m_prefetched->scraperId == scraper->ID() &&
+        m_prefetched->title == title && m_prefetched->year == year)
+    {
+      url = m_prefetched->url;
+      return 1;
+    }
+
+    CommitBatch();
     MOVIELIST movielist;
     CVideoInfoDownloader imdb(scraper);
     int returncode = imdb.FindMovie(title, year, movielist, progress);
@@ -2883,6 +3141,15 @@ CVideoInfoScanner::~CVideoInfoScanner()
     return 0;    // didn't find anything
   }
 
+  void CVideoInfoScanner::CommitBatch()
+  {
+    if (m_batchOpen)
+    {
+      m_database.CommitTransaction();
+      m_batchOpen = false;
+    }
+  }
+
   bool CVideoInfoScanner::AddVideoExtras(CFileItemList& items,
                                          ContentType content,
                                          const std::string& path)
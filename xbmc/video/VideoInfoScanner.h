@@ -12,8 +12,11 @@
 #include "VideoDatabase.h"
 #include "addons/Scraper.h"
 #include "guilib/GUIListItem.h"
+#include "threads/CriticalSection.h"
 #include "utils/Artwork.h"
 
+#include <atomic>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -27,6 +30,7 @@ namespace KODI::VIDEO
 {
   class IVideoInfoTagLoader;
   class ISetInfoTagLoader;
+  class CVideoScanPipeline;
 
   typedef struct SScanSettings
   {
@@ -157,6 +161,12 @@ namespace KODI::VIDEO
     virtual void Process();
     bool DoScan(const std::string& strDirectory) override;
 
+    /*! \brief Create the pipeline looking up the items of a scan, Stop() cancels it while it
+     exists. Cancelled right away if the scan was stopped already.
+     \param lookupThreads maximum number of lookups running at the same time
+     */
+    std::shared_ptr<CVideoScanPipeline> CreatePipeline(unsigned int lookupThreads);
+
     InfoRet RetrieveInfoForTvShow(CFileItem* pItem,
                                   bool bDirNames,
                                   ADDON::ScraperPtr& scraper,
@@ -278,13 +288,16 @@ namespace KODI::VIDEO
      Performs a stat() on the directory, and uses modified time to create a "fast"
      hash of each folder. If no modified time is available, the create time is used,
      and if neither are available, an empty hash is returned.
+     Sub directories are stat()ed in parallel. With incremental fast hashing enabled, the
+     directory states are stored in the database, and directories whose modified time did not
+     change are not listed again.
      In case exclude from scan expressions are present, the string array will be appended
      to the md5 hash to ensure we're doing a re-scan whenever the user modifies those.
      \param directory folder to hash (recursively)
      \param excludes string array of exclude expressions
      \return the md5 hash of the folder
      */
-    std::string GetRecursiveFastHash(const std::string &directory, const std::vector<std::string> &excludes) const;
+    std::string GetRecursiveFastHash(const std::string &directory, const std::vector<std::string> &excludes);
 
     /*! \brief Decide whether a folder listing could use the "fast" hash
      Fast hashing can be done whenever the folder contains no scannable subfolders, as the
@@ -322,7 +335,43 @@ namespace KODI::VIDEO
     std::pair<InfoType, std::unique_ptr<IVideoInfoTagLoader>> ReadInfoTag(
         CFileItem& item, const ADDON::ScraperPtr& scraper, bool lookInFolder, bool resetTag);
 
-    bool m_bStop;
+    /*! \brief Results of the scraper queries for an item, fetched ahead of adding the item.
+     FindVideo() and GetDetails() use them instead of querying the scraper again when their
+     arguments match the ones the results were fetched for.
+     */
+    struct PrefetchedLookup
+    {
+      std::string scraperId;
+      std::string title;
+      int year{-1};
+      ADDON::CScraper::UniqueIDs uniqueIDs;
+      bool foundByIds{false};
+      CVideoInfoTag detailsByIds;
+      bool foundBySearch{false};
+      CScraperUrl url; ///< first search result or the url of the nfo file
+      bool foundByUrl{false};
+      CVideoInfoTag detailsByUrl;
+    };
+
+    /*! \brief Whether an item will be looked up online when retrieving its info
+     */
+    bool NeedsLookup(const CFileItem& item, const ADDON::ScraperPtr& scraper);
+
+    /*! \brief Query the scraper for an item the way RetrieveInfoFor*() will. Runs on a lookup
+     thread of the scan pipeline, so must not access the database.
+     */
+    void Prefetch(CFileItem item,
+                  const ADDON::ScraperPtr& scraper,
+                  bool bDirNames,
+                  bool useLocal,
+                  PrefetchedLookup& lookup);
+
+    /*! \brief Commit the transaction batching the writes of several items, if one is open.
+     Called before querying the scraper, so the database isn't locked during the lookup.
+     */
+    void CommitBatch();
+
+    std::atomic<bool> m_bStop; ///< also read by the lookup threads of the pipeline
     bool m_scanAll;
     bool m_ignoreVideoVersions{false};
     bool m_ignoreVideoExtras{false};
@@ -330,5 +379,9 @@ namespace KODI::VIDEO
     std::set<int> m_pathsToClean;
     std::shared_ptr<CAdvancedSettings> m_advancedSettings;
     CVideoDatabase::ScraperCache m_scraperCache;
+    const PrefetchedLookup* m_prefetched{nullptr}; ///< results for the item being added, if any
+    bool m_batchOpen{false}; ///< whether a transaction batching the writes of items is open
+    CCriticalSection m_pipelineSection;
+    std::weak_ptr<CVideoScanPipeline> m_pipeline; ///< pipeline of the running scan, if any
   };
   } // namespace KODI::VIDEO
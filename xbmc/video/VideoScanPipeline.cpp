@@ -0,0 +1,193 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoScanPipeline.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace KODI::VIDEO
+{
+namespace
+{
+// lookups running ahead of the writes per thread, bounds the memory held by looked up items
+constexpr size_t PENDING_PER_THREAD = 4;
+} // namespace
+
+CVideoScanPipeline::CVideoScanPipeline(unsigned int concurrency)
+  : m_concurrency(std::max(concurrency, 1u)),
+    m_maxPending(m_concurrency * PENDING_PER_THREAD)
+{
+}
+
+CVideoScanPipeline::~CVideoScanPipeline()
+{
+  Cancel();
+  for (auto& thread : m_threads)
+    thread.get();
+}
+
+bool CVideoScanPipeline::Add(const std::string& key, Lookup lookup, Write write)
+{
+  if (m_concurrency == 1)
+  {
+    Item item{key, std::move(lookup), std::move(write)};
+    {
+      std::unique_lock lock(m_section);
+      if (m_stopped)
+        return false;
+    }
+    RunLookup(item);
+
+    {
+      // the item is dropped if the scan was cancelled during its lookup
+      std::unique_lock lock(m_section);
+      if (m_stopped)
+        return false;
+    }
+    // like WriteUntil, the write runs unlocked so Cancel() doesn't wait for it
+    const bool proceed = item.write();
+
+    std::unique_lock lock(m_section);
+    m_stats.writes++;
+    if (!proceed)
+      m_stopped = true;
+    return !m_stopped;
+  }
+
+  {
+    std::unique_lock lock(m_section);
+    if (m_stopped)
+      return false;
+
+    if (m_threads.empty())
+    {
+      for (unsigned int i = 0; i < m_concurrency; i++)
+        m_threads.emplace_back(std::async(std::launch::async, [this] { Process(); }));
+    }
+
+    m_items.emplace_back(
+        std::make_shared<Item>(Item{key, std::move(lookup), std::move(write)}));
+    m_changed.notifyAll();
+  }
+  return WriteUntil(m_maxPending);
+}
+
+bool CVideoScanPipeline::Finish()
+{
+  return WriteUntil(0);
+}
+
+void CVideoScanPipeline::Cancel()
+{
+  std::unique_lock lock(m_section);
+  m_stopped = true;
+  // running lookups hold on to their items until they complete
+  m_items.clear();
+  m_changed.notifyAll();
+}
+
+CVideoScanPipeline::Stats CVideoScanPipeline::GetStats() const
+{
+  std::unique_lock lock(m_section);
+  return m_stats;
+}
+
+void CVideoScanPipeline::Process()
+{
+  std::unique_lock lock(m_section);
+  while (true)
+  {
+    std::shared_ptr<Item> item;
+    m_changed.wait(lock,
+                   [this, &item]
+                   {
+                     item = NextLookup();
+                     return item || m_stopped;
+                   });
+    if (!item)
+      return;
+
+    item->state = State::RUNNING;
+    if (!item->key.empty())
+      m_runningKeys.insert(item->key);
+
+    lock.unlock();
+    RunLookup(*item);
+    lock.lock();
+
+    item->state = State::DONE;
+    if (!item->key.empty())
+      m_runningKeys.erase(item->key);
+    m_changed.notifyAll();
+  }
+}
+
+std::shared_ptr<CVideoScanPipeline::Item> CVideoScanPipeline::NextLookup()
+{
+  if (m_stopped)
+    return {};
+
+  // the earliest lookup whose key isn't busy, so lookups of a key keep their order
+  const auto it = std::ranges::find_if(m_items,
+                                       [this](const std::shared_ptr<Item>& item)
+                                       {
+                                         return item->state == State::QUEUED &&
+                                                (item->key.empty() ||
+                                                 !m_runningKeys.contains(item->key));
+                                       });
+  return it != m_items.end() ? *it : nullptr;
+}
+
+void CVideoScanPipeline::RunLookup(Item& item)
+{
+  const auto start = std::chrono::steady_clock::now();
+  item.lookup();
+  const auto duration = std::chrono::steady_clock::now() - start;
+
+  std::unique_lock lock(m_section);
+  m_stats.lookups++;
+  m_stats.lookupTime += duration;
+}
+
+bool CVideoScanPipeline::WriteUntil(size_t pending)
+{
+  std::unique_lock lock(m_section);
+  while (!m_stopped && !m_items.empty())
+  {
+    if (m_items.front()->state != State::DONE)
+    {
+      if (m_items.size() <= pending)
+        break;
+
+      const auto start = std::chrono::steady_clock::now();
+      m_changed.wait(lock,
+                     [this] { return m_stopped || m_items.front()->state == State::DONE; });
+      m_stats.writeWait += std::chrono::steady_clock::now() - start;
+      continue;
+    }
+
+    const std::shared_ptr<Item> item = std::move(m_items.front());
+    m_items.pop_front();
+
+    lock.unlock();
+    const bool proceed = item->write();
+    lock.lock();
+
+    m_stats.writes++;
+    if (!proceed)
+    {
+      m_stopped = true;
+      m_items.clear();
+      m_changed.notifyAll();
+    }
+  }
+  return !m_stopped;
+}
+
+} // namespace KODI::VIDEO
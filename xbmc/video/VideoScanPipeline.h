@@ -0,0 +1,119 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace KODI::VIDEO
+{
+
+/*!
+ \brief Runs the lookups of a library scan concurrently while writing their results in order.
+
+ Every item of a scan has a lookup (querying the scraper, downloading) and a write (adding it to
+ the database). Lookups run on up to a given number of threads. Writes run one at a time on the
+ thread adding the items, in the order the items were added, so only that thread accesses the
+ database. Lookups sharing a key, e.g. the episodes of one show, run one after another in the
+ order they were added.
+
+ Lookups run at most a few items per thread ahead of the writes, adding an item writes the
+ oldest one first once that limit is reached. With a single thread, every item is looked up and
+ written when it is added, as if there was no pipeline.
+ */
+class CVideoScanPipeline
+{
+public:
+  using Lookup = std::function<void()>;
+  using Write = std::function<bool()>;
+
+  /*!
+   \param concurrency maximum number of lookups running at the same time
+   */
+  explicit CVideoScanPipeline(unsigned int concurrency);
+
+  /*!
+   \brief Cancels the lookups not started yet and waits for the running ones
+   */
+  ~CVideoScanPipeline();
+
+  /*!
+   \brief Add an item, writing the items added before whose lookups completed
+   \param key lookups with the same key run in the order they were added, empty if independent
+   \param lookup run on a lookup thread, must not access the database
+   \param write run on the calling thread after the lookup, returns false to stop the scan
+   \return false if the scan was stopped by a write or cancelled
+   */
+  bool Add(const std::string& key, Lookup lookup, Write write);
+
+  /*!
+   \brief Wait for the remaining lookups and write them
+   \return false if the scan was stopped by a write or cancelled
+   */
+  bool Finish();
+
+  /*!
+   \brief Stop the scan, items not written yet are dropped. May be called from any thread.
+   */
+  void Cancel();
+
+  struct Stats
+  {
+    unsigned int lookups{0};
+    unsigned int writes{0};
+    std::chrono::steady_clock::duration lookupTime{}; ///< time spent in lookups by all threads
+    std::chrono::steady_clock::duration writeWait{}; ///< time writes waited for their lookups
+  };
+
+  Stats GetStats() const;
+
+private:
+  enum class State
+  {
+    QUEUED,
+    RUNNING,
+    DONE
+  };
+
+  struct Item
+  {
+    std::string key;
+    Lookup lookup;
+    Write write;
+    State state{State::QUEUED};
+  };
+
+  void Process();
+  bool WriteUntil(size_t pending);
+  std::shared_ptr<Item> NextLookup();
+  void RunLookup(Item& item);
+
+  const unsigned int m_concurrency;
+  const size_t m_maxPending;
+
+  mutable CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_changed;
+  std::deque<std::shared_ptr<Item>> m_items; ///< items not written yet, in the order added
+  std::set<std::string, std::less<>> m_runningKeys;
+  bool m_stopped{false};
+  Stats m_stats;
+
+  std::vector<std::future<void>> m_threads;
+};
+
+} // namespace KODI::VIDEO
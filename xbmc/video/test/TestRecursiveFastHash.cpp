@@ -0,0 +1,215 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "Util.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/URIUtils.h"
+#include "video/RecursiveFastHash.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+
+namespace
+{
+std::string CreateTree(const std::string& name,
+                       int dirs,
+                       int subDirs,
+                       int files,
+                       std::chrono::hours age = std::chrono::hours(1))
+{
+  const std::string root =
+      URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"), name);
+  for (int d = 0; d < dirs; ++d)
+  {
+    for (int s = 0; s < subDirs; ++s)
+    {
+      const std::filesystem::path dir = std::filesystem::path(root) / ("show" + std::to_string(d)) /
+                                        ("season" + std::to_string(s));
+      std::filesystem::create_directories(dir);
+      for (int f = 0; f < files; ++f)
+        std::ofstream(dir / ("episode" + std::to_string(f) + ".mkv"));
+    }
+  }
+
+  // a negative age puts the tree in the future, as seen from a server whose clock is ahead
+  const auto aged = std::filesystem::file_time_type::clock::now() - age;
+  std::filesystem::last_write_time(root, aged);
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(root))
+  {
+    if (entry.is_directory())
+      std::filesystem::last_write_time(entry.path(), aged);
+  }
+  return URIUtils::AddFileToFolder(root, "");
+}
+
+// the recursive fast hash time as computed before parallel walking was introduced
+int64_t GetSerialHashTime(const std::string& directory)
+{
+  CFileItemList items;
+  items.Add(std::make_shared<CFileItem>(directory, true));
+  CUtil::GetRecursiveDirsListing(directory, items,
+                                 XFILE::DIR_FLAG_NO_FILE_DIRS | XFILE::DIR_FLAG_NO_FILE_INFO);
+
+  int64_t time = 0;
+  for (const auto& item : items)
+  {
+    struct __stat64 buffer;
+    if (XFILE::CFile::Stat(item->GetPath(), &buffer) != 0)
+      return 0;
+    time += buffer.st_mtime ? buffer.st_mtime : buffer.st_ctime;
+  }
+  return time;
+}
+
+// walks the tree twice, so the second walk confirms the listings of the first one
+DirectoryStates GetTrustedStates(const std::string& root)
+{
+  CRecursiveFastHash initial(4, nullptr);
+  initial.Walk(root);
+  const DirectoryStates states = initial.GetStates();
+
+  CRecursiveFastHash confirmed(4, &states);
+  confirmed.Walk(root);
+  return confirmed.GetStates();
+}
+} // namespace
+
+TEST(TestRecursiveFastHash, MatchesSerialHash)
+{
+  const std::string root = CreateTree("TestRecursiveFastHash", 10, 3, 2);
+
+  CRecursiveFastHash serial(1, nullptr);
+  CRecursiveFastHash parallel(4, nullptr);
+  const int64_t time = GetSerialHashTime(root);
+  EXPECT_NE(0, time);
+  EXPECT_EQ(time, serial.Walk(root));
+  EXPECT_EQ(time, parallel.Walk(root));
+  EXPECT_EQ(41u, parallel.GetStates().size());
+  EXPECT_EQ(41u, parallel.GetListedCount());
+
+  EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(root));
+}
+
+TEST(TestRecursiveFastHash, Incremental)
+{
+  const std::string root = CreateTree("TestRecursiveFastHash", 10, 3, 2);
+
+  const int64_t time = GetSerialHashTime(root);
+  const DirectoryStates states = GetTrustedStates(root);
+
+  // nothing changed, so nothing needs to be listed
+  CRecursiveFastHash unchanged(4, &states);
+  EXPECT_EQ(time, unchanged.Walk(root));
+  EXPECT_FALSE(unchanged.IsChanged());
+  EXPECT_EQ(0u, unchanged.GetListedCount());
+
+  // add a season, and make sure the show's modification time differs within the second
+  const std::filesystem::path show = std::filesystem::path(root) / "show0";
+  std::filesystem::create_directory(show / "season3");
+  std::filesystem::last_write_time(show, std::filesystem::last_write_time(show) +
+                                             std::chrono::seconds(10));
+
+  CRecursiveFastHash changed(4, &states);
+  EXPECT_NE(time, changed.Walk(root));
+  EXPECT_TRUE(changed.IsChanged());
+  EXPECT_EQ(2u, changed.GetListedCount());
+  EXPECT_EQ(42u, changed.GetStates().size());
+  EXPECT_EQ(GetSerialHashTime(root), changed.Walk(root));
+
+  EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(root));
+}
+
+TEST(TestRecursiveFastHash, NewDirectoryWithinModificationTime)
+{
+  const std::string root = CreateTree("TestRecursiveFastHash", 2, 1, 0);
+
+  // a season is added right after the show was listed, within the same modification time
+  const std::filesystem::path show = std::filesystem::path(root) / "show0";
+  std::filesystem::create_directory(show / "season1");
+  const auto modified = std::filesystem::last_write_time(show);
+
+  CRecursiveFastHash initial(4, nullptr);
+  const int64_t time = initial.Walk(root);
+  const DirectoryStates states = initial.GetStates();
+  std::filesystem::create_directory(show / "season2");
+  std::filesystem::last_write_time(show, modified);
+
+  // the show's time didn't change, but its listing isn't trusted yet
+  CRecursiveFastHash next(4, &states);
+  EXPECT_NE(time, next.Walk(root));
+  EXPECT_TRUE(next.IsChanged());
+  EXPECT_EQ(7u, next.GetListedCount());
+  EXPECT_EQ(7u, next.GetStates().size());
+  EXPECT_EQ(GetSerialHashTime(root), next.Walk(root));
+
+  // the second listing at the same time is trusted, only the new season is listed once more
+  const DirectoryStates confirmed = next.GetStates();
+  CRecursiveFastHash last(4, &confirmed);
+  EXPECT_EQ(GetSerialHashTime(root), last.Walk(root));
+  EXPECT_EQ(1u, last.GetListedCount());
+
+  EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(root));
+}
+
+TEST(TestRecursiveFastHash, ModificationTimeAheadOfClock)
+{
+  const std::string root = CreateTree("TestRecursiveFastHash", 2, 1, 0, std::chrono::hours(-1));
+
+  // listings are trusted regardless of the local clock
+  const DirectoryStates states = GetTrustedStates(root);
+  CRecursiveFastHash next(4, &states);
+  EXPECT_EQ(GetSerialHashTime(root), next.Walk(root));
+  EXPECT_FALSE(next.IsChanged());
+  EXPECT_EQ(0u, next.GetListedCount());
+
+  EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(root));
+}
+
+TEST(TestRecursiveFastHash, DISABLED_SyntheticTreeScanTime)
+{
+  // 100 shows with 10 seasons of 100 episodes each
+  const std::string root = CreateTree("TestRecursiveFastHashBenchmark", 100, 10, 100);
+
+  const auto measure = [](const auto& walk)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    const int64_t time = walk();
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return std::make_pair(time, elapsed.count());
+  };
+
+  const auto [serialTime, serialMs] = measure([&root]() { return GetSerialHashTime(root); });
+
+  CRecursiveFastHash cold(8, nullptr);
+  const auto [coldTime, coldMs] = measure([&root, &cold]() { return cold.Walk(root); });
+
+  const DirectoryStates states = GetTrustedStates(root);
+  CRecursiveFastHash warm(8, &states);
+  const auto [warmTime, warmMs] = measure([&root, &warm]() { return warm.Walk(root); });
+
+  EXPECT_EQ(serialTime, coldTime);
+  EXPECT_EQ(serialTime, warmTime);
+  EXPECT_EQ(0u, warm.GetListedCount());
+
+  RecordProperty("SerialMs", static_cast<int>(serialMs));
+  RecordProperty("ParallelMs", static_cast<int>(coldMs));
+  RecordProperty("IncrementalMs", static_cast<int>(warmMs));
+
+  EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(root));
+}
@@ -0,0 +1,205 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DatabaseManager.h"
+#include "ServiceBroker.h"
+#include "utils/Artwork.h"
+#include "video/VideoDatabase.h"
+#include "video/VideoInfoTag.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr int TITLES = 10000;
+constexpr int BATCH_SIZE = 100;
+
+const char* ART_TYPES[] = {"poster", "fanart", "clearlogo"};
+
+CVideoInfoTag MakeMovie(int i)
+{
+  CVideoInfoTag tag;
+  tag.m_strTitle = "Title " + std::to_string(i);
+  tag.m_strFileNameAndPath = "/movies/Title " + std::to_string(i) + ".mkv";
+  tag.SetYear(1950 + i % 75);
+  tag.SetRating(6.5f);
+  tag.m_genre = {"Genre " + std::to_string(i % 20)};
+  tag.m_director = {"Director " + std::to_string(i % 500)};
+  return tag;
+}
+
+CVideoInfoTag MakeEpisode(int i)
+{
+  CVideoInfoTag tag;
+  tag.m_strTitle = "Episode " + std::to_string(i);
+  tag.m_strFileNameAndPath =
+      "/tv/Show/Season " + std::to_string(i / 100) + "/S" + std::to_string(i) + ".mkv";
+  tag.m_iSeason = i / 100;
+  tag.m_iEpisode = i % 100 + 1;
+  tag.SetRating(7.5f);
+  return tag;
+}
+
+KODI::ART::Artwork MakeArt(int i)
+{
+  KODI::ART::Artwork art;
+  for (const char* type : ART_TYPES)
+    art[type] = "image://" + std::to_string(i) + type;
+  return art;
+}
+} // namespace
+
+class TestVideoDatabase : public ::testing::Test
+{
+protected:
+  // creates the databases in the profile folder of the test environment
+  static void SetUpTestSuite() { CServiceBroker::GetDatabaseManager().Initialize(); }
+
+  void SetUp() override { ASSERT_TRUE(m_db.Open()); }
+
+  void TearDown() override { m_db.Close(); }
+
+  int Count(const std::string& table) { return m_db.GetSingleValueInt(table, "COUNT(1)"); }
+
+  int AddShow()
+  {
+    CVideoInfoTag show;
+    show.m_strTitle = "Show";
+    show.m_strPath = "/tv/Show/";
+    return m_db.SetDetailsForTvShow({show.m_strPath}, show, {}, {});
+  }
+
+  CVideoDatabase m_db;
+};
+
+TEST_F(TestVideoDatabase, BatchedEpisodes)
+{
+  const int idShow = AddShow();
+  ASSERT_GT(idShow, 0);
+
+  // the way CVideoInfoScanner batches the episodes of a show
+  m_db.BeginTransaction();
+  for (int i = 0; i < 10; ++i)
+  {
+    CVideoInfoTag episode = MakeEpisode(i);
+    EXPECT_GT(m_db.SetDetailsForEpisode(episode, MakeArt(i), idShow), 0);
+  }
+  EXPECT_TRUE(m_db.CommitTransaction());
+
+  for (int i = 0; i < 10; ++i)
+  {
+    const CVideoInfoTag episode = MakeEpisode(i);
+    EXPECT_GT(m_db.GetEpisodeId(episode.m_strFileNameAndPath, episode.m_iEpisode,
+                                episode.m_iSeason),
+              -1);
+  }
+}
+
+TEST_F(TestVideoDatabase, FailedItemLeavesNoRowsInBatch)
+{
+  // fails an item halfway, after its file, movie and link rows were written
+  ASSERT_TRUE(m_db.ExecuteQuery("CREATE TEMP TRIGGER fail_art BEFORE INSERT ON art "
+                                "WHEN NEW.url = 'fail' BEGIN SELECT RAISE(ABORT, 'fail'); END"));
+  const int movies = Count("movie");
+  const int files = Count("files");
+  const int genreLinks = Count("genre_link");
+
+  CVideoInfoTag added = MakeMovie(-1);
+  CVideoInfoTag failed = MakeMovie(-2);
+  m_db.BeginTransaction();
+  EXPECT_GT(m_db.SetDetailsForMovie(added, MakeArt(-1)), 0);
+  EXPECT_EQ(-1, m_db.SetDetailsForMovie(failed, {{"poster", "fail"}}));
+  EXPECT_TRUE(m_db.CommitTransaction());
+  EXPECT_TRUE(m_db.ExecuteQuery("DROP TRIGGER fail_art"));
+
+  EXPECT_GT(m_db.GetMovieId(added.m_strFileNameAndPath), -1);
+  EXPECT_EQ(-1, m_db.GetMovieId(failed.m_strFileNameAndPath));
+  EXPECT_EQ(movies + 1, Count("movie"));
+  EXPECT_EQ(files + 1, Count("files"));
+  EXPECT_EQ(genreLinks + 1, Count("genre_link"));
+}
+
+TEST_F(TestVideoDatabase, DISABLED_Import10kTitles)
+{
+  auto measure = [](auto&& func)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                 start)
+        .count();
+  };
+
+  const int moviesBefore = Count("movie");
+  const int episodesBefore = Count("episode");
+
+  // a transaction for every title, the way items are written when not batched
+  const auto unbatchedMs = measure(
+      [this]()
+      {
+        for (int i = 0; i < TITLES; ++i)
+        {
+          CVideoInfoTag movie = MakeMovie(i);
+          m_db.SetDetailsForMovie(movie, MakeArt(i));
+        }
+      });
+
+  // the scanner's batches, SetDetailsForMovie nesting into the outer transaction
+  const auto batchedMs = measure(
+      [this]()
+      {
+        for (int i = TITLES; i < 2 * TITLES; ++i)
+        {
+          if (i % BATCH_SIZE == 0)
+            m_db.BeginTransaction();
+          CVideoInfoTag movie = MakeMovie(i);
+          m_db.SetDetailsForMovie(movie, MakeArt(i));
+          if (i % BATCH_SIZE == BATCH_SIZE - 1)
+            m_db.CommitTransaction();
+        }
+      });
+
+  const int idShow = AddShow();
+  ASSERT_GT(idShow, 0);
+
+  const auto unbatchedEpisodesMs = measure(
+      [this, idShow]()
+      {
+        for (int i = 0; i < TITLES; ++i)
+        {
+          CVideoInfoTag episode = MakeEpisode(i);
+          m_db.SetDetailsForEpisode(episode, MakeArt(i), idShow);
+        }
+      });
+
+  const auto batchedEpisodesMs = measure(
+      [this, idShow]()
+      {
+        for (int i = TITLES; i < 2 * TITLES; ++i)
+        {
+          if (i % BATCH_SIZE == 0)
+            m_db.BeginTransaction();
+          CVideoInfoTag episode = MakeEpisode(i);
+          m_db.SetDetailsForEpisode(episode, MakeArt(i), idShow);
+          if (i % BATCH_SIZE == BATCH_SIZE - 1)
+            m_db.CommitTransaction();
+        }
+      });
+
+  EXPECT_EQ(moviesBefore + 2 * TITLES, Count("movie"));
+  EXPECT_EQ(episodesBefore + 2 * TITLES, Count("episode"));
+
+  RecordProperty("UnbatchedMs", static_cast<int>(unbatchedMs));
+  RecordProperty("BatchedMs", static_cast<int>(batchedMs));
+  RecordProperty("UnbatchedEpisodesMs", static_cast<int>(unbatchedEpisodesMs));
+  RecordProperty("BatchedEpisodesMs", static_cast<int>(batchedEpisodesMs));
+}
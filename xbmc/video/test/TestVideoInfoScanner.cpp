@@ -11,6 +11,11 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "video/VideoInfoScanner.h"
+#include "video/VideoScanPipeline.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -139,3 +144,52 @@ TEST(TestVideoInfoScanner, EnumerateEpisodeItemByTitle)
   ASSERT_EQ(result.size(), 1);
   ASSERT_EQ(result[0].strTitle, "foo");
 }
+
+namespace
+{
+// gives access to the pipeline a scan looks up its items with
+class CPipelineScanner : public VIDEO::CVideoInfoScanner
+{
+public:
+  using CVideoInfoScanner::CreatePipeline;
+};
+} // namespace
+
+TEST(TestVideoInfoScanner, StopCancelsPipeline)
+{
+  constexpr int ITEMS = 100;
+  CPipelineScanner scanner;
+  const auto pipeline = scanner.CreatePipeline(4);
+
+  std::atomic<int> lookups{0};
+  int writes = 0;
+  int added = 0;
+  for (; added < ITEMS; added++)
+  {
+    // the scan is stopped from a lookup thread while the items are added
+    const bool proceed = pipeline->Add(
+        {},
+        [&scanner, &lookups]
+        {
+          if (++lookups == 3)
+            scanner.Stop();
+          std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        },
+        [&writes]
+        {
+          writes++;
+          return true;
+        });
+    if (!proceed)
+      break;
+  }
+
+  EXPECT_LT(added, ITEMS);
+  EXPECT_FALSE(pipeline->Finish());
+  // the lookups not started yet are dropped, and none of the running ones is written
+  EXPECT_LT(lookups, ITEMS / 2);
+  EXPECT_LT(writes, 3);
+
+  // a pipeline created after stopping starts out cancelled
+  EXPECT_FALSE(scanner.CreatePipeline(4)->Add({}, [] {}, [] { return true; }));
+}
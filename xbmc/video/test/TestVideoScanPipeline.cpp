@@ -0,0 +1,195 @@
+/*
+ *  Copyright (C) 2025 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "video/VideoScanPipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr int ITEMS = 24;
+
+// stands in for a scraper, every query waits on the network for a while
+class CStubScraper
+{
+public:
+  explicit CStubScraper(std::chrono::milliseconds latency) : m_latency(latency) {}
+
+  std::string Lookup(int item)
+  {
+    const int running = ++m_running;
+    int peak = m_peak;
+    while (running > peak && !m_peak.compare_exchange_weak(peak, running))
+      ;
+    std::this_thread::sleep_for(m_latency);
+    --m_running;
+    return "details of " + std::to_string(item);
+  }
+
+  int GetPeak() const { return m_peak; }
+
+private:
+  const std::chrono::milliseconds m_latency;
+  std::atomic<int> m_running{0};
+  std::atomic<int> m_peak{0};
+};
+
+// scans all items
+void Scan(unsigned int concurrency, CStubScraper& scraper, std::vector<std::string>& written)
+{
+  CVideoScanPipeline pipeline(concurrency);
+  std::vector<std::string> details(ITEMS);
+  for (int i = 0; i < ITEMS; i++)
+  {
+    EXPECT_TRUE(pipeline.Add(
+        {}, [&scraper, &details, i] { details[i] = scraper.Lookup(i); },
+        [&written, &details, i]
+        {
+          written.push_back(details[i]);
+          return true;
+        }));
+  }
+  EXPECT_TRUE(pipeline.Finish());
+  EXPECT_EQ(static_cast<unsigned int>(ITEMS), pipeline.GetStats().writes);
+}
+} // namespace
+
+TEST(TestVideoScanPipeline, WritesInOrderOnCallingThread)
+{
+  CVideoScanPipeline pipeline(4);
+  const std::thread::id caller = std::this_thread::get_id();
+
+  std::vector<int> written;
+  for (int i = 0; i < ITEMS; i++)
+  {
+    // later items complete first
+    const auto latency = std::chrono::milliseconds((ITEMS - i) % 5);
+    ASSERT_TRUE(pipeline.Add(
+        {}, [latency] { std::this_thread::sleep_for(latency); },
+        [&written, caller, i]
+        {
+          EXPECT_EQ(caller, std::this_thread::get_id());
+          written.push_back(i);
+          return true;
+        }));
+  }
+  ASSERT_TRUE(pipeline.Finish());
+
+  ASSERT_EQ(static_cast<size_t>(ITEMS), written.size());
+  for (int i = 0; i < ITEMS; i++)
+    EXPECT_EQ(i, written[i]);
+}
+
+TEST(TestVideoScanPipeline, KeepsOrderOfSameKey)
+{
+  CVideoScanPipeline pipeline(4);
+  std::mutex lock;
+  std::map<std::string, std::vector<int>> started;
+  std::map<std::string, int> running;
+
+  for (int i = 0; i < ITEMS; i++)
+  {
+    const std::string show = "show " + std::to_string(i % 3);
+    ASSERT_TRUE(pipeline.Add(
+        show,
+        [&, show, i]
+        {
+          {
+            std::unique_lock l(lock);
+            EXPECT_EQ(0, running[show]++) << show;
+            started[show].push_back(i);
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(1 + i % 4));
+          std::unique_lock l(lock);
+          running[show]--;
+        },
+        [] { return true; }));
+  }
+  ASSERT_TRUE(pipeline.Finish());
+
+  for (const auto& [show, episodes] : started)
+  {
+    EXPECT_EQ(static_cast<size_t>(ITEMS / 3), episodes.size());
+    EXPECT_TRUE(std::ranges::is_sorted(episodes)) << show;
+  }
+}
+
+TEST(TestVideoScanPipeline, StopsOnFailedWrite)
+{
+  CVideoScanPipeline pipeline(4);
+  std::atomic<int> lookups{0};
+  int writes = 0;
+
+  bool added = true;
+  for (int i = 0; i < ITEMS && added; i++)
+  {
+    added = pipeline.Add(
+        {}, [&lookups] { ++lookups; },
+        [&writes, i]
+        {
+          writes++;
+          return i != 5;
+        });
+  }
+  // the failed write may happen while adding or when finishing
+  EXPECT_FALSE(pipeline.Finish());
+  EXPECT_EQ(6, writes);
+  EXPECT_FALSE(pipeline.Add({}, [] {}, [] { return true; }));
+}
+
+TEST(TestVideoScanPipeline, CancelDoesNotWaitForWrite)
+{
+  for (unsigned int concurrency : {1u, 4u})
+  {
+    CVideoScanPipeline pipeline(concurrency);
+    // cancelling from another thread while a write runs must not block on that write
+    bool added = true;
+    for (int i = 0; i < ITEMS && added; i++)
+    {
+      added = pipeline.Add(
+          {}, [] {},
+          [&pipeline]
+          {
+            std::thread([&pipeline] { pipeline.Cancel(); }).join();
+            return true;
+          });
+    }
+    EXPECT_FALSE(added) << concurrency;
+    EXPECT_FALSE(pipeline.Finish()) << concurrency;
+    EXPECT_EQ(1u, pipeline.GetStats().writes) << concurrency;
+  }
+}
+
+TEST(TestVideoScanPipeline, RunsLookupsConcurrently)
+{
+  std::vector<std::string> serialWritten;
+  CStubScraper serialScraper(20ms);
+  Scan(1, serialScraper, serialWritten);
+  EXPECT_EQ(1, serialScraper.GetPeak());
+
+  // the lookups outlast adding the items, so all allowed lookups are in flight at once
+  std::vector<std::string> parallelWritten;
+  CStubScraper parallelScraper(20ms);
+  Scan(4, parallelScraper, parallelWritten);
+  EXPECT_EQ(4, parallelScraper.GetPeak());
+
+  // same results, in the same order
+  EXPECT_EQ(serialWritten, parallelWritten);
+}
@@ -10,6 +10,7 @@
 
 #include "CompileInfo.h"
 #include "GUIInfoManager.h"
+#include "GUILargeTextureManager.h"
 #include "ServiceBroker.h"
 #include "addons/Skin.h"
 #include "filesystem/SpecialProtocol.h"
@@ -17,7 +18,9 @@
 #include "guilib/GUIControlFactory.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUITextLayout.h"
+#include "guilib/GUITextureBudget.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/WindowTranslator.h"
 #include "settings/AdvancedSettings.h"
@@ -28,6 +31,7 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <inttypes.h>
 
 CGUIWindowDebugInfo::CGUIWindowDebugInfo(void)
@@ -99,6 +103,8 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
     KODI::MEMORY::MemoryStatus stat;
     KODI::MEMORY::GetMemoryStatus(&stat);
     std::string profiling = CGUIControlProfiler::IsRunning() ? " (profiling)" : "";
+    if (CGUIFrameProfiler::IsRecording())
+      profiling += " (tracing)";
     std::string strCores;
     if (CServiceBroker::GetCPUInfo()->SupportsCPUUsage())
       strCores = CServiceBroker::GetCPUInfo()->GetCoresUsageString();
@@ -169,6 +175,29 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
             "Focused: {} ({})", control->GetID(),
             CGUIControlFactory::TranslateControlType(control->GetControlType()));
     }
+    const CGUIInfoManager::EvaluationStats stats =
+        CServiceBroker::GetGUI()->GetInfoManager().GetEvaluationStats();
+    info += StringUtils::Format("\nConditions: {} evaluated, {} cached", stats.evaluations,
+                                stats.cached);
+    const CGUILargeTextureManager::PrefetchStats prefetch =
+        CServiceBroker::GetGUI()->GetLargeTextureManager().GetPrefetchStats();
+    const unsigned int shown = prefetch.hits + prefetch.late + prefetch.misses;
+    info += StringUtils::Format(
+        "\nPrefetch: {} queued, {} hits, {} late, {} misses, {} wasted ({}% hit rate)",
+        prefetch.queued, prefetch.hits, prefetch.late, prefetch.misses, prefetch.wasted,
+        shown ? prefetch.hits * 100 / shown : 0);
+    const CGUITextureBudget::Stats textures =
+        CServiceBroker::GetGUI()->GetTextureBudget().GetStats();
+    info += StringUtils::Format(
+        "\nTextures: {} MiB resident, {} MiB unused, {} MiB budget, {} evicted",
+        textures.residentBytes / (1024 * 1024), textures.unusedBytes / (1024 * 1024),
+        textures.budgetBytes / (1024 * 1024), textures.evicted);
+    const CDirtyRegionTracker::Stats regions =
+        CServiceBroker::GetGUI()->GetWindowManager().GetDirtyRegionStats();
+    const uint64_t viewport = std::max<uint64_t>(regions.renderedPixels + regions.savedPixels, 1);
+    info += StringUtils::Format("\nDirty regions: {}, {} passes, {} pixels saved ({}%), {} us",
+                                regions.strategy, regions.passes, regions.savedPixels,
+                                regions.savedPixels * 100 / viewport, regions.duration.count());
   }
 
   float w, h;